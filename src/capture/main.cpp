@@ -0,0 +1,460 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#include "CaptureReader.h"
+#include "CaptureWriter.h"
+#include "Event.h"
+#include "EventMerger.h"
+#include "LatencyBenchmark.h"
+#include "MidiManager.h"
+#include "MidiTypes.h"
+#include "Replayer.h"
+#include "SpscRing.h"
+#include "SysExPool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using CaptureRing = midi::SpscRing<midi::Event, 16384>;
+
+volatile std::sig_atomic_t running = 1;
+
+void stop(int) {
+    running = 0;
+}
+
+void usage() {
+    std::fprintf(stderr,
+        "usage: beagle-capture [options]\n"
+        "  -l, --list            list input ports and exit\n"
+        "  -i, --input PATTERN   capture from ports matching PATTERN ('*' and '?' wildcards), repeatable\n"
+        "  -o, --output FILE     write events to FILE instead of stdout\n"
+        "  -b, --binary          write a binary capture (requires --output)\n"
+        "  -d, --dump FILE       print a binary capture as text and exit\n"
+        "  -r, --replay FILE     replay a binary capture to the output port given by --port\n"
+        "  -p, --port PATTERN    output port for --replay and --latency\n"
+        "  -s, --speed RATE      replay speed from 0.25 to 100, or 0 for as fast as possible\n"
+        "  -L, --latency         measure round-trip latency from --port back to --input\n"
+        "                        (both default to the in-process loopback)\n"
+        "  -n, --count N         number of latency probes or --throughput messages (default 10000)\n"
+        "  -R, --rate HZ         latency probes per second (default 1000)\n"
+        "  -T, --throughput      compare single and batched send rates on --port\n"
+        "  -B, --batch N         messages per flush for --throughput (default 256)\n"
+        "  -D, --dispatch        compare std::function and template input dispatch over the loopback\n");
+}
+
+bool matches(const char* pattern, const char* name) {
+    if (*pattern == '\0')
+        return *name == '\0';
+    if (*pattern == '*')
+        return matches(pattern + 1, name) || (*name != '\0' && matches(pattern, name + 1));
+    if (*name != '\0' && (*pattern == '?' || *pattern == *name))
+        return matches(pattern + 1, name + 1);
+    return false;
+}
+
+std::string findPort(const std::vector<std::string>& portNames, const std::string& pattern) {
+    for (auto& name : portNames) {
+        if (matches(pattern.c_str(), name.c_str()))
+            return name;
+    }
+    return std::string();
+}
+
+void writeEvent(std::FILE* file, const midi::Event& event, const char* portName) {
+    std::fprintf(file, "%llu\t%s\t%s\t%d\t%d\t%d\n",
+                 (unsigned long long)event.time,
+                 portName,
+                 midi::typeName(event.status),
+                 (event.status & 0x0F) + 1,
+                 event.data1,
+                 event.data2);
+}
+
+int dump(const char* path) {
+    midi::CaptureReader reader;
+    if (!reader.open(path)) {
+        std::fprintf(stderr, "beagle-capture: '%s' is not a capture file\n", path);
+        return 1;
+    }
+    if (!reader.isComplete())
+        std::fprintf(stderr, "beagle-capture: '%s' was not closed cleanly\n", path);
+    else if (!reader.isOrdered())
+        std::fprintf(stderr, "beagle-capture: '%s' has records out of time order\n", path);
+
+    std::vector<std::string> portNames(256);
+    for (auto& port : reader.ports()) {
+        if (port.port < portNames.size())
+            portNames[port.port] = port.name;
+    }
+
+    for (uint64_t record = 0; record < reader.size(); ++record) {
+        const auto& event = reader[record];
+        if (reader.isSysEx(record)) {
+            std::printf("%llu\t%s\tSysEx\t%zu bytes\n",
+                        (unsigned long long)event.time,
+                        portNames[event.port].c_str(),
+                        reader.sysEx(record).size());
+        } else {
+            writeEvent(stdout, event, portNames[event.port].c_str());
+        }
+    }
+    return 0;
+}
+
+int replay(const char* path, const std::string& pattern, double speed) {
+    midi::CaptureReader reader;
+    if (!reader.open(path)) {
+        std::fprintf(stderr, "beagle-capture: '%s' is not a capture file\n", path);
+        return 1;
+    }
+
+    midi::MidiManager manager;
+    const auto portName = findPort(manager.getOutputPortNames(), pattern);
+    if (portName.empty() || !manager.openOutputPort(portName)) {
+        std::fprintf(stderr, "beagle-capture: could not open an output port matching '%s'\n", pattern.c_str());
+        return 1;
+    }
+
+    std::signal(SIGINT, stop);
+    std::signal(SIGTERM, stop);
+
+    midi::ReplayOptions options;
+    options.speed = speed;
+    midi::Replayer replayer(reader, manager);
+    if (!replayer.start(options)) {
+        std::fprintf(stderr, "beagle-capture: nothing to replay\n");
+        return 1;
+    }
+    std::fprintf(stderr, "beagle-capture: replaying %llu events to '%s'\n", (unsigned long long)reader.size(), portName.c_str());
+
+    while (running && replayer.isRunning()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    replayer.stop();
+
+    const auto& stats = replayer.stats();
+    std::printf("sent %llu events\n", (unsigned long long)stats.sent);
+    if (speed > 0.0 && stats.sent > 0) {
+        std::printf("timing error: min %.1f us, mean %.1f us, max %.1f us, %llu early\n",
+                    stats.minError * 1e-3, stats.meanError * 1e-3, stats.maxError * 1e-3,
+                    (unsigned long long)stats.early);
+        for (size_t bucket = 0; bucket < stats.histogram.size(); ++bucket) {
+            if (stats.histogram[bucket] > 0)
+                std::printf("  < %8llu us  %llu\n", 1ull << bucket, (unsigned long long)stats.histogram[bucket]);
+        }
+    }
+    return 0;
+}
+
+int latency(const std::string& inputPattern, const std::string& outputPattern, const midi::LatencyOptions& options) {
+    midi::MidiManager manager;
+    const auto input = findPort(manager.getInputPortNames(), inputPattern);
+    const auto output = findPort(manager.getOutputPortNames(), outputPattern);
+    if (input.empty() || output.empty()) {
+        std::fprintf(stderr, "beagle-capture: no matching loopback ports\n");
+        return 1;
+    }
+
+    std::fprintf(stderr, "beagle-capture: sending %u probes at %.0f Hz from '%s' to '%s'\n",
+                 options.count, options.rate, output.c_str(), input.c_str());
+    midi::LatencyBenchmark benchmark(manager);
+    midi::LatencyReport report;
+    if (!benchmark.run(input, output, options, report)) {
+        std::fprintf(stderr, "beagle-capture: could not open the loopback ports\n");
+        return 1;
+    }
+
+    std::printf("received %llu of %llu probes\n", (unsigned long long)report.received, (unsigned long long)report.sent);
+    if (report.received > 0) {
+        std::printf("round trip: min %.1f us, median %.1f us, p99 %.1f us, p99.9 %.1f us, max %.1f us\n",
+                    report.min * 1e-3, report.median * 1e-3, report.p99 * 1e-3, report.p999 * 1e-3, report.max * 1e-3);
+        std::printf("mean %.1f us, jitter %.1f us\n", report.mean * 1e-3, report.jitter * 1e-3);
+    }
+    return report.received == report.sent ? 0 : 1;
+}
+
+double sendRate(midi::MidiManager& manager, uint32_t count, size_t batch) {
+    const auto start = midi::monotonicNanoseconds();
+    for (uint32_t index = 0; index < count; ++index) {
+        const midi::ChannelMessage message(0xB0 | (index >> 7 & 0x0F), index & 0x7F, index >> 3 & 0x7F);
+        if (batch > 1)
+            manager.queueMessage(message);
+        else
+            manager.sendMessage(message);
+    }
+    manager.flushOutput();
+    const auto elapsed = midi::monotonicNanoseconds() - start;
+    return elapsed > 0 ? count / (elapsed * 1e-9) : 0.0;
+}
+
+int throughput(const std::string& pattern, uint32_t count, size_t batch) {
+    midi::MidiManager manager;
+    const auto output = findPort(manager.getOutputPortNames(), pattern);
+    if (output.empty() || !manager.openOutputPort(output)) {
+        std::fprintf(stderr, "beagle-capture: could not open an output port matching '%s'\n", pattern.c_str());
+        return 1;
+    }
+    manager.setFlushThreshold(batch);
+
+    std::fprintf(stderr, "beagle-capture: sending %u control changes to '%s'\n", count, output.c_str());
+    const auto single = sendRate(manager, count, 1);
+    const auto batched = sendRate(manager, count, batch);
+    std::printf("single:  %12.0f events/s\n", single);
+    std::printf("batched: %12.0f events/s (%zu per flush)\n", batched, batch);
+    return 0;
+}
+
+struct CountingSink {
+    uint64_t* count;
+    uint64_t* checksum;
+
+    void operator()(const midi::Event& event) const {
+        ++*count;
+        *checksum += event.data1;
+    }
+};
+
+// Nanoseconds per event through the loopback, for whichever way open
+// binds the input.
+template <typename Open>
+double dispatchCost(uint32_t count, Open open) {
+    midi::MidiManager manager;
+    if (!open(manager) || !manager.openOutputPort(midi::kLoopbackPortName))
+        return 0.0;
+
+    const auto start = midi::monotonicNanoseconds();
+    for (uint32_t index = 0; index < count; ++index) {
+        manager.sendMessage(midi::ChannelMessage(0xB0, index & 0x7F, 0));
+    }
+    return (midi::monotonicNanoseconds() - start) / (double)count;
+}
+
+int dispatch(uint32_t count) {
+    uint64_t received = 0;
+    uint64_t checksum = 0;
+    const CountingSink sink = {&received, &checksum};
+
+    const auto function = dispatchCost(count, [&](midi::MidiManager& manager) {
+        return manager.openInputPort(midi::kLoopbackPortName, midi::MidiEventFunction(sink));
+    });
+    const auto bound = dispatchCost(count, [&](midi::MidiManager& manager) {
+        return manager.bindInputPort(midi::kLoopbackPortName, sink);
+    });
+
+    std::printf("std::function: %6.1f ns/event\n", function);
+    std::printf("template sink: %6.1f ns/event\n", bound);
+    std::printf("(%llu events, checksum %llu)\n", (unsigned long long)received, (unsigned long long)checksum);
+    return received == 2ull * count ? 0 : 1;
+}
+
+}
+
+int main(int argc, char** argv) {
+    bool list = false;
+    std::vector<std::string> patterns;
+    const char* outputPath = nullptr;
+    bool binary = false;
+    const char* replayPath = nullptr;
+    std::string replayPort;
+    double speed = 1.0;
+    bool measureLatency = false;
+    bool measureThroughput = false;
+    bool measureDispatch = false;
+    size_t batch = 256;
+    midi::LatencyOptions latencyOptions;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "-l" || arg == "--list") {
+            list = true;
+        } else if ((arg == "-i" || arg == "--input") && i + 1 < argc) {
+            patterns.push_back(argv[++i]);
+        } else if ((arg == "-o" || arg == "--output") && i + 1 < argc) {
+            outputPath = argv[++i];
+        } else if (arg == "-b" || arg == "--binary") {
+            binary = true;
+        } else if ((arg == "-d" || arg == "--dump") && i + 1 < argc) {
+            return dump(argv[++i]);
+        } else if ((arg == "-r" || arg == "--replay") && i + 1 < argc) {
+            replayPath = argv[++i];
+        } else if ((arg == "-p" || arg == "--port") && i + 1 < argc) {
+            replayPort = argv[++i];
+        } else if ((arg == "-s" || arg == "--speed") && i + 1 < argc) {
+            speed = std::atof(argv[++i]);
+        } else if (arg == "-L" || arg == "--latency") {
+            measureLatency = true;
+        } else if ((arg == "-n" || arg == "--count") && i + 1 < argc) {
+            latencyOptions.count = (uint32_t)std::strtoul(argv[++i], nullptr, 10);
+        } else if ((arg == "-R" || arg == "--rate") && i + 1 < argc) {
+            latencyOptions.rate = std::atof(argv[++i]);
+        } else if (arg == "-D" || arg == "--dispatch") {
+            measureDispatch = true;
+        } else if (arg == "-T" || arg == "--throughput") {
+            measureThroughput = true;
+        } else if ((arg == "-B" || arg == "--batch") && i + 1 < argc) {
+            batch = std::max<size_t>(1, std::strtoul(argv[++i], nullptr, 10));
+        } else {
+            usage();
+            return 1;
+        }
+    }
+
+    if (replayPath)
+        return replay(replayPath, replayPort.empty() ? "*" : replayPort, speed);
+    if (measureDispatch)
+        return dispatch(latencyOptions.count);
+    if (measureThroughput)
+        return throughput(replayPort.empty() ? "*" : replayPort, latencyOptions.count, batch);
+    if (measureLatency) {
+        return latency(patterns.empty() ? midi::kLoopbackPortName : patterns.front(),
+                       replayPort.empty() ? midi::kLoopbackPortName : replayPort,
+                       latencyOptions);
+    }
+
+    midi::MidiManager manager;
+    const auto portNames = manager.getInputPortNames();
+    if (list) {
+        for (auto& portName : portNames) {
+            std::printf("%s\n", portName.c_str());
+        }
+        return 0;
+    }
+
+    std::vector<std::string> ports;
+    for (auto& portName : portNames) {
+        for (auto& pattern : patterns) {
+            if (matches(pattern.c_str(), portName.c_str())) {
+                ports.push_back(portName);
+                break;
+            }
+        }
+    }
+
+    if (ports.empty()) {
+        std::fprintf(stderr, "beagle-capture: no matching input ports\n");
+        return 1;
+    }
+    if (ports.size() > 256) {
+        std::fprintf(stderr, "beagle-capture: too many matching input ports\n");
+        return 1;
+    }
+
+    if (binary && !outputPath) {
+        usage();
+        return 1;
+    }
+
+    midi::CaptureWriter writer;
+    std::FILE* file = stdout;
+    if (binary) {
+        for (auto& portName : ports) {
+            const auto port = manager.inputPortId(portName);
+            if (port != midi::MidiManager::kNoPortId)
+                writer.setPortName((midi::byte)port, portName);
+        }
+        if (!writer.open(outputPath)) {
+            std::perror(outputPath);
+            return 1;
+        }
+    } else if (outputPath) {
+        file = std::fopen(outputPath, "w");
+        if (!file) {
+            std::perror(outputPath);
+            return 1;
+        }
+    }
+
+    static midi::SysExPool sysExPool;
+    manager.setSysExPool(&sysExPool);
+
+    auto write = [&](const midi::Event& event) {
+        if (event.isSysEx()) {
+            const auto message = sysExPool.message(event.payload());
+            if (binary)
+                writer.append(message, event.time, event.port, event.direction);
+            else
+                std::fprintf(file, "%llu\t%s\tSysEx\t%zu bytes\n",
+                             (unsigned long long)event.time,
+                             manager.inputPortName(event.port).c_str(),
+                             message.size());
+            sysExPool.release(event.payload());
+        } else if (binary) {
+            writer.append(event);
+        } else {
+            writeEvent(file, event, manager.inputPortName(event.port).c_str());
+        }
+    };
+
+    static std::unique_ptr<CaptureRing> rings[256];
+    std::vector<midi::byte> ringPorts;
+    for (auto& portName : ports) {
+        const auto port = manager.inputPortId(portName);
+        if (port == midi::MidiManager::kNoPortId) {
+            std::fprintf(stderr, "beagle-capture: too many ports, could not open '%s'\n", portName.c_str());
+            return 1;
+        }
+        rings[port].reset(new CaptureRing());
+        ringPorts.push_back(port);
+
+        auto messagesRecieved = [](const midi::Event* events, size_t count) {
+            for (size_t index = 0; index < count; ++index) {
+                const auto& event = events[index];
+                if (!rings[event.port]->push(event) && event.isSysEx())
+                    sysExPool.release(event.payload());
+            }
+        };
+        if (!manager.openBatchedInputPort(portName, messagesRecieved)) {
+            std::fprintf(stderr, "beagle-capture: could not open '%s'\n", portName.c_str());
+            return 1;
+        }
+        std::fprintf(stderr, "beagle-capture: capturing '%s'\n", portName.c_str());
+    }
+
+    midi::EventMerger merger;
+    auto merge = [&](const midi::Event& event) {
+        if (!merger.add(event) && event.isSysEx())
+            sysExPool.release(event.payload());
+    };
+
+    std::signal(SIGINT, stop);
+    std::signal(SIGTERM, stop);
+
+    while (running) {
+        for (auto port : ringPorts) {
+            rings[port]->drain(merge);
+        }
+        if (merger.merge(midi::monotonicNanoseconds(), write) == 0) {
+            std::fflush(file);
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    }
+
+    manager.closePort();
+    uint64_t dropped = 0;
+    for (auto port : ringPorts) {
+        rings[port]->drain(merge);
+        dropped += rings[port]->overflowCount();
+    }
+    merger.flush(write);
+    dropped += merger.overflowCount();
+    dropped += writer.droppedCount();
+    if (dropped > 0)
+        std::fprintf(stderr, "beagle-capture: %llu events dropped\n", (unsigned long long)dropped);
+
+    if (binary)
+        writer.close();
+    else if (file != stdout)
+        std::fclose(file);
+
+    return 0;
+}
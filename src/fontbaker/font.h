@@ -1,1066 +1,3 @@
-// File: 'Karla-Regular.ttf' (16848 bytes)
-// Exported using binary_to_compressed_c
-static const unsigned int karla_compressed_size = 12719;
-static const unsigned int karla_compressed_data[12720/4] =
-{
-    0x0000bc57, 0x00000000, 0xd0410000, 0x00000400, 0x00010025, 0x82110000, 0x00042604, 0x49534410, 0x820d8247, 0xc841210c, 0x082c0782, 0x4d544646,
-    0xd227595e, 0x283d0000, 0x1c280f82, 0x46454447, 0xcc002800, 0x44200f82, 0x28280f82, 0x534f5047, 0x752f8003, 0x6c2f0f82, 0x00040000, 0x42555347,
-    0x3bea42dc, 0x82410000, 0x5c002d0f, 0x322f534f, 0xf03a3784, 0x98010000, 0x60282f82, 0x70616d63, 0x99c6fe2d, 0x94202b82, 0xe2241382, 0x70736167,
-    0x10201782, 0x20203f82, 0x08380782, 0x66796c67, 0x95c6bf74, 0xd0070000, 0x502e0000, 0x64616568, 0xbe6186f8, 0x1c202b82, 0x36211f82, 0x23108268,
-    0x3003c006, 0x54200f82, 0x24280f82, 0x78746d68, 0x9d22844b, 0xf8300f82, 0x9c020000, 0x61636f6c, 0xa497bf8b, 0x80060000, 0x50281382, 0x7078616d,
-    0x4200ee00, 0x78200b82, 0x202b2f82, 0x656d616e, 0xf3eca6eb, 0x82360000, 0xf2042d6f, 0x74736f70, 0x3e4dada6, 0x143b0000, 0x09283f82, 0x70657270,
-    0x858c0668, 0x2f833f82, 0x01000722, 0x03823582, 0x201fff2b, 0x3c0f5f46, 0x030b00f5, 0x241182e8, 0x7bbcca00, 0x2b07831f, 0x41a382cb, 0x0affaaff,
-    0x6f037e03, 0x08220f82, 0x05820200, 0x33820283, 0xff950327, 0x03000004, 0x231f82ac, 0x007e03d8, 0x18831182, 0xa7200388, 0xa7241184, 0x05003f00,
-    0x02241384, 0x01000000, 0x40201384, 0x02830982, 0xfd010324, 0x1d829001, 0xbc020824, 0x10828a02, 0x07858c20, 0x00dd0125, 0x82fa0032, 0x2702880f,
-    0x27000080, 0x42000008, 0x1384c282, 0x72797029, 0x00400073, 0x86122220, 0x00952283, 0x841882fc, 0xde012381, 0x0b827502, 0x02002024, 0x07822902,
-    0x07840282, 0x7c82ee20, 0x5200163e, 0x1c003201, 0x35007302, 0x45007802, 0x3d00d602, 0x59009403, 0x1b008800, 0x49006401, 0x1c320382, 0x38009c01,
-    0x12000f02, 0x1e00d200, 0x26005d01, 0x0782b300, 0x3900b03c, 0x33005202, 0x31004b01, 0x40004402, 0x34004f02, 0x1a002f02, 0x41003502, 0x17823d02,
-    0x1800d63a, 0x37006702, 0x42004502, 0x3800e700, 0x39000601, 0x2800c601, 0x4f00e801, 0x2f2a0782, 0x1e00f301, 0x4300ac03, 0x33823f02, 0x65006e2c,
-    0x33006502, 0x64009502, 0x03823202, 0x0f820c20, 0x0f828520, 0x65009d24, 0x03821801, 0x08009424, 0x07826102, 0x6500d424, 0x1b825003, 0x6300ad24,
-    0x1f828602, 0x07822a20, 0x07828c20, 0x13826520, 0x45005d3c, 0x0600f501, 0x57008e02, 0x12003302, 0x0e007f03, 0x2f008202, 0x0a002502, 0xc7825002,
-    0x3f823d20, 0x2d00b02a, 0xf2ff1d01, 0x1500c001, 0x3722e782, 0xa3823b01, 0x4600302a, 0x65004802, 0x32000302, 0x3c20cf82, 0x01210783, 0x24d38257,
-    0x021c0035, 0x2833825c, 0x015e002b, 0x02aaff3a, 0x218b8534, 0x9f82a703, 0x03825b20, 0x2f842220, 0x49026522, 0x7d20eb82, 0x0e300f82, 0x78013c00,
-    0x5e022200, 0xf7015700, 0xd5021200, 0x002e0382, 0xe4011a00, 0xdb010500, 0x5d013500, 0xcb844b00, 0xcb825d20, 0x3500032a, 0x14003502, 0x18004301,
-    0x17248382, 0x1a003f02, 0x34200390, 0x03855382, 0x7b826920, 0x3b826420, 0x03820720, 0x18010624, 0x0782d9ff, 0xae020422, 0x20060341, 0x8bff8286,
-    0x8bff8303, 0x00272303, 0x038f023c, 0x33820220, 0x36210385, 0x23078202, 0x0c002b01, 0x0b240382, 0xdeff2b01, 0x09200782, 0x0221f783, 0x8f238223,
-    0x83db8203, 0x820387df, 0x00652687, 0x012400b8, 0x2ec78297, 0x0117006e, 0x023700da, 0x003700d6, 0x822400d6, 0x020f2a03, 0x015c0045, 0x024f00e8,
-    0x06274213, 0x40003f2c, 0x1c003202, 0x18003002, 0x27423902, 0x0044260e, 0x00000042, 0x22038603, 0x8201001c, 0x00002409, 0x840300dc, 0x001c2409,
-    0x82c00004, 0x002c2211, 0x2e098220, 0x007e000c, 0x00a300a0, 0x00b400a8, 0x82cf00c4, 0x00dc3e6b, 0x00ef00e4, 0x01fc00f6, 0x02bc0231, 0x20dc02c6,
-    0x20192014, 0xff1222b9, 0x000000ff, 0x2e2d8820, 0x00c800c0, 0x00d900d1, 0x00e800e0, 0x88f900f1, 0x2013222d, 0x082d8518, 0xffe3ff29, 0xffbfff63,
-    0xffb0ffbb, 0xffa2ffa5, 0xff9fffa1, 0xff99ff9c, 0xff96ff98, 0xfdd8fd62, 0xe0bafdcf, 0xdf81e084, 0x848adee2, 0xa75c8297, 0x06012202, 0x26328800,
-    0x00000201, 0x8d000200, 0x82012000, 0x047e08fe, 0x08070605, 0x0c0b0a09, 0x100f0e0d, 0x14131211, 0x18171615, 0x1c1b1a19, 0x201f1e1d, 0x24232221,
-    0x28272625, 0x2c2b2a29, 0x302f2e2d, 0x34333231, 0x38373635, 0x3c3b3a39, 0x403f3e3d, 0x44434241, 0x48474645, 0x4c4b4a49, 0x504f4e4d, 0x54535251,
-    0x58575655, 0x5c5b5a59, 0x605f5e5d, 0x00690061, 0x77726b00, 0x7e7c7d7b, 0x00007f80, 0x84838182, 0x88878586, 0x8c8a8b89, 0x8f908d8e, 0x90829291,
-    0x03826220, 0x64210283, 0x98058363, 0x65032b03, 0x00007668, 0x00009897, 0x248e9a99, 0x666c6732, 0x706f6a6d, 0x75746e71, 0x7a797300, 0x96959378,
-    0xb8262189, 0xb085ff01, 0x10898d04, 0x00007409, 0x002e001a, 0x00a80060, 0x014801f0, 0x016c0156, 0x01a00182, 0x01ce01b6, 0x01ee01dc, 0x021c02fc,
-    0x025e0230, 0x02ae0292, 0x030803d6, 0x035e031c, 0x03b60398, 0x04ee03da, 0x04160402, 0x04a6044e, 0x05f004be, 0x05360516, 0x0564054e, 0x05a6058e,
-    0x05cc05b4, 0x06f805e8, 0x062c0614, 0x06700650, 0x06ca06a4, 0x071007fe, 0x0742072e, 0x077a0760, 0x07a80790, 0x07c807ba, 0x07ea07d8, 0x080608f8,
-    0x0862083a, 0x08ae0886, 0x09fa08d8, 0x09720954, 0x09b4098c, 0x0ada09cc, 0x0a260a08, 0x0a6e0a48, 0x0abc0aa2, 0x0b100bee, 0x0b420b2e, 0x0b780b60,
-    0x0bb20b9a, 0x0cec0bde, 0x0c380c18, 0x0c8e0c6e, 0x0cbc0c9c, 0x0dfe0cdc, 0x0d620d32, 0x0da00d82, 0x0ef20dc2, 0x0e1a0e06, 0x0e580e32, 0x0eb80e8c,
-    0x0f120fe4, 0x0f8e0f52, 0x10d80fb2, 0x10361000, 0x10ac1070, 0x113c11ea, 0x11ba1188, 0x121c12e8, 0x1272125e, 0x129e1286, 0x130013c4, 0x1354132a,
-    0x13c21382, 0x142414fe, 0x1472144a, 0x14b814aa, 0x15e214d0, 0x15141506, 0x153c1522, 0x15841558, 0x15b01592, 0x16f015c4, 0x16421626, 0x169a1668,
-    0x17f016ae, 0x00020028, 0x00f7ff52, 0x007302c9, 0x000b0003, 0x03331300, 0x34261623, 0x14163236, 0x09536306, 0x21210640, 0x02232333, 0xb93dfe73,
-    0x82212f21, 0x82002002, 0x00022800, 0x01cd011c, 0x82a90216, 0x82072033, 0x23072333, 0x03823327, 0x3c0b6e24, 0x0382fa0b, 0xdca90222, 0x27840082,
-    0x1f003534, 0x51024a02, 0x1f001b00, 0x23250000, 0x23372307, 0x03843337, 0x33073323, 0x22038237, 0x82072307, 0x823c823a, 0x01270815, 0x4a0e9a7c,
-    0x6405630e, 0x64066513, 0x9a0f4a0f, 0x670f490f, 0x67136606, 0x4a0e6706, 0x99139985, 0x368b8baa, 0x828a35b2, 0xb2352500, 0xb2c18b36, 0x81826282,
-    0xa5ff4526, 0xc9023302, 0x26266182, 0x00002d00, 0xba821601, 0x2315072c, 0x35262635, 0x35171433, 0xce822627, 0x35376508, 0x16161533, 0x27262317,
-    0x27341715, 0x36361527, 0x16140602, 0x01351717, 0x724d45a1, 0x795f3e66, 0x53208b4d, 0x3e636555, 0x4e0b5e57, 0x5c806111, 0xf7413f24, 0x1e2d283a,
-    0x4d174a01, 0x51066585, 0x57670852, 0x0ceb0d71, 0x5986481a, 0x074c4b07, 0x0c504456, 0x1d4abad7, 0x3e05dc0c, 0x4936b201, 0xc70b0e29, 0x05308f83,
-    0xf5ff3d00, 0x80029b02, 0x13000900, 0x21001700, 0x12399383, 0x06141516, 0x34352622, 0x22261636, 0x16141506, 0x25353632, 0x01230133, 0x21ab8232,
-    0xa0822223, 0x16841720, 0x17823320, 0xf126342b, 0x496c4b4c, 0x3a24764a, 0x33028224, 0xfe521901, 0xaa015159, 0x364b4b36, 0x36494936, 0x1d24241d,
-    0x023d0382, 0x44444c80, 0x43434c4b, 0x2c2c614d, 0x2a2a2f2f, 0x8bfd852f, 0x894b1401, 0x4c874c4b, 0x3a118535, 0x00002c2f, 0x59000300, 0x6503f5ff,
-    0x24007f02, 0x37002b00, 0x06010000, 0x82161707, 0x33372380, 0x7a820606, 0x83272721, 0x36342305, 0x9e832737, 0x072c8f83, 0x04373617, 0x32161406,
-    0x34372737, 0x1422ae82, 0x11821716, 0x02366308, 0x2b462dd5, 0x27311f14, 0x43044a03, 0x27422740, 0x6980641a, 0x0e5c5f8e, 0x67ad694d, 0x449e584e,
-    0x495afe2c, 0xba51ac53, 0x3763379b, 0x681b1e1a, 0x5e010610, 0x11255589, 0x482d2510, 0x1623204f, 0x4b946959, 0x50430d0f, 0x7754543f, 0x528b2656,
-    0x6036667d, 0xc8a34245, 0x40373024, 0x30191a32, 0xae821134, 0x00010029, 0x00c9011b, 0x82a5026d, 0x13002cb9, 0x6d272307, 0x020b3c0b, 0x82dcdca5,
-    0x0001321c, 0x018fff49, 0x00d80248, 0x12000009, 0x26071710, 0x38b88226, 0x39ad9b17, 0x62646462, 0xfe000239, 0x5928af66, 0x5ad7e7d8, 0x00010029,
-    0x202b821c, 0x2a2b851b, 0x37271036, 0x06141616, 0x86c92707, 0x01662b2b, 0x5a29af9a, 0x59d8e7d7, 0x2b820028, 0x01383708, 0x02660184, 0x000e00ac,
-    0x37271300, 0x07332717, 0x17071737, 0x27072707, 0x6a1875ad, 0x6a0a3e0a, 0x2c5a7418, 0x022d5050, 0x36362804, 0x36368080, 0x68275928, 0x3b832768,
-    0x04821220, 0xeb01fd24, 0x07820b00, 0x15331536, 0x35231523, 0x35333523, 0xcece2f01, 0x01cece4f, 0xd443d4eb, 0xbe820282, 0x1e266782, 0xb20093ff,
-    0x2b836100, 0x39076543, 0x37362707, 0x391f1e52, 0x3b2d2c26, 0x1a030d3e, 0x442d1e2c, 0x1e1d1647, 0x2f82002d, 0x01012628, 0x45013601, 0x97820300,
-    0x2115212b, 0xfe100126, 0x444501f0, 0x2b1b8300, 0x00f7ff1e, 0x00680094, 0x16000007, 0x2706b143, 0x3321213f, 0x21092222, 0x2806a943, 0xff390001,
-    0x028401b7, 0x373f83db, 0x23033301, 0xfc503401, 0xfcdb024f, 0x020000dc, 0xf5ff3300, 0x80022002, 0x0f213f82, 0x39428200, 0x26220610, 0x26043610,
-    0x16140622, 0x9c013632, 0x85e48484, 0x54160185, 0x028254a1, 0xa880022f, 0xa6a8c5fe, 0xcba63f01, 0x83f58383, 0x207f8383, 0x24358231, 0x007702e6,
-    0x089b8208, 0x33373620, 0x06112311, 0x32433107, 0x35324e40, 0x2a094402, 0x190289fd, 0x01000320, 0x00004000, 0x67820102, 0x00001c23, 0x28c38237,
-    0x36373435, 0x35363737, 0x08698234, 0x3623073c, 0x14163236, 0x06070706, 0x018f1506, 0x5444fe6d, 0x607c211b, 0x064b7742, 0xbf7a0557, 0x7f454f78,
-    0x49492f30, 0x11346f5d, 0x5726320d, 0x32323d30, 0x99685852, 0x14331b5a, 0x83832933, 0xc3823420, 0x5b821120, 0x0c822120, 0x16071422, 0x21066643,
-    0xc1821633, 0x23263427, 0x32333523, 0x08678936, 0x6ef90134, 0xce7e4a3c, 0x5b025291, 0x534a4d8c, 0x54483148, 0x0d4b7044, 0xb7740b52, 0x64d4017d,
-    0x3d4e1127, 0x616b6553, 0x63434440, 0x60393f3f, 0x5335273e, 0xe4826151, 0x0002002d, 0x0200001a, 0x007e0219, 0x820d000a, 0x41112069, 0x213e05e5,
-    0x33030135, 0x6dac0111, 0xbbfe4d6d, 0xe9eb4901, 0x5efe7e02, 0x3d989844, 0x57fea901, 0x28822c01, 0xff410030, 0x02fd01f5, 0x00180075, 0x23342500,
-    0xff821323, 0x33360722, 0x2226f283, 0x14333526, 0xa0821617, 0xab012608, 0x011ba99b, 0x11effe5d, 0x76672f34, 0x4f7cc47c, 0x401f1a54, 0x0177cc4e,
-    0x09b54832, 0x6379b85b, 0x07195257, 0x26888251, 0xff330002, 0x820302f4, 0x001522ef, 0x255e821e, 0x15062226, 0x42411714, 0x22232305, 0x59831026,
-    0x06041723, 0x08fd8214, 0x26343536, 0xb411a901, 0x65060561, 0x6076729e, 0x798c8a70, 0xfe086a54, 0x724a4bf7, 0xd6014b4b, 0x35809462, 0x6f535c23,
-    0x01b46bad, 0x4c5eb325, 0x436e47a1, 0x423a3a42, 0xab835482, 0x02c4012c, 0x00060075, 0x01150100, 0xe6820123, 0xe0fec42f, 0xfe2e016a, 0x497502b0,
-    0x2902d4fd, 0x268b824c, 0xff370003, 0x843102f5, 0x001f258b, 0x1300002a, 0x24053f44, 0x07061415, 0x07884117, 0x17363423, 0x268e8406, 0x27272634,
-    0x82171614, 0x823420ab, 0xc94a08b4, 0x84cd7c7d, 0x45114345, 0x8ee5874a, 0x4c3f8c51, 0x305b9b60, 0x292ce62a, 0x524e3c49, 0x3e015482, 0x5c4b6239,
-    0x52344d62, 0x471a060a, 0x665c4c3d, 0x134e3e4d, 0x3c604107, 0x0f2d4a34, 0x10271bd8, 0x5f3b021c, 0x0200393b, 0x83824200, 0x83821220, 0x25001c22,
-    0x3235ad82, 0x15161716, 0x23060714, 0x33352622, 0x37321616, 0x27343536, 0x06784506, 0x77452220, 0x343c0805, 0x5c331a01, 0x2f884821, 0x53786737,
-    0x20684402, 0x610a055b, 0x9876729d, 0x714b4a72, 0x2c80024b, 0xf58d5829, 0x55701745, 0x39134439, 0x512129c8, 0x57566f50, 0x3a42496a, 0x6e47423a,
-    0x0228f782, 0x17003800, 0xba01ae00, 0x20053743, 0x06794336, 0x07860220, 0x21215926, 0x33222233, 0x17200584, 0x21058743, 0x07853201, 0x02000028,
-    0x93ff3900, 0x3b82cd00, 0x13000b22, 0x2309b543, 0x37362707, 0x6d203f87, 0x20080944, 0x44438411, 0x01210a0f, 0x09d7434e, 0x00282408, 0x02980128,
-    0x0006003c, 0x05050100, 0x25352507, 0xe0fe9801, 0xfe342001, 0x023c01c4, 0x3dcccf00, 0x82e845e7, 0x004f266f, 0x01990175, 0x05a74779, 0x21152523,
-    0x2d038335, 0xb6fe9901, 0xb6fe4a01, 0xc04444b9, 0xd3824545, 0x2f000122, 0x9e204f82, 0x13384f85, 0x27051505, 0x01622525, 0x33c4fe3c, 0xe2fe1e01,
-    0x45e83c02, 0xcfcc3de7, 0x1e2ebf83, 0xc501f5ff, 0x19008002, 0x00002300, 0xbf432213, 0x14152405, 0x82060706, 0x15152902, 0x3e343523, 0x03263402,
-    0x0808d646, 0x1175f839, 0xc36c0754, 0x193a3471, 0x4e130a22, 0x3f266e2a, 0x22221a57, 0x20201a1a, 0x4a5c3802, 0x3445605a, 0x160e2045, 0x272f190e,
-    0x3c433f2d, 0xfe334c2d, 0x202f222e, 0x82222f20, 0x24bf8296, 0x034bff43, 0x226f827e, 0x823d000a, 0x233421e9, 0x2a06c441, 0x33141737, 0x36373632,
-    0x82263435, 0x06072912, 0x15331610, 0x26262722, 0x32227d82, 0x8f82021e, 0x2005d846, 0x08068206, 0x36343567, 0x15163233, 0x3b3b3f02, 0x3452375e,
-    0x14274217, 0xa22e132f, 0x2f86528b, 0xd5b9d464, 0x42443f86, 0x8eb6a376, 0x56813864, 0x0305342b, 0x4a283c12, 0x3c5b845f, 0x54210145, 0x3a354a61,
-    0x332d2d2f, 0x5f3d1a1b, 0x2f389a77, 0xb9d6fe64, 0x95367340, 0x3e6f98b2, 0x437e5d36, 0x2224967a, 0x62302610, 0x4887634b, 0x08af8549, 0x00001a34,
-    0x75022502, 0x0a000700, 0x33130000, 0x23272313, 0x33372307, 0xd360f203, 0x36fa3652, 0x68d19e53, 0x8bfd7502, 0x01dea0a0, 0x03000036, 0x00006500,
-    0x2f822902, 0x18000f24, 0x31832000, 0x1423aa82, 0x42160706, 0x232205c6, 0xe2843237, 0x11152322, 0xeb82ee82, 0x65233d08, 0x3b6b63eb, 0x71473b3c,
-    0xeaec3d2a, 0x42443e48, 0x453a9a9b, 0x029a3c43, 0x36475e75, 0x520a0e50, 0x0f297434, 0x30303a45, 0x1701d339, 0x00386439, 0x33000100, 0x3602f5ff,
-    0x16008002, 0x322a0c82, 0x26071716, 0x06222326, 0x51821614, 0x33352d08, 0x26220614, 0x3f013610, 0x55177b65, 0x4f395514, 0x4b5a5d68, 0xeb875557,
-    0x80029691, 0x3b115165, 0x8eeb8445, 0x7463414f, 0xa92e01b4, 0x0021aa82, 0x20048264, 0x20df8456, 0x254d8410, 0x23230610, 0xb6481311, 0x23233505,
-    0xab8e1d01, 0x4fb98eab, 0x7d7c696a, 0x75026a68, 0xabe1feab, 0xd025ee82, 0x896b6b8b, 0x20008200, 0x213f8301, 0x3f82e701, 0xeb820b20, 0x88152121,
-    0x01643201, 0x01ccfe83, 0x01defe22, 0x027dfe34, 0x43d34475, 0x059742d6, 0x00006524, 0x2f82e301, 0x2f890920, 0x6523112b, 0xd1fe7e01, 0xe6fe1a01,
-    0x232a824f, 0xe4fe44d1, 0xe7865a82, 0x7f023b27, 0x00001900, 0x20d68425, 0x87ed8433, 0x352e08eb, 0x11333527, 0x2aea0123, 0x7ea99bf2, 0x4c286f4a,
-    0x6879ae41, 0x9e584858, 0x776c40eb, 0xb02a01b0, 0x511a423c, 0x608ae38e, 0x3406025e, 0x5385c9fe, 0x02217f82, 0x22af8638, 0x82112111, 0x28058240,
-    0x01b41123, 0xfe4f4f35, 0x297f82cb, 0x1501ebfe, 0x1c018bfd, 0x2582e4fe, 0x82000121, 0xb400212f, 0x03200982, 0x2c82af82, 0x824f6521, 0x8bfd2122,
-    0x08244b85, 0x4401f5ff, 0x243f4b85, 0x35272206, 0x35363216, 0x01113311, 0x4f905d44, 0x4f2c7b46, 0x522a5a4f, 0x01393c30, 0x8241febf, 0x214b8430,
-    0x2f854c02, 0x11132508, 0x01013301, 0x15070323, 0x01b51123, 0xedfe6d19, 0xf3662401, 0x7502503e, 0x2301ddfe, 0xa6fee5fe, 0xe3402301, 0x00212b82,
-    0x21378400, 0x0b82cc01, 0x6f470520, 0x33112905, 0xfe1801b4, 0x45454f99, 0x02211f89, 0x240b82eb, 0x1b00000c, 0x2ea48202, 0x03230311, 0xd6112311,
-    0x4f6fd2d4, 0x82db35d8, 0x56fe2db1, 0x8bfdaa01, 0x4afe0502, 0xf4fdbd01, 0x57823684, 0x00006324, 0x8b414802, 0x82012006, 0x012321b8, 0xc1263582,
-    0x584f3801, 0x8983c3fe, 0xf9010722, 0x00223482, 0x308400fe, 0x26055f48, 0x00800254, 0x4214000a, 0x2225072b, 0x36343526, 0x06914117, 0x26342308,
-    0x977a4301, 0x957b7b96, 0x66587b95, 0x67585866, 0xa7800267, 0xa7a5c1fe, 0x47a79f9e, 0x8080f884, 0x728284f8, 0x77830020, 0x77840320, 0x0000112a,
-    0x06141600, 0x23152323, 0x32237f82, 0x82263436, 0x96013a0a, 0x7c686d6d, 0x4341cb4f, 0x027c4143, 0x67b26975, 0xfe7502f3, 0x457342c2, 0x202e82fa,
-    0x21878300, 0x87830259, 0x1f00152b, 0x06050000, 0x27272223, 0x052b4726, 0x2305ab46, 0x01373217, 0x02359288, 0x552c2854, 0x93792f3d, 0x977a7b95,
-    0x1d1f5b6a, 0xfe362b28, 0x339e86ef, 0x43591394, 0x3c01a602, 0x849fa7a7, 0x272c17a1, 0x77021902, 0x6524a789, 0x2b020000, 0x0c20a782, 0x0027ef83,
-    0x23130706, 0x82112303, 0x163222a8, 0x08aa8607, 0x531b0223, 0xa366b451, 0x6adb4f6e, 0x4947e171, 0x018c4347, 0xfe0e6073, 0xfe0101fb, 0x667502ff,
-    0x437145d7, 0x28b383f9, 0xff450001, 0x021802f5, 0x20b18380, 0x05ae4301, 0x16171722, 0x2225fa82, 0x14332726, 0x834e8316, 0x343b08c4, 0x17163236,
-    0x7611b401, 0x2f2a443f, 0x7c4f4383, 0x4d0285d0, 0x31508957, 0x504e6f30, 0x086bca70, 0x375cdc01, 0x2d0f284d, 0x63915017, 0x423e5f69, 0x1030533d,
-    0x8b481a29, 0x854b595d, 0x00062467, 0x82ef0100, 0x000725b3, 0x15211300, 0x232dae83, 0xcde90106, 0x7502cd4f, 0x02cffd44, 0x211e8231, 0x8b825700,
-    0x23823520, 0x23821020, 0x37441120, 0x11230805, 0x06141133, 0x11352622, 0x484858a6, 0xdb824f58, 0xfe750281, 0x4e4e586e, 0xfe920158, 0x7878766e,
-    0x82920176, 0x00012660, 0x02000012, 0x373b8221, 0x1b000006, 0x23033302, 0xb5b46503, 0xde52df53, 0xeffd7502, 0x8bfd1102, 0x27841a82, 0x00000e24,
-    0x93427003, 0x13132108, 0x2d822a83, 0x9b99662c, 0x57b09a35, 0x8e8953de, 0x3382c753, 0xca01f52c, 0x0b0236fe, 0x93018bfd, 0x3b876dfe, 0x63822f20,
-    0x27435120, 0x23212705, 0x13230727, 0x40833303, 0x51022108, 0x60a9b662, 0xb45fdfde, 0xfbd95fa6, 0x013801fb, 0x01fffe3d, 0x00c4fe01, 0x0a000100,
-    0x1b020000, 0x08203382, 0x112a9785, 0x68031123, 0xe25dada9, 0xc882df50, 0x2101df2a, 0xfefe8dfe, 0x73010201, 0x49242b83, 0x17020000, 0x09332b82,
-    0x01370000, 0x15213525, 0x21150501, 0xfe6b0149, 0x82ce0195, 0xfe6b2c03, 0xe3014732, 0xfe474803, 0x8348031d, 0xff652f2f, 0x022b019a, 0x000700db,
-    0x15331300, 0x03821123, 0x77c6652a, 0xdb02c677, 0x464bfd46, 0x7f82ee82, 0xb7ff2d24, 0x974b7801, 0x33132705, 0x4f2d2313, 0x964b50fc, 0x01002705,
-    0x9afff2ff, 0x3f85b800, 0x35231724, 0x03821133, 0x3f83b820, 0x02466624, 0x3b8246b5, 0xf5001528, 0x4a02b201, 0x8f820600, 0x27303c83, 0x3db01507,
-    0x757758b0, 0xfe5501f5, 0x00f6f6ab, 0x37352382, 0x9f0284ff, 0x0300c8ff, 0x21170000, 0x02372115, 0x3898fd68, 0x267b8544, 0x01a50218, 0x835c0324,
-    0x17132c1b, 0xeb392707, 0x5c03f517, 0x82713285, 0x46003de6, 0xdb01f5ff, 0x1800ea01, 0x00002100, 0x22263401, 0x34231506, 0x32333637, 0x23111516,
-    0x2206294e, 0x83151732, 0x14360817, 0x01363233, 0x3f67368d, 0x2a247657, 0x08446459, 0x5d4d732c, 0x47469a67, 0x3a66426a, 0x41360153, 0x6e2c2938,
-    0x5c5a081a, 0x5b50ccfe, 0x1a488056, 0x29261432, 0x8383535a, 0x65000230, 0x1602f5ff, 0x0d00a902, 0x00001700, 0x2f483613, 0x07272806, 0x12331123,
-    0x42150706, 0x270805e2, 0x7ab830b4, 0x4d30597c, 0x4f371216, 0x4f024c4e, 0x01515270, 0xe1895397, 0x542f308b, 0xfbfea902, 0x424e4149, 0x62a4634f,
-    0x3220ef82, 0xcd20b782, 0x1520b782, 0xe2465e82, 0x36322409, 0x4e143335, 0x270805de, 0x0f645901, 0x233a0d50, 0x734d4f40, 0x566b5139, 0x017e7f5b,
-    0x074157ea, 0xa5602f2a, 0x4d313564, 0x86e58a5f, 0x3c000200, 0xec204782, 0x01229787, 0xf4833311, 0x32204085, 0x0805c84a, 0x3435372b, 0x4e9e0126,
-    0x4c170a40, 0x797b5b2d, 0x504f92b9, 0x4e024f70, 0x12019701, 0x2d5057fd, 0x88e18c2e, 0x63a46246, 0x434e3f4b, 0x834f824e, 0x82d72097, 0x00102697,
-    0x25000018, 0x06734f32, 0xf0823420, 0x21073408, 0x26131614, 0x07062223, 0x0a013433, 0x0b510e63, 0x78604e69, 0x0f63c979, 0x7b48b9fe, 0x473d2117,
-    0x5735ff06, 0xe4894f48, 0x4a709c88, 0x0c6a015f, 0x82643e53, 0x00012add, 0x01000031, 0x00b1025b, 0x83078214, 0x15152240, 0x05b94333, 0x35333522,
-    0x173e5982, 0x13214d01, 0x63632823, 0x4e4f4f4e, 0x66022766, 0x482b220d, 0x0158fe36, 0x474936a8, 0x42820d43, 0x00030033, 0x020aff1c, 0x003b0225,
-    0x00340028, 0x3700003e, 0x84398226, 0x17322a04, 0x07333636, 0x15160722, 0x27f78214, 0x15060627, 0x32333314, 0x2108be50, 0x5b4c1417, 0x23232605,
-    0x26000606, 0x081d8222, 0x32331662, 0x2f3c7936, 0x986f3623, 0x3a470735, 0x23045807, 0x2c39536f, 0xba582014, 0xea994e43, 0x531b3386, 0x222171a9,
-    0x013633c1, 0x3e6d3e26, 0x3e36363f, 0x1f3c1d0f, 0x4e30082f, 0x3524604e, 0x2b4a4e40, 0x17634d3c, 0x35191d04, 0x724c3339, 0x362b4257, 0x4937265e,
-    0x02211731, 0x41a4012d, 0x43343441, 0x2b06b742, 0x02000065, 0x00a90207, 0x13000011, 0x21069142, 0x83833411, 0x3339fd82, 0x556f30b4, 0x7a414e5f,
-    0x014f4f4a, 0x61706486, 0x1901e7fe, 0x5b674645, 0x233082e2, 0x5e000200, 0xc622f682, 0xf982b202, 0x3d820b20, 0x23113324, 0xe3522612, 0x4f6a3105,
-    0x1b1b0f4f, 0x011d1d30, 0x0221fedf, 0x1b2d1b4f, 0x2c820282, 0xff020027, 0x000affaa, 0x253382d5, 0x00170009, 0x2f821200, 0x32332508, 0x23061416,
-    0x11353203, 0x07141133, 0x27222306, 0x1b881637, 0x1d18181b, 0x587f181d, 0x221c5a4f, 0x3f04483e, 0xfd354487, 0x23026e00, 0x2089ddfd, 0x2545250a,
-    0x00010000, 0x02000065, 0x828e8214, 0x07372381, 0x44822315, 0x07333738, 0x40f42313, 0x6ee74f4f, 0xfd61e7dc, 0xa902c934, 0xb3c174fe, 0x8082d5fe,
-    0x00212f84, 0x482f82b4, 0xa9220a4b, 0x1a8257fd, 0x0001002b, 0x03000064, 0x00ea0152, 0x20cd821e, 0x20978236, 0x0f104117, 0x22263423, 0x3a648406,
-    0x3e722fb1, 0x7a2d1354, 0x414e5e56, 0x414e437a, 0x4f024a78, 0x68820144, 0x4173363d, 0x642b0725, 0x1901e858, 0x57624645, 0x85de01eb, 0x0602215b,
-    0x67415b82, 0x214e870f, 0x45895f55, 0x3b854287, 0x32000226, 0xf001f5ff, 0x0b263b82, 0x00001300, 0x45423201, 0x35262105, 0x2905f752, 0x36321614,
-    0x7b641101, 0x0382647b, 0x8b48f33e, 0x4c8b464a, 0x7982ea01, 0x78828278, 0x61a58279, 0x6161ab61, 0x65000200, 0x160215ff, 0x15204384, 0x322add83,
-    0x22061416, 0x11231127, 0xcb4f1233, 0x15280805, 0x2faf1614, 0xb87e7dbb, 0xca414f2c, 0x4a745155, 0x95014c02, 0x89e28a55, 0x02dbfe45, 0x605dfec9,
-    0x3e4962a7, 0x00483f5b, 0x33244b82, 0x2c020aff, 0x13224b82, 0x8f831f00, 0x3337172f, 0x16161411, 0x26260717, 0x22063535, 0x08978226, 0x16140622,
-    0x36373233, 0x26343537, 0x2e660801, 0x1d173611, 0x39441a15, 0x7d7ebb29, 0x39565125, 0x010c2352, 0x5a3ba482, 0x31d1fd4e, 0x3d070f21, 0x984a4e12,
-    0x8ae28957, 0x60a76246, 0x5b201749, 0x82004c42, 0x64002158, 0x69240482, 0x0d00e701, 0x22220782, 0xac821507, 0x33361523, 0x36678232, 0x04712801,
-    0x5b244f4f, 0x1e041a1d, 0xe9b29b01, 0x645cdf01, 0x820a4d09, 0x3c002526, 0xd101f5ff, 0x99829b82, 0x32361225, 0x47231716, 0xc5500fe8, 0x274b0805,
-    0x4c352627, 0x0261ac65, 0x3165094d, 0x602c2835, 0xbe6a413d, 0x024c036a, 0x28446845, 0x017d5d2d, 0x374846a4, 0x23332c41, 0x3b13200d, 0x43555367,
-    0x3d2c2d2d, 0x251f0c20, 0x0001005d, 0x01e6ff22, 0x0063025f, 0x25000015, 0x82262706, 0x2311274a, 0x33353335, 0xa3823315, 0x33142308, 0x5f013732,
-    0x15334756, 0x4e4d4d0b, 0x25449696, 0x17280e2e, 0x23193310, 0x853c2601, 0xdbfe3c85, 0x43821249, 0xf7ff5728, 0xdf01f901, 0x43831100, 0x26222326,
-    0x11331135, 0x20083a82, 0x33353736, 0xaa012311, 0x63516e31, 0x5141704f, 0x5f4f4f02, 0x015e5a68, 0x79d6fe30, 0xfef14e64, 0x20e38321, 0x23048212,
-    0x00de01e5, 0x2e08ff47, 0x5991906b, 0x01be57be, 0x0175fede, 0x8222fe8b, 0x8600201a, 0xc0022127, 0x934a0c82, 0x08ff4705, 0x7274642c, 0x4e757142,
-    0x6c6e4d9c, 0x33829f4c, 0x66018326, 0x810196fe, 0x4f223782, 0x3b87b1fe, 0x40821a20, 0x9f82e620, 0x000b2208, 0x27232100, 0x27372307, 0x33371733,
-    0x60e50107, 0xb5608289, 0x838960b5, 0xb5b5b760, 0xb4b4f0ef, 0x246b84f0, 0x010aff05, 0x823c82cb, 0x411720cf, 0x372205fb, 0x72833303, 0x2206063b,
-    0x36310527, 0x11151d28, 0x9158c40e, 0x17b35071, 0x8b3e734b, 0x3b1d2826, 0x257c8431, 0x49c3fd7d, 0x6e82234e, 0x82350021, 0x82a72004, 0x09210843,
-    0x01370000, 0x15213521, 0x21152101, 0xfe190135, 0xfe7201e7, 0xfe1501eb, 0x5e01408e, 0xa2fe4040, 0x38728240, 0x4b000100, 0x550176ff, 0x1f00ec02,
-    0x16130000, 0x16141515, 0x35221533, 0x07a25235, 0x37210982, 0x20118236, 0x28198206, 0x3d349a07, 0x1311d54a, 0x3e028211, 0x4a3b2872, 0x2f01343d,
-    0x515d5819, 0x5cea4555, 0x234c242b, 0x31a85b2c, 0x52554512, 0x821b565c, 0xff652757, 0x02b40086, 0x234400ee, 0xfcee220a, 0x20738598, 0x20738208,
-    0x20738612, 0x216c8426, 0x7a843235, 0x23153323, 0x246a8422, 0x32352306, 0x21198236, 0x738ac337, 0x833a2921, 0x1b333073, 0x55525c56, 0x2c5beb45,
-    0x2b244c23, 0x8230a85c, 0x5d512373, 0x73821958, 0x00353a08, 0x01ce01df, 0x00110067, 0x07221300, 0x32333627, 0x37323316, 0x22230617, 0x9e262726,
-    0x212c1825, 0x1a86224a, 0x232b1928, 0x0e60174e, 0x3b1a0127, 0x39376f17, 0x06246a1b, 0x2a98820e, 0x00140001, 0x02110200, 0x46250080, 0x152c0bbf,
-    0x32330714, 0x06333736, 0x35212306, 0x35240982, 0x33352335, 0x0805bb4f, 0x90011735, 0x392a5610, 0xb725b6b6, 0x54062d31, 0xfe5e5406, 0x23261cbb,
-    0x5b5d5b5b, 0x010b5a47, 0x48404eea, 0x4468386d, 0x4d2c291a, 0x2e2c454d, 0x636d386c, 0x824a4c6d, 0x02002b6a, 0x0b031800, 0x6f032a01, 0xad830900,
-    0x2009c345, 0x06fd4532, 0x1d1d3532, 0x1f1f1717, 0x1e1e9217, 0x031f1f2d, 0x1d2a1d0b, 0xab840288, 0xa5021724, 0x2b492201, 0x07013505, 0x22013727,
-    0x03eb17f4, 0x85327116, 0x1a000300, 0x25020000, 0x07231b82, 0x82000a00, 0x4f1320d9, 0x032309ed, 0x4f270717, 0x63230af1, 0x4ff517eb, 0x012408f5,
-    0x71328548, 0x3f9b5b82, 0x6a821320, 0x86203f8a, 0x3f897482, 0x7d830220, 0x7f880020, 0x83006821, 0x5010207f, 0x37220c6d, 0x418d2707, 0x8132b425,
-    0x88b43282, 0x27b82543, 0x9c276c6c, 0x4a204389, 0x1e204384, 0x2732438c, 0x36270722, 0x16173236, 0x37363216, 0x22060617, 0x928a022e, 0x19204433,
-    0x342e0c20, 0x1a1b2e22, 0x0b230a1c, 0x3c222931, 0x315e8815, 0x331333ee, 0x0c171135, 0x30171b19, 0x081f0c34, 0x2b410400, 0x84432006, 0x00142267,
-    0x20698c1c, 0x085a4726, 0x8a079641, 0x41562068, 0x62880ca1, 0xa941cb20, 0x00022c0c, 0x01000064, 0x005c03e7, 0x500f000b, 0x15270929, 0x13211521,
-    0x50270717, 0x5e230c5d, 0x50f517eb, 0xf54a0661, 0x00002106, 0x33223f8e, 0x01883521, 0x27072523, 0x2d3f8c37, 0x17f44701, 0x43d645eb, 0x71a144d3,
-    0x3b838532, 0x7b826920, 0x6803ec22, 0x11207b82, 0x01227b8d, 0x3d822707, 0xdb506920, 0x7601210b, 0x26068941, 0xd643d344, 0x41cc0245, 0x03200588,
-    0x4320bf86, 0x15224382, 0x458d1d00, 0x8c11b542, 0x4157208f, 0x58850e20, 0x1f41df20, 0x8207200e, 0x031322a3, 0x0507545c, 0x1133132c, 0x07170323,
-    0x4f4f6527, 0x9a42eb3d, 0x050a4105, 0x06000226, 0x11010000, 0x33202787, 0x37202782, 0x2782c182, 0xf482ac20, 0x85750221, 0x21f382f1, 0x2782d9ff,
-    0xf3824020, 0x09000325, 0x82130000, 0x84132027, 0x202982eb, 0x086a42db, 0x0020dd87, 0x04267582, 0x16010000, 0x09824303, 0x15000d22, 0x02203185,
-    0x8210f641, 0x8e44203d, 0x8bfd22cd, 0x23ca8d02, 0x63000200, 0x48228082, 0x79824a03, 0x49821d20, 0x11331123, 0x227f8201, 0x42370111, 0x632811b0,
-    0x583d0150, 0x51c8fe4f, 0x2105ad42, 0xad422f21, 0x00022a0e, 0x750200fe, 0xf90107fe, 0x0fb2428d, 0x332ca982, 0x5402f5ff, 0x0a005c03, 0x18001400,
-    0x2316c150, 0x27071703, 0x2310c550, 0xf517ebbc, 0x2110c950, 0xf7432301, 0x4b578f07, 0x10220745, 0x37550726, 0x07373808, 0x43013727, 0x7b95957b,
-    0x7a97967b, 0x58676758, 0xdd666658, 0x82eb17f4, 0x9e9f2557, 0x3f01a5a7, 0x24072151, 0x853271dd, 0x21008200, 0x57850003, 0xaf846820, 0xaf961a20,
-    0x90051944, 0x415b20b1, 0x7d5105b4, 0x4293200f, 0x0b41059e, 0x844a2008, 0x8228205b, 0x41b3945b, 0xc2901180, 0x89411320, 0xa7802113, 0xc920d28d,
-    0x200f8c41, 0x20db8604, 0x227f8443, 0x9526001e, 0x022e29dd, 0x32333634, 0x23061416, 0x90074844, 0x42c420e8, 0xf08f0d5f, 0x3643a620, 0x0200210c,
-    0x2505fb50, 0x10005c03, 0xfd501400, 0x17372312, 0x01512707, 0xeb8b2308, 0x0551f517, 0x85e72311, 0x47937132, 0x35363225, 0x82112311, 0x262235aa,
-    0x07251135, 0x81573727, 0x584f82db, 0x01584848, 0xeb17f425, 0x46514883, 0x51fe2005, 0x7b430656, 0x20938608, 0x20938268, 0x82939216, 0x884d824b,
-    0xa2012195, 0x5105da41, 0x5720109e, 0x2608db41, 0x02f5ff57, 0x82430335, 0x001a224f, 0x20519222, 0x10a84336, 0x83205d88, 0x900d4e41, 0x416a2064,
-    0x03200d4f, 0x2805f34a, 0x1800db02, 0x25002100, 0x22615000, 0x07170325, 0x50830127, 0xcd231765, 0x50f517eb, 0x02251869, 0x71328556, 0x22738b00,
-    0xa3260022, 0x13372473, 0x97372707, 0x52392674, 0x17f41c02, 0x277597eb, 0xd4013f50, 0x00853271, 0xe7207788, 0x2720eb84, 0x434577a3, 0x27789705,
-    0x324a533a, 0xb4328281, 0x53227997, 0xd241c601, 0x207b8806, 0x227b82c9, 0xa3360022, 0x0337217b, 0x4112bd43, 0x39231677, 0x47ae0252, 0x989712ff,
-    0x013f5023, 0x0fd143c0, 0x04000022, 0x20060b42, 0x24a382c1, 0x002b0021, 0x46a5a333, 0x2d411133, 0x42d52019, 0x9c970c9b, 0xd8015322, 0x280fa342,
-    0x01f5ff33, 0x00e002d8, 0x20998210, 0x1ab5511c, 0x07170325, 0x510b0127, 0x7a2a0eb9, 0x473e2016, 0xebe3ff06, 0xbd51f517, 0x62012110, 0x45050246,
-    0x6386054f, 0x1a001622, 0x2207574d, 0x56263621, 0x36080687, 0x15160237, 0x37363623, 0x01372707, 0x41630e7c, 0x0f470148, 0x7879c963, 0x0b694e60,
-    0x06ff3782, 0x17f4b847, 0x5f578ceb, 0x889c704a, 0x484f89e4, 0x3e531f01, 0x4aef533e, 0x36200597, 0xdb22bf82, 0xbf84ec02, 0xbf9a1e20, 0x5f835d82,
-    0xc18e0e20, 0x24077b52, 0x32828132, 0x20c390b4, 0x076342d2, 0x41000421, 0xc1200527, 0x22226784, 0x699a2a00, 0x4111e149, 0xea201737, 0x900cb441,
-    0x100b487d, 0x00000c26, 0xdb021801, 0x200dd748, 0x05d7486a, 0xfedf0125, 0x45db0221, 0x0b20057f, 0x16202782, 0xd7482787, 0x27278207, 0xeb17f4ac,
-    0x71b6df01, 0x22054347, 0x82deff02, 0x02452227, 0x484f82e7, 0x29820cd7, 0x8405d748, 0x434b2053, 0x25820967, 0x021b0123, 0x1dd748c1, 0xd7483d82,
-    0x2045840d, 0x0d77425d, 0x52000221, 0xc92405df, 0x25001100, 0x22308582, 0x11232707, 0x36363533, 0x11151632, 0x26341133, 0x2d12904b, 0x2f725301,
-    0x024f4409, 0x4e41784a, 0x9243bb5f, 0x68ea3013, 0xeb22fe5c, 0x45466257, 0x1901e7fe, 0x43977061, 0x032e1088, 0xf5ff3300, 0xdb02f101, 0x13000b00,
-    0xb5511700, 0x17032515, 0x12012707, 0x230db951, 0xf517ebf3, 0x250fbd51, 0x32854102, 0xdf420071, 0x48538b06, 0x3523072f, 0x82062634, 0x061427d1,
-    0x07012622, 0x53883727, 0x8b4af22b, 0x468b4c48, 0x17f41301, 0x21548feb, 0xd742fb01, 0x20a78505, 0x20a784e7, 0x45a79519, 0xa98e0641, 0x81322425,
-    0x90b43282, 0x41b12056, 0xaf8807c6, 0x5b84c920, 0xdf482720, 0x20af8a0a, 0x12204513, 0xbe866887, 0xdd484a20, 0x20769012, 0x108241e7, 0x4b430020,
-    0x02f12205, 0x227f84c1, 0x9525001d, 0x12fd44dd, 0xfa20e98e, 0x900c3e43, 0x42c3207a, 0x002b0d72, 0xff570002, 0x03f901f7, 0x52110001, 0xdd510521,
-    0x1703230f, 0xe1512707, 0xebe2230c, 0xe551f517, 0x0103260d, 0x00713285, 0x084b8f00, 0x37320535, 0x23113315, 0x23061415, 0x23113522, 0x13161411,
-    0x01372707, 0x4f316e0b, 0x7042524f, 0xf4f7634f, 0x6809eb17, 0xe9df015f, 0x01796753, 0x5ed0fe2a, 0x43c4025a, 0x97860787, 0x97820d20, 0x75521720,
-    0x06e74113, 0x250b7b52, 0x82813236, 0x9b8db432, 0x41710221, 0x032005e2, 0x02214f85, 0x224f82c1, 0x9323001b, 0x125b4151, 0xe9205d8b, 0x8e0c5841,
-    0x0ec94365, 0x0100002a, 0x00006500, 0xdf01b400, 0x230a9751, 0x21fedf01, 0x1b821482, 0xa301242b, 0x7102b800, 0x00000b00, 0x06875012, 0x36270724,
-    0xf9615837, 0x0d022108, 0x2c0a0466, 0x02180001, 0x037f01a5, 0x00050068, 0x05514e00, 0x847f0121, 0x095f4deb, 0x1700012b, 0x5301cf02, 0x13004a03,
-    0x05935100, 0x200db84f, 0x12974270, 0x42020321, 0x01261187, 0x01013700, 0x6f66a301, 0x01372409, 0x6694fe6c, 0x1b82076f, 0x8a9f0221, 0x6802231b,
-    0x1b8798fd, 0xa2012422, 0x7222d382, 0xd3820c00, 0x82220621, 0x17373ed5, 0x16160706, 0x381fa215, 0x382d2f27, 0x1e170d3e, 0x2e1fc101, 0x1d164745,
-    0x1a022c20, 0x21ca8216, 0x33820f00, 0x7202a224, 0x33820d00, 0x16323632, 0x07061415, 0x26373627, 0x20243526, 0x2c2f2539, 0x1f293483, 0x2c1e5402,
-    0x17472323, 0x8335861e, 0x825c2037, 0x02fc2404, 0x821b0075, 0x214708eb, 0x17162315, 0x06231533, 0x05070607, 0x33352523, 0x23373632, 0x26263335,
-    0x015c2323, 0x0f45b7a0, 0x70075e63, 0x12013728, 0x3df2fe70, 0xeb035457, 0x4c530be7, 0x3175023d, 0x73304324, 0xfa050f2c, 0x394c30f8, 0x82392e30,
-    0x4f002552, 0x99010201, 0x012cdf85, 0x01352115, 0x01b6fe99, 0x00434345, 0x24054756, 0x02e101f5, 0x06475227, 0x30080f59, 0x22233405, 0x32331415,
-    0x7575c5a7, 0x5d0174c5, 0x2c008286, 0x87922702, 0x88919287, 0xd4d48888, 0x092767d3, 0x27671d20, 0x3045370d, 0x34334e40, 0x290be901, 0xbe01e3fd,
-    0x01000220, 0x00004000, 0x6382f501, 0x00001a24, 0x80822137, 0x37363424, 0xbe663637, 0x1432080a, 0x06070706, 0x65018f15, 0x4c4a4cfe, 0x40333567,
-    0x57064974, 0x74bd7405, 0x616f4c4a, 0x50544949, 0x0c191153, 0x2e364e30, 0x61554e2f, 0x1b124984, 0xbb824d16, 0x1c000126, 0xed018eff, 0x24205782,
-    0x22235f82, 0x59362307, 0x2c6705ce, 0x3435220d, 0x082e6727, 0x04014208, 0x1653156e, 0x39745dbf, 0x81483d33, 0x025084cc, 0x59588353, 0x2b3d2a1e,
-    0x01445348, 0x5da15de3, 0x133e334a, 0x523f5f14, 0x4562686a, 0x58364741, 0x343f0b21, 0x00003b62, 0xff180002, 0x02180297, 0x14276722, 0x6d6dab37,
-    0x01bbfe4e, 0x02eff149, 0x4357fe22, 0x013d9f9f, 0x0151feaf, 0x21968233, 0xa3824100, 0x2102fa24, 0xcf581600, 0x06142406, 0x5e352622, 0x366706e9,
-    0xbb230805, 0x7869302e, 0x4d75be86, 0x51587e46, 0x011ca24f, 0x01f0fe59, 0xbc6a0a28, 0x3959647e, 0x487f543c, 0x82473001, 0x678382ee, 0xff256423,
-    0x02c4019e, 0x0d236727, 0x0161d42d, 0x02a7fe3a, 0xbafd4327, 0x67464302, 0x8e228a23, 0xab821202, 0x23001a2b, 0x32010000, 0x10161716, 0x13216706,
-    0xf9691720, 0x343c0805, 0x351e0126, 0x8242205d, 0x53765d77, 0x1f694102, 0x5e08055d, 0x5f76779d, 0x7548473c, 0x2702484a, 0xfe592c33, 0x566fb5d4,
-    0x39144439, 0x4d232dcb, 0x57567055, 0x7545466e, 0x45704a45, 0x0025f482, 0x000e0116, 0x82088301, 0x82782003, 0x240b8503, 0x00050001, 0x24178678,
-    0x00070002, 0x240b867d, 0x002a0003, 0x200b8684, 0x24238a04, 0x000d0005, 0x201786ae, 0x200b8206, 0x240b86bb, 0x00100009, 0x240b86c8, 0x000e000c,
-    0x240b86d8, 0x004c000d, 0x2a0b86e6, 0x011a000e, 0x00030032, 0x82090401, 0x01f0227f, 0x240b864c, 0x020a0001, 0x240b863c, 0x020e0002, 0x240b8646,
-    0x02540003, 0x200b8654, 0x24238a04, 0x021a0005, 0x201786a8, 0x200b8206, 0x240b86c2, 0x02200009, 0x240b86dc, 0x021c000c, 0x240b86fc, 0x0398000d,
-    0x080b8618, 0x34000e2b, 0x6f43b003, 0x69727970, 0x20746867, 0x20296328, 0x31313032, 0x6f4a202c, 0x6874616e, 0x50206e61, 0x6f686e69, 0x28206e72,
-    0x08088570, 0x79742e3b, 0x65646570, 0x6e676973, 0x616d6740, 0x632e6c69, 0x2c296d6f, 0x74697720, 0x65522068, 0x76726573, 0x46206465, 0x20746e6f,
-    0x656d614e, 0x4b222073, 0x616c7261, 0x6e612022, 0x270b8664, 0x6d615420, 0x2e226c69, 0x52261884, 0x6c756765, 0x30837261, 0x726f462b, 0x32206567,
-    0x3a20302e, 0x821b8420, 0x821c844f, 0x3331250f, 0x2d30312d, 0x562c9b83, 0x69737265, 0x31206e6f, 0x3030302e, 0x2d202684, 0xb38f4386, 0x6e6f6a22,
-    0xa382b487, 0x69685423, 0x28978573, 0x74666f53, 0x65726177, 0x3a108220, 0x6563696c, 0x6465736e, 0x646e7520, 0x74207265, 0x53206568, 0x4f204c49,
-    0x856e6570, 0x854c202c, 0x202c2120, 0x31347789, 0x7474682e, 0x2f2f3a70, 0x69726373, 0x2e737470, 0x2e6c6973, 0x2f3dbb82, 0x004c464f, 0x006f0043,
-    0x00790070, 0x00690072, 0x00680067, 0x00200074, 0x00630028, 0x24078229, 0x00300032, 0x20018231, 0x200b822c, 0x2227824a, 0x8261006e, 0x8268201f,
-    0x826e2005, 0x82502011, 0x826e2031, 0x826f2031, 0x200f833b, 0x21478228, 0x11890069, 0x2b822e20, 0x13827920, 0x64006526, 0x73006500, 0x6e225f84,
-    0x65824000, 0x41826d20, 0x6c006924, 0x67822e00, 0x6d006f22, 0x61836b82, 0x21827720, 0x4f827420, 0x52002022, 0x65202f84, 0x76205782, 0x64200982,
-    0x46206b82, 0x74207d84, 0x4e200982, 0x6d203b82, 0x20241f84, 0x4b002200, 0x72200d82, 0x61204982, 0x20200b82, 0x2d839784, 0x2022178b, 0x31845400,
-    0x25826920, 0x71822220, 0x65833189, 0x75006722, 0x72213d84, 0x83618700, 0x82722007, 0x826520a3, 0x8232206b, 0x8230202f, 0x823a2007, 0x85378903,
-    0x2139899f, 0x1f830020, 0x33003128, 0x31002d00, 0x05823000, 0x20073741, 0x20a78256, 0x22f98472, 0x826e006f, 0x84312043, 0x8230204f, 0x204d8923,
-    0x89ed842d, 0x1f67414d, 0x83006a21, 0x4170204b, 0x47410c7b, 0x00542207, 0x20178268, 0x0c2f4173, 0x2f825320, 0x74006628, 0x61007700, 0x8f827200,
-    0x21862020, 0x07826c20, 0x0f826320, 0x9f826e20, 0x64006522, 0x75203382, 0x6420a382, 0x2020b184, 0x68202f82, 0x53242b84, 0x4c004900, 0x4f221b82,
-    0x2b847000, 0x27412020, 0x82202008, 0x00692117, 0x2c204189, 0xef932582, 0x6820f383, 0x74204f82, 0x3a224182, 0x01822f00, 0x35827320, 0x7d827220,
-    0x15827020, 0x2e007322, 0x0b427f82, 0x826f2005, 0x8267209f, 0x824f201f, 0x004c2263, 0x07917500, 0x00b5ff24, 0x00930032, 0x1482a720, 0x25820120,
-    0x00033808, 0x00050004, 0x00070006, 0x00090008, 0x000b000a, 0x000d000c, 0x000f000e, 0x00110010, 0x00130012, 0x00150014, 0x00170016, 0x00190018,
-    0x001b001a, 0x001d001c, 0x821f001e, 0x00213ab1, 0x00230022, 0x00250024, 0x00270026, 0x00290028, 0x002b002a, 0x002d002c, 0x2289822e, 0x82310030,
-    0x3324087b, 0x35003400, 0x37003600, 0x39003800, 0x3b003a00, 0x3d003c00, 0x3f003e00, 0x41004000, 0x43004200, 0x45004400, 0xdc08b382, 0x00480047,
-    0x004a0049, 0x004c004b, 0x004e004d, 0x0050004f, 0x00520051, 0x00540053, 0x00560055, 0x00580057, 0x005a0059, 0x005c005b, 0x005e005d, 0x0060005f,
-    0x00850061, 0x008d008e, 0x00c900ad, 0x00ae00c7, 0x00cb0062, 0x00c80065, 0x00cf00ca, 0x00cd00cc, 0x006600ce, 0x00d000d3, 0x00af00d1, 0x00d60067,
-    0x00d500d4, 0x006a0068, 0x006b0069, 0x006c006d, 0x00700071, 0x00730072, 0x00740075, 0x00770076, 0x007a0078, 0x007b0079, 0x007c007d, 0x007e007f,
-    0x00810080, 0x000201d7, 0x00d900d8, 0x00b300b2, 0x01b700b6, 0x01ef0003, 0x01050104, 0x01070106, 0x01090108, 0x010b010a, 0x0a0d010c, 0x736f7061,
-    0x706f7274, 0x720b6568, 0x65657075, 0x626d7973, 0x7a0c6c6f, 0x2e6f7265, 0x26178270, 0x0b646c6f, 0x88656e6f, 0x7774210b, 0x0d241788, 0x65726874,
-    0x0c241988, 0x72756f66, 0x0c232687, 0x88766966, 0x730b2319, 0x18877869, 0x65730d25, 0x886e6576, 0x6965240d, 0x88746867, 0x696e2134, 0x00206889,
-    0x01260082, 0xffff0100, 0x09840f00, 0xc9230482, 0x82316f89, 0xca002406, 0x84301d15, 0x9bba2407, 0x82010070, 0x820c2009, 0x00162403, 0x8202001e,
-    0x0001220d, 0x200582a6, 0x83118204, 0x84022019, 0x840c821f, 0x820a2007, 0x002c2a23, 0x74616c01, 0x0008006e, 0x82168304, 0x8201205f, 0x6b012307,
-    0x13837265, 0x84000021, 0x211b820d, 0x0b830002, 0x01000824, 0x0d825200, 0x00004a08, 0x00980024, 0x01c000ba, 0x01280106, 0x013c0136, 0x01480142,
-    0x02d8019e, 0x0214020e, 0x02940282, 0x02b002a2, 0x02d802be, 0x02ec02e2, 0x030003f2, 0x0314030a, 0x03300326, 0x034c033e, 0x036c0366, 0x038c0376,
-    0x03a8039e, 0x20a582be, 0x204d820b, 0x265f8224, 0x00270027, 0x82290001, 0x00022201, 0x2401822f, 0x00320003, 0x086d8234, 0x37003622, 0x39000700,
-    0x09003c00, 0x46004400, 0x48000d00, 0x10004b00, 0x4e004d00, 0x50001400, 0x16005d00, 0x3728bf82, 0x3900d8ff, 0x3a00e4ff, 0x3c300382, 0x4900e6ff,
-    0x5900f4ff, 0x5a00eaff, 0x5c00e8ff, 0x012a1382, 0xe7ff3c00, 0x24001100, 0x2382c7ff, 0x3b00f824, 0x1182f0ff, 0x4400f822, 0x46201f82, 0x47201f82,
-    0x48200782, 0x4a240782, 0x5200d3ff, 0x54200782, 0x58200382, 0x59221382, 0x4382e0ff, 0x5b00dc22, 0x47830f82, 0x13825d20, 0x2d000822, 0x37227f82,
-    0x7182cfff, 0x4d82d320, 0x4982d720, 0x6d82bb20, 0x6d86e820, 0x0300ec22, 0xf8221982, 0x83823b00, 0x67823c20, 0x75820120, 0xdb82da20, 0x9d830b85,
-    0x11821520, 0x2d00d824, 0x7f82bbff, 0x4600a92a, 0x4700b5ff, 0x4800abff, 0x49280782, 0x4a00cbff, 0x5000a9ff, 0x51201b82, 0x52240382, 0x5300b1ff,
-    0x54200782, 0x55281b82, 0x5600b7ff, 0x58009fff, 0x59200f82, 0x5a200b82, 0x5b22f382, 0xdf82c7ff, 0x5d00ce22, 0x0e203782, 0xdf245582, 0xf8ff2600,
-    0x32205984, 0x44220782, 0x5d82dfff, 0x5d82df20, 0x5d82df20, 0x4900df22, 0x4a223182, 0xe182cfff, 0x5400df28, 0x5500e3ff, 0x5182efff, 0x0d00df22,
-    0x8f853984, 0xdf20319b, 0xdf203182, 0xd8203182, 0xe4208382, 0x3220d182, 0x1b20e182, 0xbb203b82, 0xef227582, 0x79842b00, 0x3200ae22, 0x3420f382,
-    0x36220382, 0xdf82e4ff, 0x8182c320, 0x8182bf20, 0x8182bf20, 0x8182bf20, 0xdf82bf20, 0xdf82b320, 0x5100bf24, 0x8982bfff, 0xdf82bf20, 0x8d82bf20,
-    0x5b82bf20, 0x5b82bf20, 0x5700bf24, 0x5f82dbff, 0x5900bd26, 0x5a00d3ff, 0x5b200382, 0x5c20db82, 0x5d20e782, 0x04262f82, 0xa7ff3700, 0x21823900,
-    0x2205e941, 0x820300cb, 0x82ec2011, 0x00e32211, 0x83cd823c, 0x82c3200d, 0x82e4200d, 0x84df200d, 0x200d831b, 0x220d82e8, 0x820600d7, 0x00f022a9,
-    0x204d822d, 0x249d8246, 0x00e6ff4a, 0x2c07824d, 0x00e8ff56, 0x004d0002, 0x005c0049, 0x20098210, 0x20c58237, 0x2075823c, 0x20ab8201, 0x204182ea,
-    0x20238249, 0x2013824d, 0x2007825c, 0x206b8202, 0x834b84dc, 0x84d42009, 0x82042009, 0x82b92013, 0x00df2471, 0x82dfff3a, 0x84bf2011, 0x82cb2043,
-    0x84dc2009, 0x82b7207f, 0x82d12009, 0x8251205f, 0xff2d220d, 0x262d82d8, 0xff4a00d0, 0x860600ec, 0x82e420c9, 0x82dc2037, 0x82c72023, 0x00e4226f,
-    0x2019825c, 0x200d8201, 0x204584db, 0x220982c7, 0x820500cf, 0x84e820b7, 0xff3722b7, 0x201182c4, 0x223f82d3, 0x820400f8, 0x82e42015, 0x82d72015,
-    0x82e02047, 0x84e02015, 0x88d72031, 0x82f42031, 0x82e8201b, 0x82c8201b, 0x84e42011, 0x41b38331, 0x01230509, 0x43000000, 0x6f251aff, 0x006d756e,
-    0x06354408, 0x69820120, 0x24050744, 0x00020008, 0x8237821a, 0x30029018, 0x00010002, 0x001c0013, 0x00000000, 0x00000001, 0xdefa0500, 0x0085a6b8,
-};
-
-// File: 'Cousine-Regular.ttf' (43912 bytes)
-// Exported using binary_to_compressed_c
-static const unsigned int cousine_compressed_size = 37630;
-static const unsigned int cousine_compressed_data[37632/4] =
-{
-    0x0000bc57, 0x00000000, 0x88ab0000, 0x00000400, 0x00010025, 0x82110000, 0x00042604, 0x49534410, 0x820d8247, 0x44ab210c, 0x082c0782, 0x4d544646,
-    0xc867e44e, 0x6cab0000, 0x1c280f82, 0x46454447, 0x04000501, 0x4c200f82, 0x202c0f82, 0x322f534f, 0x4f9e26f9, 0x98010000, 0x603c0f82, 0x70616d63,
-    0x9fad085d, 0xb0030000, 0x7a020000, 0x20747663, 0xb55e164d, 0xa0110000, 0x3c270f82, 0x6d677066, 0x8223d373, 0x2c062d1b, 0x05070000, 0x70736167,
-    0x09001800, 0x34204f82, 0x10383f82, 0x66796c67, 0x7f5d5439, 0x90150000, 0x44890000, 0x64616568, 0x88a5ddf6, 0x1c205f82, 0x36211f82, 0x23108268,
-    0x6202780b, 0x54200f82, 0x24280f82, 0x78746d68, 0xca460a4f, 0xf8200f82, 0xb82c0382, 0x61636f6c, 0xd24d1a6c, 0xdc130000, 0xb2280f82, 0x7078616d,
-    0x67027c04, 0x78200b82, 0x32082f82, 0x6d616e20, 0x38e51165, 0x9e0000f9, 0x0a0000d4, 0x736f7032, 0xff7cec74, 0xa90000c7, 0x02000008, 0x6572702a,
-    0xf798d970, 0x0d000094, 0x04000034, 0x8201006a, 0x2b038235, 0xa51633bd, 0xf53c0f5f, 0x00081f00, 0xc9230083, 0x87d52d6f, 0xf6ff2707, 0xd60439fe,
-    0x0f82a806, 0x02000822, 0x02830582, 0x062d3382, 0x0099fda9, 0xffcd0400, 0x04f7fff6, 0x834984d6, 0x20038719, 0x28118404, 0x007900d8, 0x006a0005,
-    0x2c398204, 0x002f0010, 0x0300005a, 0x0052012d, 0x241d8203, 0x01cd0403, 0x281d8290, 0x059a0508, 0x01000033, 0x3a07851d, 0x66006103, 0x05081202,
-    0x09040702, 0x02050202, 0x00a00404, 0x0040af02, 0x8600fb78, 0x41313f00, 0x40004353, 0x19222000, 0x7efee704, 0xa9062602, 0x00606702, 0xd7df9f00,
-    0x3a040000, 0x26824505, 0x01002026, 0x4400cd04, 0xa1820982, 0x03840020, 0x01030227, 0x00360015, 0x3c138242, 0x01f6012b, 0x00500156, 0x017400f8,
-    0x014e0103, 0x007200f0, 0x0094007c, 0x00800090, 0x2c038267, 0x009e0097, 0x018d0085, 0x006001f0, 0x22018474, 0x822c005e, 0x00a22437, 0x82a20071,
-    0x84c22001, 0x00ca2207, 0x220b82b0, 0x828100ed, 0x86662005, 0x004f2603, 0x008e004c, 0x302b820a, 0x00240024, 0x009a0149, 0x000e0173, 0x01fbff85,
-    0x24578292, 0x008200b3, 0x2459828a, 0x008f008a, 0x270382b9, 0x00ec0075, 0x00630086, 0xb3201783, 0xf2241982, 0xbe00a700, 0x45241982, 0x5e001500,
-    0x9324a982, 0x1302e300, 0x6c221382, 0x35820302, 0x95823820, 0x0f823420, 0x4f019f28, 0xce001f00, 0x99827f00, 0x59821f20, 0xc5824720, 0x32013822,
-    0x90226182, 0xcb827f00, 0x1d01772e, 0x6b00e200, 0x11001b00, 0x99000b00, 0x02898b82, 0xb9840120, 0xa222c383, 0x0186ca00, 0xbb841b20, 0x85006621,
-    0x009d2401, 0x868e0038, 0x82242001, 0x828e2019, 0x888020b7, 0x82142003, 0x828520c1, 0x2003838b, 0x83c1828f, 0x847d2003, 0x828220bf, 0x22038319,
-    0x826e0074, 0x84b920c1, 0x82422003, 0x82422005, 0x142c0825, 0x1b011c00, 0xff007401, 0xf6ffaa00, 0x8f018d01, 0xb1005d01, 0xb200b200, 0x5a015001,
-    0xcc006e01, 0xf0015b00, 0xfa002501, 0xc500ea00, 0x0320ac82, 0x1c220386, 0x09820100, 0x39820020, 0x09840320, 0x04001c24, 0x11825801, 0x00222808,
-    0x00040020, 0x007e0002, 0x013101ff, 0x02c60253, 0x20dc02da, 0x201a2014, 0x2022201e, 0x2044203a, 0x221522ac, 0x82ffff19, 0x0020222b, 0x202382a0,
-    0x24238652, 0x20182013, 0x2023821c, 0x3f238939, 0x0000e3ff, 0x6fff8fff, 0xeafdfdfd, 0xb3e0e9fd, 0xafe0b0e0, 0x96e0ace0, 0x26e08de0, 0xbadebcde,
-    0x20207984, 0x029b4982, 0x0003c308, 0x00630062, 0x00650064, 0x00670066, 0x00690068, 0x006b006a, 0x006d006c, 0x006e0010, 0x0070006f, 0x00720071,
-    0x00740073, 0x00760075, 0x00780077, 0x007a0079, 0x007c007b, 0x007e007d, 0x0080007f, 0x00820081, 0x00840083, 0x00860085, 0x00880087, 0x008a0089,
-    0x008c008b, 0x008e008d, 0x0090008f, 0x00920091, 0x00940093, 0x00960095, 0x00980097, 0x009a0099, 0x009c009b, 0x009e009d, 0x00a0009f, 0x00a200a1,
-    0x00a400a3, 0x00a600a5, 0x00a800a7, 0x00aa00a9, 0x00ac00ab, 0x00ae00ad, 0x00b000af, 0x00b200b1, 0x00b400b3, 0x00b600b5, 0x00b800b7, 0x00ba00b9,
-    0x00bc00bb, 0x00be00bd, 0x010000bf, 0xe8840006, 0x0121e483, 0x21058202, 0x008d0002, 0x00019808, 0x05040300, 0x09080706, 0x0d0c0b0a, 0x11100f0e,
-    0x15141312, 0x19181716, 0x1d1c1b1a, 0x21201f1e, 0x25242322, 0x29282726, 0x2d2c2b2a, 0x31302f2e, 0x35343332, 0x39383736, 0x3d3c3b3a, 0x41403f3e,
-    0x45444342, 0x49484746, 0x4d4c4b4a, 0x51504f4e, 0x55545352, 0x59585756, 0x5d5c5b5a, 0x61605f5e, 0x87858400, 0x9c969189, 0xa4a2a0a1, 0xa9a7a5a3,
-    0xadabaaa8, 0xb1afaeac, 0xb6b4b2b3, 0xbbb9bab5, 0x637000bc, 0x76ce6864, 0x006a6e9f, 0x86006974, 0x00710098, 0x84756600, 0x7a6b27a6, 0x7fb8a600,
-    0x0c836d62, 0x007b6c2f, 0x95838003, 0xc7c6c2c1, 0xc9c8cccb, 0x23de82b7, 0xd0cfd2d1, 0x773b1a82, 0x8200cdca, 0x888b818a, 0x8c8f8e8d, 0x92009493,
-    0xc0999b9a, 0x006fc5c3, 0x8278c400, 0x0058081e, 0x59454000, 0x53545558, 0x4f505152, 0x4b4c4d4e, 0x4748494a, 0x43444546, 0x3f404142, 0x3b3c3d3e,
-    0x3738393a, 0x30313536, 0x2c2d2e2f, 0x25262728, 0x21222324, 0x1114181f, 0x0d0e0f10, 0x08090a0b, 0x04050607, 0x00010203, 0x4623452c, 0x26b02060,
-    0x2604b060, 0x2d484823, 0x23210f83, 0x20108261, 0x22108a61, 0x8220b060, 0x8d462012, 0x20b02123, 0x61203783, 0x298c1a82, 0x29824020, 0x298e6620,
-    0x29854020, 0x53884020, 0x20100135, 0x2d3c003c, 0x2345202c, 0x44cdb020, 0x01b82023, 0x8258515a, 0x448d260b, 0xb0205923, 0x200b84ed, 0x210b844d,
-    0x0c842604, 0x0c820d20, 0x82212121, 0x20230831, 0x44681845, 0x6001b020, 0x46b04520, 0x458a6876, 0x2c2d4460, 0x0a0bb101, 0x65432343, 0x002c2d0a,
-    0x820b0ab1, 0x820b200a, 0x28b02809, 0x01b17023, 0x84013e28, 0x28022808, 0x02b13a45, 0x820d0800, 0xb0453644, 0x61452503, 0x5150b064, 0x1b444558,
-    0x2d592121, 0x0eb0492c, 0x82498223, 0x43002155, 0xb0245284, 0x07b04306, 0x20225284, 0xba82b069, 0x208b0037, 0x8ac02cb1, 0x0010b88c, 0x0c2b6062,
-    0x61642364, 0x03b0585c, 0x3c3b8261, 0x8a45038a, 0x11b0878a, 0x2329b02b, 0x7a29b044, 0x2c2d18e4, 0x2cb06545, 0xb0454423, 0x2155832b, 0x6788524b,
-    0x72894b20, 0x05b00129, 0x20231025, 0x8200f58a, 0xed2322ce, 0x8ac782ec, 0x86612011, 0x25062411, 0x8300f510, 0x4624081c, 0x8a604623, 0x2023468a,
-    0x8a608a46, 0x80ffb861, 0x10202362, 0x0cb18a23, 0x45708a0c, 0x00b02060, 0x01b05850, 0xba2c1782, 0x46b01b8b, 0x10b0598c, 0x3a016860, 0x462eec86,
-    0x13b04b52, 0xb0585b51, 0x20462502, 0xfe826168, 0x3f260282, 0x1b382123, 0xc0821121, 0x0322f582, 0x3f824625, 0x002b1e95, 0xb04307b0, 0x2d0b4306,
-    0x8321212c, 0xb88b24f8, 0x82620040, 0x80b0230c, 0x0f855851, 0x6200202c, 0x4000b21b, 0xb0592b2f, 0x19836002, 0x1987c020, 0x83551521, 0x87802019,
-    0x083e8819, 0x2123602d, 0x534b2c2d, 0x04b08a58, 0x23644925, 0x40b06945, 0x80b0618b, 0x6120b062, 0x230eb06a, 0xb0102344, 0x211bf60e, 0x11128a23,
-    0x822f3920, 0x202b82a3, 0x28b48220, 0x20696449, 0xb02605b0, 0x8b358306, 0x04b02230, 0x20328326, 0x2104828a, 0x3b824423, 0xb0234483, 0x821bed0e,
-    0x11262560, 0x23392012, 0x47834682, 0x45234523, 0x22028660, 0x82186876, 0x2d203071, 0x2b48b02c, 0x45202c2d, 0x585400b0, 0x824440b0, 0x61402108,
-    0x23061642, 0x2f30b145, 0x61263182, 0x6001b060, 0xb1824469, 0xb0585129, 0xb070232f, 0x42422314, 0x4b220537, 0x96835851, 0x53694523, 0x85328458,
-    0xb0452715, 0x00b04314, 0x35866360, 0x452fb022, 0x45253b82, 0x8a452023, 0x20088460, 0x33068345, 0x5851234b, 0xff3300b9, 0x2034b1e0, 0x0033b31b,
-    0x44590034, 0x2c081d82, 0x584316b0, 0x452603b0, 0x6664588a, 0x1b601fb0, 0x6020b064, 0x1b582066, 0x5940b021, 0x596101b0, 0x59655823, 0x442329b0,
-    0x29b01023, 0x236e82e0, 0x59212121, 0x022bc282, 0x4b585443, 0x514b2353, 0x8238585a, 0x84592015, 0x83188319, 0x2504224e, 0x22468e45, 0x851b5823,
-    0x05b03046, 0x2508b025, 0x02582008, 0xb059031b, 0x82102504, 0x46202110, 0x23220882, 0x05823c42, 0x2507b023, 0x23038208, 0x2506b010, 0xd1821584,
-    0x20241882, 0x001b0158, 0x86822d87, 0x2029b025, 0x86446545, 0x8c0f8327, 0x230c8254, 0x48432503, 0x06244d87, 0x2503b025, 0x43244782, 0x59211b48,
-    0x0283bd82, 0x022c2d22, 0x20201e82, 0x23216284, 0x20828242, 0x21238208, 0x1a874845, 0x20250322, 0x08221e82, 0x468202b0, 0x24081382, 0x23452c2d,
-    0x20184520, 0x205000b0, 0x23652358, 0x20682359, 0x585040b0, 0x5940b021, 0x59655823, 0x2d44608a, 0x060c412c, 0x82452021, 0x0595410d, 0x58544b22,
-    0x2c410d8b, 0x2c2d240a, 0x822100b0, 0x8538201e, 0x02b02728, 0xb0585443, 0x43412b46, 0x200f8408, 0x410f8447, 0xb021076b, 0x201e8e48, 0x820f8449,
-    0x8a202b1e, 0x534b2308, 0x5a514b8a, 0x50862358, 0xb9820020, 0x00b04924, 0xa6825853, 0x82113821, 0x2c2d2ef6, 0x46234601, 0x61462360, 0x20102023,
-    0x05cf4346, 0x40b18a35, 0x45708a40, 0x2d3a6860, 0x238a202c, 0x238a6449, 0x843c5853, 0x524b262d, 0x7a1b7d58, 0x08a78259, 0x4b00122a, 0x42544b01,
-    0x02b12c2d, 0x23b14200, 0xb1518801, 0x53880140, 0x10b9585a, 0x88200000, 0x02b25854, 0x60430201, 0x24b15942, 0x58251b82, 0x000020b9, 0x20158440,
-    0x83158302, 0x20228314, 0x830c8320, 0x82522049, 0x8408202f, 0xb91b252f, 0x80000040, 0x04202a84, 0x0f841084, 0x01b86323, 0x85138400, 0x24138224,
-    0xb8630001, 0x20138502, 0x20278710, 0x20138202, 0x20138504, 0x20138440, 0x38008259, 0x18452c2d, 0x514b2368, 0x45202358, 0x40b06420, 0x597c5850,
-    0x59608a68, 0x24c58244, 0x02b01600, 0x37028225, 0x2301b001, 0x02b0003e, 0x01b13e23, 0xb00c0602, 0x4265230a, 0x42230bb0, 0x3f201783, 0x3f201783,
-    0x06201785, 0x07311783, 0x01b04223, 0x2c2d0116, 0x45108a7a, 0x2d18f523, 0x08db8200, 0x03096485, 0xf501fd04, 0xf21f2850, 0xf11f2846, 0xf01f2a46,
-    0x8b1f3546, 0xabee9bee, 0xef6b03ee, 0xbb02ef8b, 0xefa401ef, 0x5bef1b01, 0x03ef6bef, 0xec44ec04, 0x46eb0a02, 0xe4e71fff, 0xe4e61f26, 0xe4e51f3d,
-    0xe2e31f1e, 0xe20b1f46, 0x46e24001, 0xe0e11f16, 0xe0bb1f46, 0xe0dbe0cb, 0x33e04003, 0x46e04636, 0x01bc1f18, 0x013e0014, 0x01550012, 0x3d0c4013,
-    0x3ddf5503, 0x3dde55dd, 0x41bb55dc, 0x00160109, 0x82540001, 0x82642005, 0xff023103, 0xb31601c0, 0x2046160c, 0xb21601b8, 0xbc000201, 0x10201482,
-    0xcf080382, 0xb2150102, 0xb81f3ddc, 0x63401101, 0x101fff03, 0x40dd20dd, 0x80dd50dd, 0x06ddb0dd, 0xdc50dc20, 0xdcb0dc80, 0x01dc0f04, 0x1f3315d0,
-    0xc86fc85f, 0x5f03c87f, 0x7fc36fc3, 0xc2bf03c3, 0x2650c101, 0x01be701f, 0xbe30be20, 0x7003bec0, 0x02be80be, 0xbc1fbc0f, 0x3fbc2f02, 0xafbc6fbc,
-    0x05bcdfbc, 0x1f26adb9, 0xb830b820, 0xb870b850, 0xb805b880, 0x1c40c0ff, 0x462913b8, 0x2001b710, 0x80b750b7, 0x04b7b0b7, 0xb5b0b580, 0x3fb30f02,
-    0x03b3efb3, 0x400d01b8, 0x1f48aa2b, 0xb090b080, 0xc0b0b002, 0x03b0d0b0, 0xaf3faf2f, 0xb0ada002, 0xadc002ad, 0x2f02add0, 0x02ac3fac, 0xc001ab9f,
-    0x02aad0aa, 0x0f010f41, 0x0e013200, 0x00005500, 0x10000e01, 0x20200382, 0x70200382, 0x043b0382, 0x10010f00, 0x50011540, 0x709c609c, 0x9699039c,
-    0x46981f26, 0x97301f26, 0x82029740, 0x96b32487, 0x82461c16, 0x2a403907, 0x46110e96, 0x1fff1b95, 0x94af940f, 0x400394bf, 0x46311d94, 0x1b169440,
-    0x37080482, 0x0f460f0c, 0x3f932f93, 0xef937f93, 0xba0f0593, 0x6f000c01, 0x20400c01, 0x268d9202, 0xff53911f, 0x0190df1f, 0x1f019030, 0x02902f90,
-    0x907f906f, 0x108f0002, 0x038f208f, 0x25085783, 0x1c188f20, 0x308e2046, 0x8d4f028e, 0x8d6f8d5f, 0x018c3003, 0x8c1f8c0f, 0x40038c2f, 0x4613108c,
-    0x0b01bf10, 0x03822000, 0x03823020, 0xc0ff0329, 0x17b20b01, 0x83b94620, 0x40360808, 0x46141050, 0x1f26828b, 0x1f3c4a89, 0x1f3d8788, 0x1f3c8487,
-    0x1fff4a86, 0x1001859f, 0x30842084, 0x83300384, 0x01827f01, 0x0c098240, 0x26507346, 0x35466f1f, 0x03826e1f, 0x18011a30, 0x18331955, 0x03330755,
-    0xff030655, 0x1b82601f, 0x03825f20, 0xe0ffb927, 0x1fb20701, 0x825f8226, 0x1f402d08, 0x5e461c13, 0x5c1f485a, 0x5b1f3146, 0x5a200782, 0x133f0782,
-    0x05551232, 0x04550301, 0xb8550332, 0x1bb50801, 0x030f1f3c, 0x1901b901, 0x35b21801, 0x82b8401f, 0x28172706, 0x0a01b846, 0x50822540, 0x50522c08,
-    0x51ef1f1b, 0x400251ff, 0x46383551, 0x28255140, 0x0150cf46, 0x4c014cdf, 0x4b1f1d46, 0x501f4846, 0x401b01b8, 0x464a015a, 0x82491f26, 0x82482098,
-    0x82472003, 0xaf370803, 0x46df0146, 0x800246ef, 0x32160146, 0x01115515, 0x3210550f, 0x0102550f, 0x00015500, 0x0f1f1f01, 0x0f5f0f3f, 0x0f040f7f,
-    0x4f0f2f0f, 0x8f0f6f0f, 0xff0fdf0f, 0x823f070f, 0xef250813, 0x006f030f, 0x01004f01, 0x050116a0, 0x9001b801, 0x2b5354b1, 0x07b84b2b, 0xb04b52ff,
-    0xb05b5009, 0x25b08801, 0x08058353, 0x5a514022, 0xb08806b0, 0x5b5a5500, 0x0101b158, 0x8d85598e, 0x1d42008d, 0x5332b04b, 0x1d60b058, 0x64b04b59,
-    0x40200882, 0x80200883, 0x102c0882, 0x0016b11d, 0x74735942, 0x2b757473, 0x01200083, 0x73280886, 0x742b2b00, 0x732b2b74, 0x04841483, 0x09820120,
-    0x25841482, 0x822b2b21, 0x8200200d, 0x74732204, 0x821c8474, 0x82318215, 0x2b74220d, 0x21058475, 0x1783732b, 0x22827320, 0x00204283, 0x2b246082,
-    0x74737301, 0x6a820882, 0x01732b23, 0x82098273, 0x74732119, 0x00207083, 0x74221082, 0x33827400, 0x73223482, 0x7984735f, 0x81826384, 0x2b735e22,
-    0x01227683, 0x33825e2b, 0x73204282, 0x73318885, 0x005e5f18, 0x05cc0500, 0x057d00cc, 0x00150045, 0x20058460, 0x29008b00, 0x14003a04, 0x00007700,
-    0x1583ecff, 0xfe210589, 0xc90f8357, 0x00082103, 0xb42c0084, 0xaa00bd00, 0xc800a000, 0x8500b400, 0x00281184, 0x7e008800, 0xc000a500, 0x06850d86,
-    0xc900bf2c, 0x8c00ab00, 0x9b00bc00, 0x12858d00, 0xb9200594, 0x7c204782, 0x94221984, 0x07845f00, 0x01270494, 0x006f00a8, 0x82a40078, 0x82832077,
-    0x00bb2e4f, 0x018a015e, 0x00600003, 0x00810074, 0x347b82b8, 0x04b10450, 0x004cfec3, 0x00b201eb, 0x000901c3, 0x022b017b, 0x20838296, 0x264e9496,
-    0x00920000, 0x826b00a8, 0x82b72005, 0x839b2005, 0xf2023323, 0x3e029200, 0xa5026e00, 0x89004503, 0x6000a000, 0x17824c02, 0x0000c32e, 0xa4004e01,
-    0x5e005b01, 0x69008000, 0x00208582, 0x68200982, 0x02891982, 0x4a032626, 0x7b008700, 0x75211082, 0x2f198a00, 0x33028205, 0xf4ff0b00, 0x89008300,
-    0x96008f00, 0x71243d82, 0x52005b00, 0x02832782, 0x0302b222, 0x8d280682, 0xbb001f03, 0xb500ae00, 0x00220b82, 0x05848b00, 0x062b0482, 0x027003a9,
-    0xfd0802bc, 0x82910099, 0x4d380801, 0x64004d00, 0x81016400, 0xa8009f00, 0x9cfe68fe, 0x45019b00, 0x90004501, 0x1700f6fe, 0x45057a00, 0x0c004d02,
-    0x9805eeff, 0x6e008b02, 0x62004c00, 0xe8004600, 0x11054400, 0x2c214a82, 0x09018500, 0x7e0054ac, 0x30023001, 0x08040603, 0x5c042404, 0x0c059204,
-    0x76054a05, 0xac059205, 0x5c06da05, 0x2207a806, 0x3208e807, 0x6409bc08, 0x6a0a9e09, 0x340b0e0b, 0x9c0b4c0b, 0x260cd60b, 0xdc0d9c0c, 0xc20e3e0e,
-    0xae0f540f, 0x2c10f20f, 0xf410b010, 0x84113a11, 0x0e12ec11, 0x0613a412, 0xd0137813, 0xda145e14, 0xc2158a15, 0x7e161a16, 0xf8177417, 0xac185a18,
-    0x0819d818, 0x78193019, 0xaa198c19, 0xd61a581a, 0xde1b5c1b, 0xc81c681c, 0xc61d761d, 0x5a1e061e, 0xfe1ece1e, 0xea1f941f, 0xd6204e20, 0xb0215c21,
-    0x9a224222, 0x5e23f422, 0xca244e24, 0x98255625, 0x32261826, 0x1427b226, 0xc4273e27, 0x28295e28, 0xd429ac29, 0x082bdc2a, 0x9c2c0a2c, 0x0e2dec2c,
-    0xee2de42d, 0xa22e4e2e, 0x862ffe2e, 0x1230a42f, 0x5c305430, 0xf030b030, 0x9a314c31, 0xde31c031, 0x7a320032, 0xaa329232, 0xda32c232, 0x0c33f432,
-    0x90337c33, 0xc033a833, 0xf233d833, 0x22340a34, 0x54343a34, 0xe834d034, 0x18350035, 0x48353035, 0xcc356235, 0x92367a36, 0xc236aa36, 0xf436dc36,
-    0x0a385237, 0x38382238, 0x70385238, 0xa4388c38, 0x98398439, 0xc639b039, 0xf439dc39, 0x263a103a, 0x683a443a, 0x303b1a3b, 0x5e3b483b, 0x8a3b743b,
-    0xee3ba23b, 0xc43cac3c, 0xf23cda3c, 0x223d0c3d, 0xbe3da63d, 0x683eee3d, 0x483f203f, 0x2040c83f, 0x48403440, 0x98406e40, 0x0a41c640, 0xa4415641,
-    0x0e42e041, 0x5e423c42, 0x22430043, 0xbc436443, 0xa2444a44, 0x02000000, 0x04824400, 0x5505643b, 0x07000300, 0x01b12e00, 0xb23c2f00, 0xed1c0407,
-    0x0506b132, 0x03b23cdc, 0x220a8202, 0x8303b100, 0x83052016, 0x07b22716, 0x3cfc1d06, 0x178301b2, 0x21113337, 0x11212511, 0x20024421, 0x980124fe,
-    0x550568fe, 0x0444abfa, 0x215783cd, 0x57820302, 0x4405c922, 0x4a085784, 0x03154029, 0x00029807, 0x02041004, 0x09080404, 0x05020101, 0x0302049d,
-    0xed2f3f00, 0x112f3911, 0x2f390112, 0x32ed335d, 0x23013031, 0x35033303, 0xb1021533, 0xc6c41894, 0x038d01c2, 0xc9bcfab7, 0x010200c9, 0x034d0315,
-    0x84cc05b6, 0x2725084f, 0x96031440, 0x07090202, 0x01062f96, 0x06010600, 0x06000005, 0x3f000002, 0x322f3333, 0x5d5d2f01, 0x2f3912ed, 0x844d85ed,
-    0x8e8c3151, 0x15fee028, 0x03e0298d, 0xfd7f024d, 0x007f0281, 0xc4080082, 0x00360002, 0x058b0400, 0x001b0045, 0xb9f0001f, 0xf0ff0400, 0x110d9940,
-    0x161d0648, 0x031d261d, 0x01160106, 0x12030126, 0x040b0e0f, 0x1d08130a, 0x1404151c, 0x00010409, 0x05180419, 0x071e1f16, 0x13170604, 0xac0514ac,
-    0x18ac1706, 0x3f032f1a, 0x1a030203, 0x06301803, 0x06500640, 0x20181003, 0x18e00218, 0x140218f0, 0x06181806, 0x210a0314, 0x0c0c1111, 0x0a00ac09,
-    0x04080a01, 0x1d0daf0c, 0x001c0d01, 0x1911af10, 0x114f1115, 0x5f114f01, 0x0311ef11, 0x221f4011, 0x8f0d7f48, 0x030d9f0d, 0x0d5f0d4f, 0x0d110d02,
-    0x13170511, 0x00050a03, 0x333f332f, 0x2f393912, 0x2b715d2f, 0x3311715d, 0x32ed1033, 0x82068632, 0x33ed27f4, 0x112f332f, 0x20821712, 0x1f832182,
-    0x2f5d2f24, 0x0183ed10, 0x038b1583, 0x5d30312c, 0x03012b5d, 0x03211521, 0x03831323, 0x33352329, 0x21352313, 0x83033313, 0x82332003, 0x212e0817,
-    0x43a20313, 0xe5fe0401, 0xfe566e58, 0x546e5495, 0xf143e1c9, 0x6e590701, 0x586b0158, 0xfdd3586e, 0x6a014540, 0xfe410343, 0x68fe6cc3, 0x03839801,
-    0x3d016c23, 0x0809856c, 0x6c68fe74, 0x3d01c3fe, 0x03000000, 0x73ff4200, 0xc4057e04, 0x44003900, 0x19014f00, 0x3d44c740, 0x65023d54, 0x476e014e,
-    0x013c6501, 0x75012f6a, 0x022a852a, 0x29862976, 0x86227602, 0x0e650222, 0x890a7901, 0x0979020a, 0x79020989, 0x02038903, 0x1f8a1f7a, 0x2d6f2c02,
-    0x334b452d, 0x243f0627, 0x1f070711, 0x00850075, 0x006f0002, 0x20451045, 0x70456045, 0x08830545, 0x08823020, 0x45905008, 0x45b045a0, 0x51454507,
-    0x400b6f0c, 0x8e482012, 0x0b0b010b, 0x1f006f3a, 0x00021f40, 0xf01f101f, 0x321f031f, 0x4a247340, 0x3f337312, 0x2d2d243f, 0x40252427, 0x25482720,
-    0x48171240, 0x06242525, 0x0873114b, 0x0c100c00, 0x0c500c40, 0x83050c60, 0x0ca03806, 0x0cf00cb0, 0x080c0c05, 0x07010790, 0x18080507, 0x33333f00,
-    0x82115d2f, 0x10712903, 0x333f32ed, 0x112b2b2f, 0x11251182, 0xed332f39, 0x24118232, 0x715d2f01, 0x211d82ed, 0x2384ed2b, 0x125ded22, 0x33251982,
-    0x3232cd33, 0x25108232, 0x30315ded, 0x00895d00, 0x015d0133, 0x07020e14, 0x2e352315, 0x1e372701, 0x26111703, 0x2a018227, 0x35052e23, 0x37023e34,
-    0x82153335, 0x07d70813, 0x1127032e, 0x1401051e, 0x1117021e, 0x3401030e, 0x1127022e, 0x7e04033e, 0x77af7238, 0x22f3d780, 0x4d2d0baa, 0x07084d70,
-    0x02030604, 0x4c586231, 0x72401f38, 0x66805d9d, 0x14406691, 0x3f270aae, 0x723a3b58, 0x24415867, 0x4528b0fc, 0x6247365d, 0xa4021b3c, 0x3a6a5030,
-    0x2b4d6b41, 0x804b7c01, 0xa105395f, 0xa7b907a1, 0x445b3625, 0xe9010429, 0x02010202, 0x271d0c01, 0x3f614937, 0x284f7752, 0x04828203, 0x4c75502c,
-    0x394f3021, 0x56fe0421, 0x3a2b1f0e, 0x36026c51, 0x1e2f4736, 0x039d010e, 0xfd453521, 0x34513f5e, 0x29fe0f21, 0x52381e04, 0x00050000, 0x04f4ff00,
-    0x005105ce, 0x00170003, 0x003f002b, 0xb9c10053, 0xd8ff3e00, 0x0e090e40, 0x09283848, 0x8334480c, 0xb82e2404, 0x82b3d8ff, 0x82162011, 0x201a8407,
-    0x20158310, 0x2004830c, 0x20128306, 0x2b1b8216, 0x02890279, 0x56030202, 0x86007600, 0x4d084f82, 0x01100301, 0x00f0ffba, 0x40c0ff03, 0x480e0a3a,
-    0x012f011f, 0x0303013f, 0x13010301, 0x3bb44a31, 0x70b431b5, 0x02408040, 0x55134040, 0xb509b418, 0x4513b422, 0x4fb72cb6, 0x271936b6, 0x1db70eb6,
-    0x020704b6, 0x00180006, 0xed3f3f3f, 0x0383edf4, 0x822f0121, 0x12112708, 0xfd5d2f39, 0x0782edf4, 0x2f2f3929, 0x38382b5d, 0x825d3311, 0x30312102,
-    0x3608ae49, 0x33012333, 0x021e3225, 0x020e1415, 0x022e2223, 0x023e3435, 0x822e3413, 0x820e200b, 0x021e2613, 0x023e3233, 0x081f9e01, 0x0391dd28,
-    0xa0fc93a4, 0x2d4d673a, 0x3c684e2d, 0x2c4e693c, 0xc66a4e2d, 0x21332312, 0x12243623, 0x22352413, 0x13243320, 0x219f0802, 0x49052508, 0x814d1f08,
-    0x50826063, 0x834f2323, 0x4d816360, 0x42b0fe1f, 0x16153558, 0x40425735, 0x17173657, 0xd8fe5736, 0x340822a0, 0x00030000, 0x04ecff2b, 0x004d05a1,
-    0x004f003d, 0x40f4005f, 0x834e7318, 0x5179024e, 0x65025189, 0x85587558, 0x53690358, 0x01253901, 0xe8ffb820, 0x480e09b3, 0x0807841c, 0x2e480c94,
-    0x40f0ffb8, 0x480c093d, 0x06011225, 0x02121612, 0x23194948, 0x3e303e49, 0x013b3001, 0x49313b3b, 0x01506b30, 0x141c140c, 0x2803146c, 0x0414534b,
-    0x34502d3e, 0x70190405, 0x903e803e, 0x3e3e033e, 0xffb81930, 0x103f40c0, 0x303f4813, 0x19301901, 0x48566130, 0x170b400f, 0x2d600f48, 0x2d802d70,
-    0x01506503, 0x05015029, 0x042d3450, 0x4b45300a, 0x4b654b55, 0x30144b03, 0x5b055328, 0x031e5143, 0x00515b37, 0x3f00160a, 0x3f32ed33, 0x391712ed,
-    0x04832f5d, 0x015d5d25, 0x45ed2b2f, 0x2b270532, 0x5d2f3912, 0x84391711, 0xed103517, 0x5d5d2f32, 0xed10ed10, 0x5d003031, 0x2b2b2b5d, 0x005d015d,
-    0x05260384, 0x27022e22, 0xd541030e, 0x2e372707, 0x3e343503, 0xcc413302, 0x1e073406, 0x013e1703, 0x010e1737, 0x33011e07, 0x15373632, 0x4101010e,
-    0x162b08f8, 0x03033e17, 0x0e27012e, 0x42141501, 0xad080504, 0x4c293004, 0x1c163a43, 0x3b675647, 0x31669e6d, 0x3e6b4e2d, 0x0c151b0f, 0x5984572b,
-    0x30567645, 0x4e937244, 0x4a443e1f, 0x143f2a2a, 0x31571a91, 0x1a28612b, 0x38181530, 0x2d18bbfe, 0x492c2740, 0x17261e35, 0x31557140, 0x42a1594a,
-    0x40205e55, 0x47274161, 0x150c313c, 0x191a2f23, 0x3a182632, 0x4d508a66, 0x2051677e, 0x4c49441c, 0x516d3e25, 0x6444232e, 0x566c4740, 0x64362146,
-    0x572e5d60, 0x8b2b79c6, 0x33365ee5, 0x0b870907, 0x2249040b, 0x19162738, 0x412a432e, 0x321b2b74, 0xcbfc473a, 0x2e74e164, 0x5c346595, 0x1e132744,
-    0x00820026, 0xf601013e, 0xd6024d03, 0x0300cc05, 0x0d401c00, 0x02009603, 0x04020201, 0x02000005, 0x333f0000, 0x2006aa47, 0x055a47ed, 0x47ac0221,
-    0x00280651, 0x56010100, 0x7b0357fe, 0x22083782, 0x40280015, 0xf0061016, 0x1f050f11, 0x05050205, 0x00f00017, 0x100b010b, 0x001b0600, 0x2f013f3f,
-    0x4712ed5d, 0x142408ec, 0x2317021e, 0x08056141, 0x0e33372c, 0x29110203, 0xbe608958, 0x2b59875c, 0x5c87592b, 0x588960be, 0x8a120229, 0x76e1e6f4,
-    0xfbe6db71, 0xe5f99090, 0xe17671d9, 0x6f83f4e6, 0x6f825020, 0x6f847520, 0x1340242a, 0x0b0bf000, 0xf0051117, 0x10266582, 0x10060206, 0x6c860500,
-    0x32ed3322, 0x08060a48, 0x020e1428, 0x033e2307, 0x022e3435, 0x031e3327, 0x582a7503, 0x60c05c87, 0x2a2a588a, 0xc0608a58, 0x2a58875c, 0xfb901402,
-    0x6184dbe6, 0x84898a21, 0xe5d92275, 0x086b82f9, 0x02f80033, 0x05d403fc, 0x000e00cb, 0x5b1740af, 0x02066b06, 0x03500300, 0x0f030360, 0x6f095f09,
-    0x030b0309, 0xffb80807, 0x0b4c40c0, 0x08084811, 0x04050d0a, 0x08098240, 0x0204043e, 0x0d0a0e0e, 0x800a700e, 0x060a020a, 0x100d000e, 0x0d0d020d,
-    0x0a02100f, 0x000b010a, 0x850c750c, 0x0903020c, 0x0b7f0804, 0x0b020b8f, 0x0c090608, 0x050d050b, 0x07800770, 0x07030790, 0xb6375082, 0x07480c09,
-    0x00000d07, 0x2b2f333f, 0x1712335d, 0x115d2f39, 0x84331133, 0x49078204, 0xcd2e0538, 0x2b5dc439, 0x4d101801, 0x2b2f39e4, 0xef821133, 0x332b3f08,
-    0x5e5f3031, 0x5d005d5d, 0x05172501, 0x010b0717, 0x37253727, 0x02330305, 0x2d08019f, 0x77b9e6fe, 0xbd779c96, 0x012de8fe, 0x04880c0b, 0x498467a4,
-    0x020148fa, 0xf84800ff, 0x016b8649, 0xf3830029, 0xb400742f, 0x9e045704, 0x49000b00, 0x0e0b2540, 0x3ecc8201, 0xaa010904, 0x02000640, 0x02030a01,
-    0x020d0c02, 0x0507040e, 0x0107300e, 0xad040007, 0x82b30509, 0x32ed25a5, 0x002b5dc6, 0xe6208a82, 0x83829a84, 0x821a3321, 0x299d8413, 0x013031e6,
-    0x21112311, 0xc2822135, 0x02152137, 0x58fe93af, 0x0193a801, 0xfe6002a8, 0x92ac0154, 0x54feac01, 0x3f7a8292, 0x03010100, 0xb50295fe, 0x03002b01,
-    0x27403900, 0x00190009, 0x0e100002, 0x02094811, 0x02020219, 0x012a0983, 0x03970299, 0x6f002f9a, 0x24827f00, 0x019c0037, 0x1000049b, 0x2f01edf6,
-    0xedfded5d, 0x5d2b3031, 0x13015d2b, 0x24488221, 0xfe0901a9, 0x224d82c9, 0x826afd96, 0x014e2657, 0x027e03d0, 0x28328270, 0x030f401d, 0x00000503,
-    0x265a8210, 0x012fba00, 0x82000101, 0x223f823b, 0x822f3912, 0x21352ba7, 0x024e0115, 0xa0d00130, 0x378200a0, 0x0000f024, 0x8f84db02, 0x0c401a24,
-    0x12829603, 0x04000029, 0x009b0105, 0x84ed2f00, 0x825d20e8, 0x26d68374, 0x01ebf001, 0x83d5fe2b, 0xff722620, 0x055904ec, 0x086b82cc, 0x1c403d22,
-    0x3901018a, 0x79016901, 0x02010301, 0x05020210, 0x36010385, 0x76036603, 0x00030303, 0xb7f0ffb8, 0x03233083, 0x43000119, 0x38230521, 0x825d5d32,
-    0x33383a87, 0x30315d5d, 0x01330117, 0xb2350372, 0x0514cffc, 0x0020fae0, 0x00030000, 0x085b827c, 0x5a054f63, 0x27001300, 0x79002b00, 0x20365240,
-    0x56114601, 0x0d460211, 0x49020d56, 0x02075907, 0x03590349, 0x202a1002, 0x2a40022a, 0x00022a50, 0x292a0129, 0x001e292a, 0x5014406e, 0x14000214,
-    0x2d141401, 0x0a006f1e, 0x0a020a10, 0x4f01284f, 0x02285f28, 0x23292928, 0x070f7319, 0x19057323, 0x3fed3f00, 0x228482ed, 0x43715dcd, 0x712007b3,
-    0x22064a45, 0x4831715d, 0x013406bb, 0x010e0214, 0x012e2223, 0x12343502, 0x3233013e, 0x0712011e, 0x080e0747, 0x33352552, 0x4d4f0415, 0x6766b485,
-    0x4b4b83b2, 0x656ab484, 0xb74c84b1, 0x48714e28, 0x284f744c, 0x49724f29, 0x2b4f7247, 0x02eb58fe, 0xf7fec3a3, 0xa34747a4, 0xccc30a01, 0x409f0c01,
-    0xf4fe9f40, 0x7ed49fcc, 0xd37e3534, 0x80d29a9f, 0xd2803838, 0x00f9f922, 0x47080082, 0x00940001, 0x056a0400, 0x00120045, 0x00394059, 0x11110111,
-    0x08026f10, 0x01011f08, 0x013f010f, 0x015f014f, 0x019f018f, 0x010701af, 0x02100e01, 0x70021001, 0x03028002, 0x14130202, 0x09097308, 0x10060e03,
-    0x18007301, 0x3223e682, 0x4133333f, 0x712007c6, 0x39080a82, 0x2f33715d, 0x2f32ed10, 0x3330315d, 0x0e112135, 0x32352303, 0x3337023e, 0x9d152111,
-    0x6013b701, 0x4a428e7d, 0x1a607c8f, 0x916101a6, 0x4728fd03, 0x22941f34, 0xfb32543d, 0x9784914c, 0x97829020, 0x053c3d08, 0x0026005a, 0x755c4087,
-    0x02068506, 0x74012039, 0x021b841b, 0x1a861a76, 0x87157702, 0x16770215, 0x69021687, 0x106b010a, 0x01105901, 0x26011a05, 0x1f6e1d26, 0x02083f08,
-    0x08bf086f, 0x0032c582, 0x136e1228, 0x24600013, 0x24802470, 0xcf242403, 0xab420100, 0x12122705, 0x0718730d, 0xba872401, 0x2f33ed26, 0x5d5d2f01,
-    0x2605894a, 0x391211ed, 0x82715d2f, 0x0c5c4abb, 0x3e353324, 0x95413505, 0x27072306, 0xcc46033e, 0x04470806, 0x90152107, 0xa5a3902c, 0x47275485,
-    0x5d363b61, 0xb8072c46, 0xa26f4009, 0x75a7696a, 0xa487563e, 0x0220809c, 0xa46175d3, 0x85818491, 0x39573c4a, 0x593c1e1b, 0x864c113b, 0x5d303a65,
-    0xa15e598a, 0x81808290, 0x82009246, 0xff80249a, 0x824b04ec, 0x3b4708f3, 0x6340e600, 0x39853975, 0x01396302, 0x39503940, 0x88347802, 0x346c0234,
-    0x5b344b01, 0x2f740234, 0x06022f84, 0x862e762e, 0x2977032e, 0x6c022987, 0x255a0125, 0x01126301, 0x55010d64, 0x0879010d, 0x79020889, 0x4b078907,
-    0x340805f6, 0x028b027b, 0x311a3602, 0x5f203f6e, 0x20200220, 0x40136e00, 0x13000113, 0xffb81301, 0x153c40c0, 0x131a4818, 0x3d0a131a, 0x27276e26,
-    0x0acf6e0b, 0x0aef0adf, 0x05d14203, 0x73193634, 0x2c101a1a, 0x73232626, 0x7310072c, 0x900b4005, 0x0483020b, 0x030bf03c, 0x19050b0b, 0x2f333f00,
-    0xed10715d, 0x2f33ed3f, 0x2f391211, 0x2f0139ed, 0x0c825d5d, 0x2006f549, 0x251c832b, 0xed712f33, 0x4a413911, 0x07b04b0c, 0xf8490120, 0x37273706,
-    0x3233031e, 0x2e343536, 0x35012b02, 0x023e3233, 0x23263435, 0x66410622, 0x026a080a, 0x031e1507, 0x793f4b04, 0xb48274b2, 0xba093a74, 0x6d4a2b08,
-    0x459b8849, 0x66337967, 0x5b6e3362, 0x7783853b, 0x0bb50c93, 0x599e7b50, 0x336ca977, 0x4a6f4925, 0x2b547d52, 0x915b7201, 0x6b413664, 0x38114989,
-    0x7e24425c, 0x355a4479, 0x37199c16, 0x776a3f59, 0x5d0e6f7a, 0x382d5b8a, 0x37498160, 0x0f405667, 0x573c0904, 0x0082006a, 0x00022508, 0x04000067,
-    0x00450565, 0x000d000a, 0x69354055, 0x89067906, 0x097f0306, 0x08090901, 0x060d6f01, 0x02a00290, 0x28080082, 0x106f0c0f, 0x00040104, 0x05087304,
-    0x0c1f0c0f, 0x0c6f0c2f, 0x010c0c04, 0x0106060b, 0x3f3f0018, 0x2f391233, 0xed33335d, 0x08b14732, 0x32250b82, 0x30315d2f, 0x05c5455d, 0x33012708,
-    0x09153311, 0xa9032101, 0x0272fdb4, 0xfebcc77b, 0x010cfe90, 0xfe3f01f4, 0x8c3f01c1, 0x88fc7a03, 0xfd43038e, 0x1f42004b, 0x45470809, 0x8e002c00,
-    0x08695e40, 0x08890879, 0x79076903, 0x03078907, 0x175a174a, 0x55134502, 0x40220213, 0x2248110d, 0x156e0022, 0x1f212425, 0x0a20206f, 0x00011540,
-    0xd015c015, 0x15150315, 0xf06e0b2e, 0x0acf010a, 0x41020adf, 0x253205e2, 0x1a202073, 0x01286f73, 0x24102828, 0x10062173, 0xd9410573, 0x44102007,
-    0x5d2405ba, 0xed2f33ed, 0x5d20be82, 0x20057248, 0x28d18271, 0x323233ed, 0x2f32ed10, 0x06d5412b, 0x210dc741, 0x2643023e, 0x23c60808, 0x21152113,
-    0x33013e03, 0x04021e32, 0xbb7e404b, 0x72a56f7b, 0x0bb60e43, 0x48654528, 0x2c517246, 0x48714e2a, 0x35414c2d, 0x032fb017, 0x1d85fd21, 0x69639030,
-    0x014076a8, 0x7bab64bc, 0x7a5b3446, 0x4b281546, 0x502b233b, 0x673c4975, 0x1c102b4c, 0xd8021425, 0x2557fe91, 0x9c714035, 0x02000000, 0xecff9700,
-    0x5a054804, 0x38002400, 0x7d40ab00, 0x038a037a, 0x8a027a02, 0x03680202, 0x03880378, 0x77236703, 0x03238723, 0x22772267, 0x45032287, 0x02375537,
-    0x31533143, 0x5a2d4a02, 0x274b022d, 0x1c02275b, 0x3c1b2c1b, 0x6e15031b, 0x6e001414, 0x400125af, 0x25000125, 0x25d025c0, 0x3a252503, 0x906e2f1d,
-    0x2c41a00a, 0x0ae03d05, 0x0a040af0, 0x206f732a, 0x20201001, 0x20200220, 0x0f731834, 0x1501158f, 0x34070f15, 0x3006ec45, 0x105d2f33, 0x2f3912ed,
-    0x01ed5d5d, 0xed715d2f, 0x200b8332, 0x20078271, 0x05244b2f, 0x450ffa42, 0x022907f1, 0x012e0717, 0x020e2223, 0x052d4115, 0x080fff45, 0x3b480462,
-    0x7b6faa73, 0x453d7ab8, 0x4876bb82, 0x174e677e, 0x517b1cac, 0x2d54784a, 0x6073b231, 0xb73c6f9d, 0x466a4824, 0x33516431, 0x426a4b28, 0x26486741,
-    0xab64be01, 0xac5d467d, 0x01b198f5, 0x1e5fb810, 0x1f506e43, 0x8645515b, 0x5f5b81c5, 0x6ba0723e, 0x2d507043, 0x41624121, 0x39628148, 0x0074522d,
-    0x37080082, 0x009e0001, 0x052d0400, 0x000e0045, 0x05104035, 0x0c06066e, 0x0b0b6f00, 0x100c0010, 0xb80c020c, 0x0b40c0ff, 0x0c481814, 0x0d730c00,
-    0x00180506, 0x32ed3f3f, 0x5d2b2f01, 0x2b52e482, 0x062d0807, 0x2315020a, 0x37021a34, 0x04213521, 0x82ab602d, 0x8650bc4c, 0x1ffd61b0, 0xba048f03,
-    0xfedafe8a, 0x9fc6fecf, 0x013b019e, 0x85240132, 0x08738291, 0x85000351, 0x4604ecff, 0x29005a05, 0x51003d00, 0x7e40b600, 0x28852875, 0x860c7602,
-    0x0278020c, 0x78020288, 0x02088808, 0x1d871d77, 0x89227902, 0x12780222, 0x6a021288, 0x406a0146, 0x01506501, 0x65014a65, 0x3665013c, 0x1f102401,
-    0x1f156e34, 0x82152a6e, 0x000a3601, 0x013e406e, 0x3ec03e00, 0x3e033ed0, 0x6e48533e, 0x0af00ae0, 0x0af84202, 0x10102436, 0x39397343, 0x861a764d,
-    0x732f021a, 0x0579071a, 0x4d020589, 0x2205c641, 0x84ed3f5d, 0x113922d3, 0x0af94233, 0x3925e282, 0xed102f2f, 0x44088310, 0x03430fd0, 0x34352507,
-    0x3537023e, 0x230eef4c, 0x03031e15, 0x4e0ed047, 0x8d080fe8, 0x75394604, 0xb57c7db5, 0x4f2f3977, 0x5d3b3665, 0x7039213f, 0xa9736da6, 0x3f21366f,
-    0x683d3d5d, 0x1bde2b4d, 0x4649643e, 0x161c3f63, 0x5650663a, 0x23113766, 0x5673441c, 0x20456f4f, 0x51724620, 0x1d446f53, 0x91547a01, 0x6b3d3d6c,
-    0x73475391, 0x04093454, 0x64543e0e, 0x607d4435, 0x7e603a39, 0x54643444, 0x0a040c3d, 0x02715435, 0x3c522f33, 0x523c2323, 0x4552252f, 0x52452e2d,
-    0x592dbbfd, 0x482c2c47, 0x653b2f5a, 0x4b292a4a, 0x00820067, 0x8d000226, 0x3f04ecff, 0x39065b43, 0x7a7740a5, 0x02088a08, 0x078a077a, 0x77206702,
-    0x03208720, 0x1a781a68, 0x54431a88, 0x31452205, 0x0b544355, 0x11134608, 0x11331123, 0x6e001303, 0x258f253f, 0x25af259f, 0xd025c004, 0x25250225,
-    0x6e0b3a1d, 0x6e2f0a0a, 0x1df01de0, 0x011dcf02, 0x1d101d00, 0x73341d02, 0x13401813, 0x18184816, 0x22732a0e, 0x05730e07, 0x0b800b70, 0x08644602,
-    0x21068b44, 0x8944332b, 0x2f332106, 0x2007a547, 0x0b884133, 0x29074949, 0x1e372702, 0x3e323301, 0x834e3702, 0x32332109, 0x08105449, 0x463f0477,
-    0x5177bd84, 0x16486682, 0x5b771cac, 0x3155784a, 0x5d491501, 0x9b60386b, 0x783f3b6c, 0xf1ec6faf, 0x6b4925c4, 0x48684146, 0x68462327, 0x53673245,
-    0xb1bf0235, 0x5db7f2fe, 0x4f704621, 0x44555b1b, 0x2f81c484, 0x441b334a, 0x6865a97a, 0xfe4278a9, 0x8349b0b4, 0x532d3b63, 0x73424673, 0x43223257,
-    0x01020065, 0x020000f0, 0x003a04db, 0x00070003, 0x06124024, 0x06fb4a05, 0x04080925, 0x4a0f059b, 0x3f2005ff, 0x2807014b, 0x30313233, 0x11331121,
-    0x2a038203, 0xebebf001, 0xfe2b01eb, 0x830f03d5, 0x25468205, 0x95fe6001, 0x4b861203, 0x83010021, 0x21132223, 0x26278201, 0x01a985fe, 0x85c9fe09,
-    0xfb310828, 0xfd960286, 0x0000006a, 0x00740001, 0x0457049a, 0x000600aa, 0x0100b577, 0x05040552, 0x400d01b8, 0x14000610, 0x06050006, 0x52010201,
-    0x04010403, 0x2f148303, 0x14010228, 0x02030102, 0x00040806, 0x02001000, 0x04383d82, 0x3f050204, 0x7f066f06, 0x40060306, 0x06481512, 0x01020f03,
-    0x5d2f0002, 0x2605484d, 0x332f3d39, 0x82180133, 0xde10280e, 0x0487c1d4, 0x8401102b, 0x84c42005, 0x2b183f07, 0x31c42b87, 0x01351330, 0x15010915,
-    0xfce30374, 0x025a03a6, 0xa201cd3b, 0xfe92fe9a, 0x9f829991, 0x74000237, 0x57045801, 0x0300ec03, 0x4c000700, 0x02073740, 0x01000409, 0x3e978210,
-    0x041fad05, 0x049f047f, 0x04bf04af, 0x12400405, 0x00044816, 0x500130ad, 0x70016001, 0x82500401, 0x01802704, 0x01d001b0, 0x754c0f05, 0x715d2705,
-    0x712b2fed, 0x8c8301ed, 0x8332ce21, 0x15212476, 0x84213501, 0x031d2a77, 0x945803e3, 0x9400fe94, 0x0f134194, 0x52010622, 0xfe836c82, 0x0600102f,
-    0x01060014, 0x01040500, 0x05020352, 0x05134102, 0x14050426, 0x04030504, 0x2a091441, 0x02020506, 0x01040f03, 0x4d3f0104, 0x40290637, 0x00481512,
-    0x5d2b2f00, 0x417b8232, 0xc4240812, 0x1032ce10, 0x25171341, 0x01093537, 0x9b820135, 0xa6fc5a2f, 0x999ae303, 0x6e016f01, 0xcd5efe9a, 0x30008200,
-    0x005e0002, 0x05310400, 0x0027005a, 0x406d002b, 0x067b4849, 0x79046931, 0x03048904, 0x1b5a1b4a, 0x17250702, 0x53660225, 0x3a0805c0, 0x0a982b09,
-    0x001e2828, 0x01130098, 0x1d2d1313, 0x400a1e98, 0x0a48140f, 0x9d29230a, 0x76236628, 0x03238623, 0x9e181d1d, 0x3f000423, 0x5d2f33ed, 0x3911ed2f,
-    0x2f012b2f, 0x503912ed, 0x33230545, 0x435d32ed, 0x01270644, 0x07060e14, 0x4a073e23, 0x3b080fe7, 0x15333501, 0x3e253104, 0x3f4f524f, 0x02af0127,
-    0x504e3e27, 0x29253c4d, 0x44446d4d, 0x0732526f, 0x7e4a0cb8, 0xb16c70b0, 0x8ffd447e, 0x45ea03c3, 0x3b425268, 0x3753443b, 0x41516643, 0x35340883,
-    0x1e395437, 0x3e654726, 0x6c975a0c, 0x895d303d, 0xc9c9bcfb, 0x5008eb84, 0x04e5fe2c, 0x00cc05a5, 0x0178005f, 0x0191403b, 0x02441144, 0x3f553f35,
-    0x01033f75, 0x023e113e, 0x347c346c, 0x1703348c, 0x480e0b18, 0x087c086c, 0x6c03088c, 0x02667c66, 0x665a664a, 0x015d2602, 0x6501536a, 0x85497549,
-    0x3f7f0349, 0x3f023f8f, 0x30278240, 0x0301397e, 0x2a7f2a6f, 0x02032a8f, 0x2a5f2a4f, 0x083d8402, 0x7a376a6a, 0x03378a37, 0x4b015169, 0x4c1f4c0f,
-    0x564c4c02, 0x2937d300, 0x600ad32f, 0xd26a0a28, 0x1440371a, 0x37104818, 0x3f1a2f01, 0x0a37021a, 0x370a1a1a, 0xb8417a03, 0x0db5e8ff, 0xd3414811,
-    0xc0ffb856, 0x20172640, 0x6f325648, 0x050f15d6, 0x21d66315, 0x26192828, 0x0f212601, 0x2f151f15, 0xaf159f15, 0x21900515, 0x210221a0, 0x172d2a83,
-    0x4b480c09, 0x15212115, 0x3c46034b, 0x3f428210, 0x005bd53c, 0xb851d546, 0x3f000f01, 0x2bed3fed, 0x2f391712, 0x5d2b2f2f, 0x5d33115d, 0xed102f33,
-    0x22058258, 0x872b2f01, 0x5d5d221a, 0x8215872b, 0x2f392d07, 0x5d00335d, 0x30315d01, 0x5f5d2b00, 0x39820182, 0x00825d20, 0x845d0121, 0x087e4608,
-    0x3e013c25, 0x44233501, 0x043008f6, 0x021e3233, 0x33373317, 0x15030e03, 0x32331614, 0x20089d49, 0x08635501, 0x84173721, 0x0201262e, 0x011a3435,
-    0x28308236, 0x34051201, 0x0e222326, 0x07805304, 0x3e37d908, 0x29a50403, 0x1e48724e, 0x01162734, 0x2e0f0601, 0x3f2a493b, 0x17173556, 0x6251412c,
-    0x2b3e2a38, 0x2005091c, 0x0f086374, 0x141d060b, 0x192f4128, 0x60946535, 0x427fbb78, 0x66a26f3b, 0x5159663b, 0x612b4726, 0x7f497e6f, 0x544d8ecc,
-    0x8396e9a1, 0xfe3f80c3, 0x253b4662, 0x1b283440, 0x2c1b0b0e, 0x3a472720, 0x08030d2e, 0xf3020407, 0x60acef90, 0x2c3c2510, 0x0a0c0b02, 0x36472703,
-    0x8b6b411f, 0x88964c4a, 0x1b305575, 0x97243f2f, 0x512a05fe, 0x34153d49, 0xc9915024, 0xa6e08179, 0xfee78660, 0xfa98b1c8, 0x2a1962b3, 0x2557213a,
-    0x711f3544, 0xb62601d0, 0x016301d1, 0xc8769204, 0x6a76f8fe, 0x644b2c6d, 0x3c397771, 0x372b4b67, 0x13578f64, 0x00313634, 0x00020000, 0x04350082,
-    0x004505cc, 0x00140007, 0x13424072, 0x01050302, 0x030d0352, 0x06f8435e, 0x01143f08, 0x52010600, 0x5e000d00, 0x07140607, 0x10040d06, 0x07070107,
-    0x8f047f16, 0x07040204, 0x145f0201, 0x0d5a1313, 0x010d4b01, 0x0305060d, 0x00120004, 0x333f323f, 0x395d5d33, 0x32ed332f, 0xdb58012f, 0x39122f05,
-    0x2b872b87, 0xc0c010c4, 0x87c10010, 0x0c861805, 0x30314b08, 0x03210321, 0x09330123, 0x27032e01, 0x0307030e, 0x8a0a0421, 0xc489cdfd, 0x01d9fe01,
-    0x0df1fdf5, 0x0411171c, 0x19171004, 0xcf01970d, 0x82fe7e01, 0xbbfa4505, 0x4e26ba03, 0x0c0c3546, 0x254e4636, 0x030059fe, 0x0000a200, 0xc3828004,
-    0x00165608, 0x002e0021, 0x654f4077, 0x246a012d, 0x01206601, 0x028b027b, 0x840b7402, 0x030b940b, 0x6f010b07, 0x124b0112, 0x1202125b, 0x175a0d29,
-    0x48140d40, 0x00061717, 0x0122005a, 0x1c302222, 0x06005a29, 0x06a00610, 0x060406b0, 0x1c5f2812, 0x5f1b291c, 0x5f290307, 0x4cd28206, 0xed210509,
-    0x4ace8239, 0xed2805d1, 0x2b2f3912, 0x5d3911ed, 0x27098059, 0x020e1401, 0x21112123, 0x2709e355, 0x2b263401, 0x32331101, 0x8205d557, 0x8221200a,
-    0x0455080a, 0xbc8e5480, 0x0128fe68, 0x80b8759c, 0x64432143, 0x58835544, 0x97eefe2e, 0x51e1df97, 0x51214872, 0x50825d33, 0x490a01fc, 0x01335b7d,
-    0x5b90677c, 0x2645052a, 0x38567c4f, 0x0e3b5165, 0x71573809, 0x5b6b2802, 0x391f60fe, 0x3fd9fd50, 0xfe1a3958, 0x5e381722, 0x08008200, 0x71000194,
-    0x7604ecff, 0x29005a05, 0x2d40a400, 0x46012739, 0x661d561d, 0x1c66031d, 0x01033601, 0x1f301f20, 0x701f6002, 0x1fa0021f, 0x201f1f01, 0x48241d40,
-    0x0b0a2020, 0x010ab00b, 0xc0ffb80a, 0x0c094540, 0x2b0a0a48, 0x00860076, 0x305b0002, 0x50154015, 0x15000315, 0x15021510, 0x1a561a46, 0x1a5f2502,
-    0x041a2020, 0x0a200a10, 0x0a600a30, 0x30050a70, 0xd00a800a, 0x040ae00a, 0x10490a0a, 0x05021059, 0x0013105f, 0x335ded3f, 0x3f715d2f, 0xed102f33,
-    0x0982015d, 0x125ded25, 0x822b2f39, 0x33112314, 0x1a832b2f, 0x6c457220, 0x021e2508, 0x023e3233, 0x200a7e43, 0x05fc4b12, 0x07175508, 0x2223032e,
-    0x3a01020e, 0x5c835428, 0x3a4f653f, 0x521c9f15, 0x8d669b74, 0x404187cd, 0x658aca84, 0x194d6f98, 0x49340fa8, 0x7f593c61, 0xa9022652, 0x488ccb83,
-    0x36664e30, 0x69854641, 0x01b86540, 0x01a69e02, 0x375baf01, 0x4142795d, 0x2a44582e, 0x00c78744, 0x02230082, 0x4e00a200, 0x480805d7, 0x0017000c,
-    0x75454061, 0x02028502, 0x108a107a, 0x80177002, 0x17140217, 0x17641724, 0x8f0f7f03, 0x0f1b020f, 0x0f6b0f2b, 0x010b3403, 0x3b010a34, 0x5a000103,
-    0x0da00d00, 0x190d0d02, 0x06005a14, 0x06020610, 0x03075f13, 0x071f4214, 0x4c07e04e, 0x8f490ce6, 0x05144205, 0x34073808, 0x012b022e, 0x12323311,
-    0x98506504, 0x8efe8cdd, 0xf39e3701, 0x38c055a6, 0x7975ac72, 0x02ced4a2, 0xfffea8b0, 0x450559ae, 0xacfaa24d, 0x3979c087, 0x0a01f3fb, 0x84010000,
-    0x05623cb3, 0x000b0045, 0x073b405a, 0x48140a40, 0x0a000707, 0x0a000303, 0x0d0a0a01, 0x485a0905, 0x082b05ae, 0x3f050f5f, 0x8f057f05, 0x826f0405,
-    0x059f2504, 0x05df05bf, 0x09270082, 0x03015f04, 0x42005f09, 0x712208c7, 0xc842ed72, 0x2f332c08, 0x2f391211, 0x3330312b, 0x82152111, 0x330384a8,
-    0xfd9703a2, 0xfd9c0228, 0x05010364, 0x5afe9c45, 0x9c33fe9a, 0xc2248782, 0x3d040000, 0x092c8782, 0x2d404700, 0x08060202, 0x05010b08, 0x3c060b41,
-    0x013f5f04, 0x018f017f, 0x6f013f03, 0x03019f01, 0x29154001, 0x05010148, 0x03075f00, 0x22798205, 0x8212ed3f, 0x895d2066, 0x05215579, 0x23207484,
-    0x012f0582, 0xfda40281, 0x7b03bf5c, 0x12fea904, 0x82e3fd9e, 0x08d34277, 0x64824f20, 0x00294008, 0x084a4088, 0x1e150102, 0x1e751e25, 0x55041e85,
-    0x27270112, 0x15af250a, 0x14151501, 0xc05a0014, 0x0225d025, 0x258f257f, 0x01250002, 0x362b2525, 0x861d761d, 0x041db61d, 0x0a305b1d, 0x51500a40,
-    0x210807d3, 0x28285f27, 0xffb80f20, 0x0d0e40f0, 0x5f184811, 0x0f15150f, 0x055f2004, 0xed3f0013, 0x102f333f, 0x99822bed, 0x2005bb4e, 0x2909825d,
-    0xed5d5d5d, 0x2f332f32, 0xb084115d, 0x0f820020, 0x2d462520, 0x09ae4208, 0x0805ba4e, 0x33121056, 0x37023e32, 0x21352111, 0x5f244d04, 0x864e8974,
-    0x3e4082c6, 0x6489c882, 0x184b6f97, 0x6f8b26ab, 0x234f7e5a, 0x5330aca9, 0xfe0d3143, 0x85df01db, 0x1e2d3618, 0x0101ba69, 0x0101a799, 0x59345aaf,
-    0x6e384579, 0xc7874579, 0xfef4fe82, 0x191711ea, 0xa0500109, 0x2f070342, 0x0045052a, 0x4057000b, 0x085a0b3c, 0x002f001f, 0x08058049, 0x006f0529,
-    0x008f007f, 0x000400bf, 0x03070d00, 0x0104705a, 0x04100400, 0x04b004a0, 0x5f020404, 0xa0010750, 0x0207b007, 0x45090707, 0x3923099f, 0x85715d2f,
-    0x059f4fe3, 0x31ed332a, 0x21112130, 0x33112311, 0x20080582, 0x6b031133, 0xbfbff6fd, 0x02bf0a02, 0x0591fd6f, 0x02cafd45, 0x00bbfa36, 0x00010000,
-    0x040000ca, 0x2e878401, 0x06384059, 0x040e0106, 0x00000707, 0x82700e09, 0x5a042f1b, 0x093f090f, 0x099f098f, 0x5f094f04, 0x0a827f09, 0xdf09cf39,
-    0x09100609, 0x0c090901, 0x5f08040d, 0x0b031207, 0x0003005f, 0x8232ed3f, 0x12112202, 0x82888201, 0x5dc42f89, 0x3301112b, 0x4d102f18, 0x312f32e4,
-    0x89421330, 0x82352006, 0x03ca3592, 0x01c4fe37, 0x01c9fc3c, 0x05c4fe3c, 0xf3fb9c45, 0x0d049c9c, 0x6f828a82, 0xecffb024, 0x8b82da03, 0x4b00153d,
-    0x751065b7, 0x03108510, 0xe8ffb80b, 0x110d2240, 0x08131348, 0x11115a00, 0x83801708, 0x08003b7c, 0x08020810, 0x03145f13, 0x09055f0e, 0x00130509,
-    0x102f333f, 0x01ed3fed, 0xdb415d2f, 0x41ed2006, 0x2b2805df, 0x0e14015d, 0x26222302, 0x08079353, 0x3521112a, 0x33da0321, 0xab629665, 0x0abb23cc,
-    0x29493a2a, 0xc9fe6968, 0xa401f501, 0x3e73a364, 0x401fc0b2, 0x8f1d3c5d, 0x9c09038a, 0x2007a741, 0x089382cb, 0x97000b48, 0x0a743440, 0x46020a84,
-    0x660a560a, 0x0764030a, 0x07840774, 0x01008d03, 0x007b006b, 0x59004902, 0x0a390200, 0x010a1401, 0x110b2001, 0x0b010a48, 0x09820972, 0xffb80902,
-    0x0b2d40e0, 0x0908480f, 0x00090910, 0x0282100b, 0x0b020b39, 0x03070d0b, 0x1004005a, 0x02040204, 0x76010a07, 0x02078607, 0x41080107, 0x39250ad1,
-    0x1133115d, 0x22cf8233, 0x821132ed, 0x333835d2, 0x33382f33, 0x39115d2b, 0x312b0039, 0x015d5d30, 0x005d5d5d, 0x21240583, 0x23110701, 0x21082b82,
-    0x01093301, 0x19feeb03, 0x02bfbfa3, 0x08fee13c, 0x7e024502, 0x052bfea9, 0x025ffd45, 0xfcc4fda1, 0xcf8300f7, 0x0000ed24, 0xcf824c04, 0x26000526,
-    0x04041640, 0x2f248582, 0x02003f00, 0x22057144, 0x44030301, 0x77820656, 0x41415d20, 0x2b848205, 0xed152111, 0x05a002bf, 0x9c57fb45, 0x81204383,
-    0x4b204382, 0x2c334382, 0x00b99900, 0x40e8ff1e, 0x48110d13, 0x1e361e26, 0x82182a02, 0x2a292f09, 0x0c022a39, 0x40f0ffb8, 0x48110b19, 0x0483100d,
-    0x24240c2f, 0x2a5c2c1c, 0x1c194000, 0x2e000048, 0x341d831e, 0x00110a0d, 0x5c1b1e4c, 0x1c101c00, 0xffb81c02, 0x2d28b3c0, 0x2a078348, 0x1e180940,
-    0x15061c48, 0x82241d15, 0x0c402b15, 0x2448110e, 0x1d2a0d0d, 0x8e481c03, 0x2f392306, 0x1d412b33, 0x2b590805, 0x32ed5d2b, 0x2f39122b, 0x11ed332b,
-    0x33331139, 0x30312b2b, 0x2b5d2b5d, 0x36341121, 0x06373637, 0x07010e07, 0x2e032303, 0x27262703, 0x011e1716, 0x11231115, 0x011e1333, 0x36171617,
-    0x37013e37, 0x03113313, 0x020201a9, 0x0e111101, 0x89a40e21, 0x0f0e06a6, 0x13120810, 0x08008201, 0xb9eda03c, 0x0c0b1709, 0x0b0c0e0d, 0xe1b90918,
-    0x6a336403, 0x3731332c, 0x26642d35, 0xb6014afe, 0x312f290f, 0x303c3718, 0x33692d34, 0x45059cfc, 0x4d1717fe, 0x2f312c26, 0x194e252b, 0x5f43ea01,
-    0xa2210806, 0x2a040000, 0x13004505, 0x24407800, 0x18005c12, 0x00481109, 0x11901180, 0x11e011d0, 0x01113f04, 0x080982c0, 0x116f0244, 0x118f117f,
-    0x15111103, 0xe8ffb80a, 0x110b2d40, 0x5c070a48, 0x00010870, 0xa0081008, 0x0408b008, 0x01018c08, 0x6901017a, 0x01110101, 0x0b830309, 0x010b7501,
-    0x0b010b66, 0x00120800, 0x5d33333f, 0x05855d5d, 0x5d2f0123, 0x05114171, 0x715d5d2a, 0xed2b3371, 0x01213031, 0x0126f888, 0x012e2726, 0xf3821135,
-    0xfd442308, 0x030404f8, 0x02deaa05, 0x04040510, 0x6a04ac05, 0x59262d2b, 0x0594fc27, 0x288efb45, 0x3362272e, 0xc2846003, 0x02003708, 0xecff6600,
-    0x5a056604, 0x1d001100, 0x56407900, 0x1d861d76, 0x011d3402, 0x19861976, 0x01193402, 0x17891779, 0x01173b02, 0x13891379, 0x01133b02, 0x45011056,
-    0x735a0110, 0x5b002a0e, 0x1201125f, 0x481c1940, 0x2f078200, 0x5b181f12, 0x10010a50, 0x150a010a, 0x1b040f5f, 0x4406ae45, 0x122505c2, 0x2b5d2f39,
-    0x0c774771, 0x5d20de82, 0x0810555a, 0x10030043, 0x02222302, 0x33121011, 0x66041232, 0x78bf8446, 0x4080c07f, 0x7cbf8244, 0xc90801f7, 0x9c9c989e,
-    0x94a3999e, 0xfeada902, 0x5e59b1fa, 0xa70501b3, 0xac0201ad, 0xfea5fe56, 0x010e01aa, 0xfef9fe07, 0x220182f2, 0x821801ec, 0xa22508e3, 0x5f040000,
-    0x0e004505, 0x5b001900, 0x17663e40, 0x86007601, 0x0f490200, 0x0f690f59, 0x7f5a0003, 0x020f8f0f, 0x27bf840f, 0x0f0f010f, 0x5a07141b, 0x2e099b41,
-    0x40145f06, 0x14481109, 0x5f130714, 0x47070309, 0x9647081e, 0x5d2b2209, 0x055a4aed, 0x554a0120, 0x11232605, 0x021e3221, 0x08504a07, 0x5f042d08,
-    0x7bb6793b, 0x01bfe7fe, 0x7cba7dcc, 0xa4a4c03e, 0x7952fef6, 0xb103264f, 0x48789b54, 0x4505fefd, 0x5e956a3a, 0xedfd817d, 0x00664a2b, 0x4c08af82,
-    0x047dfe66, 0x005a0571, 0x002c0020, 0x3562408b, 0x852c752c, 0x2835032c, 0x28852875, 0x7a263a03, 0x03268a26, 0x227a223a, 0x6903228a, 0x89117911,
-    0x044a0311, 0x4602045a, 0x021f561f, 0x1c561c46, 0x145a0502, 0x5b000b0b, 0x01215f21, 0x3bd68421, 0x21140121, 0x272e2114, 0x0119505b, 0x19011910,
-    0x041e5f24, 0x145f2a05, 0x5f600813, 0x0027f282, 0x3fed5d2f, 0x413f33ed, 0x392907a3, 0x2b5d2f2f, 0x32ed1071, 0x062e612f, 0x00845d20, 0x0461df83,
-    0x22232709, 0x2e27022e, 0x065c3503, 0x0eb04105, 0x8d623335, 0x6586295a, 0x2617401c, 0x8155315b, 0x701b4661, 0x413871a8, 0x933411be, 0x166daceb,
-    0x0508727e, 0x330d0986, 0x0b578a5f, 0x9cf9b267, 0x2017c941, 0x06cb4100, 0x05994e08, 0x00110045, 0xb997001b, 0xf0ff1a00, 0x4d000fb3, 0xe0ffb810,
-    0x110f2340, 0x01894c00, 0x01000b01, 0x110e2000, 0x10110048, 0x04011111, 0x10100110, 0x860b7603, 0x5a0b020b, 0xc0ffb812, 0x18153640, 0x8f127f48,
-    0x12000212, 0x1d121201, 0x05ac4516, 0x35058347, 0x1f5f0210, 0x02167f16, 0x166f163f, 0x16ef169f, 0x00161604, 0xba455f15, 0x12ed2508, 0x715d2f39,
-    0x20052159, 0x240b8332, 0x5ded2b5d, 0x30138211, 0x382f3233, 0x5d5d2b33, 0x002b3031, 0x2301212b, 0x05044211, 0x1415cb08, 0x0107020e, 0x01293403,
-    0x3e322111, 0xfebd0302, 0x01bfee92, 0x77b378e2, 0x8254273b, 0xf890015b, 0xf0fed0fe, 0x71531801, 0x3f021f45, 0x4505c1fd, 0x578a6133, 0x4c677b3e,
-    0x03abfd0f, 0x2afedfcd, 0x005a4328, 0x00010000, 0x04ecff4f, 0x005a0568, 0x40b0003f, 0x013d3479, 0x4b012d6d, 0x021d5b1d, 0x6001106b, 0x3e74010c,
-    0x74023e84, 0x3d40013d, 0x86023d50, 0x3c44013c, 0x76023c54, 0x02378637, 0x27842774, 0x74210402, 0x03218421, 0x89010b54, 0x077a0107, 0x01028b01,
-    0x2a010279, 0x0029295a, 0x0113005a, 0x411f1313, 0x087f5a09, 0x0802088f, 0x1f005a34, 0x1f021f10, 0x2f051334, 0x2a2a2460, 0x5f0e0424, 0x50094005,
-    0x8a470209, 0x105d2107, 0x2c057b49, 0x01393912, 0xd6ed5d2f, 0x1211ed5d, 0x20088239, 0x0e355832, 0xc7465d20, 0x25058205, 0x23020e14, 0xa4472422,
-    0x05d24f05, 0xe4662720, 0x32332305, 0x3f4c021e, 0x14152107, 0x7b080b82, 0x6804051e, 0x86c37f3e, 0x24fbfeea, 0x54300cb9, 0x7748557a, 0x6a413055,
-    0x66324485, 0x223d515e, 0x64ac7e48, 0x4471a374, 0x2b0bbc14, 0x50446447, 0x351d426c, 0x3745795b, 0x42596770, 0x55720126, 0xb83a688f, 0x5a3725ae,
-    0x3a1b2441, 0x58463f5a, 0x0d112338, 0x4b35271d, 0x89604365, 0x52292857, 0x33215079, 0x211c3650, 0x3c2d4e39, 0x1220314b, 0x392a1f0e, 0x00006e52,
-    0x004c0001, 0x2505974e, 0x404a0007, 0xfb600731, 0x5a013305, 0x023f020f, 0x029f028f, 0x02cf02bf, 0x5f024f06, 0x0e827f02, 0xdf02cf34, 0x02100602,
-    0x08020201, 0x5f040009, 0x12010305, 0x22493f00, 0x60c6200b, 0x152f0efc, 0xfebec502, 0x04340445, 0x0457fba9, 0x839c9ca9, 0x8e2b086f, 0x3d04ecff,
-    0x19004505, 0x44405e00, 0x15751565, 0x65031585, 0x850f750f, 0x5a00030f, 0x17901780, 0x17e017d0, 0x3f0517f0, 0x82c00117, 0x7f02340b, 0x02178f17,
-    0x0d1b1717, 0x9f0a8f5a, 0x030aaf0a, 0x5b010acf, 0x18230515, 0x4512030b, 0x33280663, 0x5d5d2f01, 0x3912ed71, 0x71200683, 0x21056545, 0xb0661401,
-    0x33112206, 0x06a26411, 0x11352f08, 0x3a3d0433, 0x747ab577, 0xbf3a73ae, 0x50693d19, 0x1d446f53, 0x89ea01be, 0x35387bc2, 0x0387bb75, 0x61adfc6d,
-    0x2828588a, 0x03679059, 0xaf830046, 0x00000a24, 0xaf82c204, 0x00105808, 0x0f554082, 0x48110e20, 0x0f390f29, 0x010f2b02, 0x03860376, 0x64035402,
-    0x03360203, 0x24020346, 0x01000103, 0x0f090f52, 0x1400105e, 0x01001010, 0x09035201, 0x01025e03, 0x03010214, 0x10020902, 0x10100110, 0x8f027f12,
-    0x0f020202, 0x09550302, 0x01094401, 0x46010009, 0x3f2006ea, 0x1131c383, 0x125d2f33, 0xc1001039, 0x872b0587, 0x1887c42b, 0x059e5510, 0x845d0121,
-    0x212b2500, 0x01330123, 0x0809e747, 0x02330126, 0x07fec6c9, 0x104001c9, 0x0d0e0c1d, 0x1e0c0e0c, 0xc93e0110, 0x7afc4505, 0x302a612d, 0x29302d2f,
-    0x86032f62, 0x4351c784, 0x01322c07, 0x2111404c, 0x4d000c08, 0x83101802, 0x0c0b2804, 0xb8104c00, 0x83b4e8ff, 0xb81a3008, 0x1040f0ff, 0x4c001110,
-    0x00111831, 0x8318314d, 0x82142014, 0x2b1d8414, 0xe0ffb823, 0x0f0b1c40, 0x18224c00, 0x10260584, 0x014d000a, 0x2e820b20, 0x83200021, 0x82002034,
-    0x0db42420, 0x844c000e, 0x0a092408, 0x82124c00, 0x1140213b, 0x12211b83, 0x21188328, 0x15832812, 0x27821120, 0x83134021, 0x09223f37, 0x02020932,
-    0x01010904, 0x2b235201, 0x0701b823, 0x01090c40, 0x23010914, 0x22520111, 0x1083221a, 0x1109483d, 0x11090914, 0x31520100, 0x325e312b, 0x32321400,
-    0x52011200, 0x5e141a14, 0x83141213, 0x2b2f0802, 0x13031a09, 0x32013210, 0x09133432, 0x224f222f, 0x2203225f, 0x13311a22, 0x001a2b03, 0x011a2401,
-    0x0301111a, 0x3f001212, 0x115d3317, 0x5d331133, 0x012706f2, 0x2f33112f, 0x4117125d, 0x78411071, 0x08065206, 0x5f5d0025, 0x8d2b015d, 0x30312100,
-    0x21200f83, 0x27068649, 0x030e0706, 0x03230307, 0x22098649, 0x82133703, 0x1703260c, 0x3e321716, 0x080b8202, 0xd0fa0326, 0x0f0e0568, 0x1111070f,
-    0x0f071112, 0x6a050e0f, 0x6dbdd3d0, 0x05050b08, 0x07101004, 0x060e0f0e, 0x066daf6d, 0x71080782, 0x01101007, 0x060c0a06, 0x8301bd68, 0x3f3b3413,
-    0x4d4c461e, 0x3b3f1e46, 0x7dfe1333, 0xbdfc4505, 0x39317c41, 0x1d434533, 0x17373c3d, 0x71fe8f01, 0x3d3b3816, 0x4446431d, 0x03367a66, 0x01000043,
-    0x00002400, 0x4505a904, 0xc8000b00, 0x09095c40, 0x01060b01, 0x03590309, 0x01012902, 0x03010104, 0x01000702, 0x0b040b08, 0x09070206, 0x050a0801,
-    0x1282060a, 0x09026008, 0x02070100, 0x08015201, 0x5e010807, 0x02140702, 0x0a050702, 0x040b5201, 0x5e0b0405, 0x0a14050a, 0x100a0b05, 0x020a200a,
-    0x0a020a02, 0x09000603, 0xb8040804, 0x1840c0ff, 0x04481c0a, 0x40080d04, 0x08481b0b, 0x06030900, 0x04080104, 0x03010a12, 0x3f333f00, 0x39171233,
-    0x112b2f01, 0x822b2f33, 0x39392409, 0x42712f2f, 0x058605dd, 0x1887c424, 0x0b872b10, 0xc0c01024, 0x03838710, 0x08c00822, 0x05830982, 0x0130312e,
-    0x5d005d5d, 0x01095d5d, 0x23010933, 0x25080284, 0x01660233, 0x4dfecd4d, 0xfecddc01, 0xcd8bfe8a, 0x4dfedc01, 0x024403cd, 0xfd7cfd01, 0xfd3d023f,
-    0x02c102c3, 0x07410084, 0xa83d0807, 0x08004505, 0x68409600, 0x06440634, 0x5c030654, 0x073b0107, 0x0902074b, 0x29071907, 0x05530307, 0x44053401,
-    0x00030205, 0x20051005, 0x050c0305, 0x010e0807, 0x050e0204, 0x0401042f, 0x16094506, 0x02100433, 0x0a020201, 0x40030609, 0x60005000, 0x003f0300,
-    0x21708201, 0x12450407, 0x12332705, 0x5d5d2f39, 0x3b4e3333, 0xc6392308, 0x1b45325d, 0x31322705, 0x5d5e5f30, 0x00835d5f, 0x015d0025, 0x83112311,
-    0x023337d8, 0x1cfebcc4, 0x017601cd, 0x4802cd74, 0x4802b8fd, 0x9dfdfd02, 0x55826302, 0x00004924, 0xc3828304, 0x00093208, 0x89264075, 0x08690108,
-    0x77085701, 0x08290208, 0x08490839, 0x14080403, 0x01080208, 0x03020352, 0x1408075e, 0x07030807, 0xc0ffb804, 0x48140fb3, 0x3e078200, 0x0e091d40,
-    0x00070448, 0x03040700, 0x3f012f0b, 0x03014f01, 0x5f040701, 0x08020305, 0x4e12015f, 0x012206e3, 0xe8565d2f, 0x068b4106, 0xc42b8724, 0x74443031,
-    0x01293f05, 0x35210135, 0x21011521, 0xc6fb8304, 0x17fd3203, 0xcefcc203, 0x048f6103, 0xfb8b9c1a, 0xf68200e2, 0xfe9a013d, 0x05bd0357, 0x000700cc,
-    0x021c402f, 0x05090707, 0x8f007ff2, 0x003f0200, 0x8202006f, 0x04002820, 0x050001f5, 0x821b00f5, 0x603f206f, 0x332009a6, 0x11236382, 0x82211521,
-    0x9a013003, 0x91fe2302, 0x57fe6f01, 0xf98b7507, 0x82008ba1, 0x00012600, 0x04ecff73, 0x2d57825a, 0x403f0003, 0x01008b1d, 0x3901007a, 0x52826900,
-    0x0310033f, 0x02850503, 0x66023601, 0x03027602, 0xffb80102, 0x0100b7f0, 0x00020101, 0x3f001900, 0x21d0823f, 0x58663338, 0x315d2d08, 0x33010530,
-    0xfca40301, 0x3503b2cf, 0x82075a66, 0xfe0e242e, 0x84310357, 0x40292eb7, 0x60f20717, 0x02020102, 0x00000409, 0x24628230, 0x0005f504, 0x25b28a01,
-    0x2f391233, 0xb182ed5d, 0xaf823520, 0x01210382, 0x20ad820e, 0x25b58291, 0x5f068b57, 0xb182f88b, 0x8500013d, 0x4604ba01, 0x06004505, 0x2f406300,
-    0x79010585, 0x02048904, 0x8c010405, 0x82290100, 0x007933b7, 0x03010003, 0x06001006, 0x06700610, 0x06040680, 0xbf830806, 0xc1828620, 0xc1820320,
-    0x000f4024, 0x22820103, 0x86821020, 0x01000023, 0x24f68204, 0x322f3333, 0x83cd855d, 0x1238227f, 0x21d68239, 0x04823311, 0x09303124, 0xd5832302,
-    0xb7feac35, 0x0198bafe, 0x7c01cb7a, 0x2303ba01, 0x8b03ddfc, 0x820075fc, 0xff012800, 0x0424fffb, 0x8284ffd1, 0xb40e3876, 0xbb000003, 0xed2f0001,
-    0x312f2f01, 0x21350730, 0xd6040515, 0x836060dc, 0x92013d27, 0x3a03b104, 0x0500b405, 0x0e401a00, 0x03840374, 0x01048002, 0x8c030104, 0x3f009300,
-    0xcd363182, 0x5d30315d, 0x33352501, 0xbe021517, 0xe3c5d4fe, 0x1de6b104, 0x3b8214ef, 0x00023b08, 0x04ecff80, 0x004e0488, 0x00410032, 0x8a3f40a5,
-    0x1e7a0124, 0x69021e8a, 0x893d793d, 0x3625033d, 0x13023635, 0x480c0920, 0x17161706, 0x2d091d02, 0x03093d09, 0x2d152d05, 0xeb820002, 0x30035108,
-    0x4f0c1b46, 0x02385f38, 0x43153838, 0xb8274726, 0x2d40f8ff, 0x270127c0, 0x00473f27, 0x39150115, 0x331b1b51, 0x1f260f2c, 0x262f0226, 0x26ff268f,
-    0x21262603, 0x33102c50, 0x51001250, 0x120c0707, 0x333f0016, 0x10ed2f33, 0x33ed3fed, 0x11715d2f, 0x83061753, 0x4938200c, 0x3324059f, 0x2f32ed33,
-    0x21060157, 0x00825d2b, 0x36322537, 0x010e1537, 0x022e2223, 0x030e2327, 0x35262223, 0x3f023e34, 0x0d4f5b01, 0x1516da08, 0x25161411, 0x3d023e32,
-    0x030e0701, 0x04161415, 0x0e1e0f4d, 0x33264322, 0x03182e49, 0x58441c06, 0xa09e4a72, 0x54a3804f, 0x54371bec, 0x3a513238, 0x0abc0625, 0x6b976437,
-    0xfd2ac9c8, 0x517a53da, 0x6f37be28, 0x6f593859, 0x08700304, 0x51371b08, 0x3b543436, 0x6b96ac20, 0x011f4e89, 0x5e433b04, 0x270f1b3a, 0x40113343,
-    0xbb2b4e6b, 0x502efeb1, 0x603f0651, 0x04593574, 0x5b300f01, 0x0064524c, 0xffb30002, 0x054204ec, 0x002000cc, 0x40610034, 0x8a027a42, 0x33440202,
-    0x33643354, 0x5b234b03, 0x03236b23, 0x3501053a, 0x1f05011c, 0x1f751f15, 0x00041f85, 0x01216047, 0x2b362121, 0x00461406, 0x02138013, 0x1a502613,
-    0x0013101e, 0x5030150d, 0x00160306, 0x3fed333f, 0x2504823f, 0xed5d2f01, 0xd2423232, 0x5d002106, 0x01290084, 0x22230210, 0x14232726, 0x053d6c0e,
-    0x1133112d, 0x06070614, 0x013e3307, 0x61123233, 0x04320f1a, 0x74bdcb42, 0x020230aa, 0xae010303, 0x01020201, 0x008201b4, 0x30044a08, 0xc4c375a9,
-    0x5f3f1eba, 0x496a4242, 0x69492828, 0x40603f41, 0xfe220221, 0x56e6fee4, 0x2e371a62, 0x2b090421, 0x0427483c, 0x1d59feed, 0x171a1639, 0xebfe5f69,
-    0xa170e1fe, 0x672d3167, 0x9e777ca9, 0x662e275f, 0x000100a3, 0x08fb8282, 0x4e043846, 0x9d002500, 0x16645240, 0x01106401, 0x1e891e79, 0x011a6402,
-    0x15541544, 0x5b114b02, 0x08750211, 0x0b020885, 0x1c0a0a47, 0x4f1b3f47, 0x9f1b8f1b, 0x051baf1b, 0x1bdf1bcf, 0x60031bff, 0x1b1b011b, 0x00471327,
-    0x2a084d82, 0x00011b70, 0x601b101b, 0x801b701b, 0x061bc01b, 0xc0ffb81b, 0x1e1b1c40, 0x181b1b48, 0x0e162150, 0x0b1f0550, 0x0b8f0b7f, 0x82400b03,
-    0x0b0b2914, 0x3f001005, 0x5d2b2f33, 0x20055742, 0x09186a2b, 0xed715d22, 0x260aef4b, 0x135d5d01, 0x4b023e34, 0x5f5506ce, 0x1e142105, 0x36200f82,
-    0x08062f58, 0x5682029d, 0x625fb48d, 0x0d466f9a, 0x768010c0, 0x1f477556, 0x5575471f, 0xbe118e6c, 0x9e724409, 0x77bf8964, 0xa31e0236, 0x323580d8,
-    0x0e447657, 0x6937695b, 0x9f64649b, 0x6d6a3a6e, 0x5e7c430c, 0xcd975639, 0x8a000200, 0x1904e6ff, 0x1f00cc05, 0x6b003300, 0x22444b40, 0x22642254,
-    0x5b324b03, 0x03326b32, 0x016a013a, 0x010a3502, 0x07150705, 0x07850775, 0x1a040a04, 0x8a047a04, 0x46130404, 0x1250002a, 0xa0129001, 0x12120212,
-    0x00472035, 0x1a060106, 0x2f001215, 0x10080b50, 0x42005025, 0x33210610, 0x09ac6eed, 0x33337122, 0x2109a450, 0xd2820e25, 0x1011022f, 0x17163221,
-    0x34263433, 0x33113526, 0x25df8211, 0x032e2317, 0xe8840135, 0x0808a95c, 0x5e03025e, 0xca79a231, 0x798801be, 0x010231a3, 0x0201b401, 0x01ac0102,
-    0xfd020304, 0x603d1de1, 0x496b4543, 0x6a482525, 0x3f604045, 0x5f69ae20, 0x18011601, 0x62563602, 0x2d322a05, 0xfba30109, 0x3c482713, 0x2404092b,
-    0x011a3a32, 0x68a0706c, 0xa8693031, 0x609d7478, 0xa3662e2a, 0x02000000, 0x08057f64, 0x004e0441, 0x002b0020, 0x64654090, 0x03640124, 0x59294901,
-    0x03296929, 0x24592449, 0x851d7502, 0x1c77021d, 0x78021c87, 0x020e880e, 0x0d8a0d7a, 0x54024402, 0x03026402, 0x1f1f4727, 0x0acf490b, 0x57ff0adf,
-    0x2d080561, 0x0a030a60, 0x00262d0a, 0xe0150047, 0x00150215, 0x05262650, 0x101a5021, 0xdf105005, 0x020aef0a, 0x0a010a80, 0x0016100a, 0x5d2f333f,
-    0x585b105d, 0x088e5806, 0x02425d20, 0x5d5d220b, 0x41028201, 0xf541060b, 0x42352007, 0x9d080614, 0x2201011d, 0x2107020e, 0x4201032e, 0x4a714c26,
-    0x324a5d37, 0x40109e0c, 0x7368986a, 0x4f437eb6, 0x8360af86, 0xfe3372b5, 0x56652e25, 0x4802033b, 0x624d3408, 0x8f55f701, 0x2c193967, 0x2d2d243d,
-    0x482f495b, 0x9c8dd58e, 0x543882d4, 0x1880d497, 0x4a1dd201, 0x7e5e627f, 0x0000204c, 0x8a000100, 0x4b040000, 0x1f00cc05, 0x00b95e00, 0x40f0ff0a,
-    0x480c0936, 0x0246011d, 0x0501053f, 0x1e020605, 0x022f111e, 0x026f023f, 0x028f027f, 0x14400205, 0x02004825, 0x02110201, 0x17212011, 0x3d820c50,
-    0x051d502b, 0x0015010f, 0xed333f3f, 0x05dd6232, 0x2f2f392c, 0x115d2b5d, 0x33112f33, 0xfb822f33, 0x3031322b, 0x11012b00, 0x35211123, 0x21d68721,
-    0xfa5a1517, 0x1d390805, 0x02152101, 0xfafeb444, 0x642d0601, 0x501d729f, 0x12154750, 0x13484f48, 0x1f406242, 0xac03eb01, 0xac0354fc, 0x8f65198e,
-    0x06032a5b, 0x03910408, 0x14030506, 0x0a4b5e36, 0x08be828e, 0x00020083, 0x0458fe8f, 0x004b041e, 0x00450031, 0x7a3e409c, 0x02308a30, 0x45013f66,
-    0x650c550c, 0x3a4b030c, 0x3a6b3a5b, 0x01213503, 0x1d151d05, 0x1d851d75, 0x1a170a04, 0x8a177a17, 0x462f0417, 0x0e502232, 0xa00e9001, 0x0e0e020e,
-    0x4606471a, 0xf0ffba05, 0xc0ff0500, 0x150f2840, 0x3c050548, 0x011ab047, 0x1ad01a00, 0x0f281a02, 0x1f225037, 0x0f504110, 0x50091515, 0x30062000,
-    0x06060206, 0x3f001b00, 0x82e08332, 0x200283fa, 0x05c37601, 0x35462b20, 0x0c074306, 0x22015d25, 0x6427022e, 0x3d2106ad, 0x09b85f01, 0x32330230,
-    0x34331716, 0x3337023e, 0x1115030e, 0x30660614, 0x027c080f, 0x63895a67, 0x11b80d3d, 0x5b395c71, 0x13022341, 0x486e533b, 0x2b5c9066, 0x6e985f2b,
-    0x032da771, 0x01050303, 0x020201ab, 0x3021d401, 0x4335654f, 0x1e1e4062, 0x3542613f, 0xfe315066, 0x62472658, 0x514b193c, 0x56784b22, 0x3a4c28c2,
-    0xca864223, 0x8dcc8387, 0x1961694a, 0x0328373e, 0x493c2b09, 0xe3c6fc27, 0x71cf03e5, 0x2d2c639e, 0x75719d63, 0x2b275e9c, 0x01009b60, 0x0000b900,
-    0x08063344, 0x27403f2f, 0x0e800e70, 0x140d0402, 0x840d740d, 0x4611040d, 0x05211212, 0x00461e02, 0x021f801f, 0x15111f1f, 0x0b055018, 0x00000010,
-    0xed333f3f, 0x059f573f, 0x39123222, 0x2106d750, 0xd8823313, 0x3e33072b, 0x1e323303, 0x23111502, 0x07246711, 0x23113608, 0x0306b5b9, 0x52401803,
-    0x82534069, 0x21b52f5a, 0x3b30503b, 0xb42c4d67, 0x7afecc05, 0x2f2e6532, 0x2c1d354c, 0xfd65905c, 0x50b7022f, 0x2d183d67, 0xfd517d55, 0x06fb418d,
-    0x00002608, 0xcc056504, 0x0d000900, 0x28404800, 0x04050707, 0x4a0b0504, 0x01010c0c, 0x05a04600, 0x0e050501, 0x0a300b0f, 0x058c4360, 0x08500728,
-    0x5004000f, 0xb14a1503, 0x5d2f2205, 0x059e7371, 0x32ed7129, 0xed2f322f, 0x822f3311, 0x303128ae, 0x21152125, 0x82112135, 0x35273a03, 0xe9021533,
-    0x2afc7c01, 0xc1fea601, 0xc8c8f301, 0x038e8e8e, 0xc0d28e1e, 0x247f85c0, 0x0357fe75, 0x087f8244, 0x1d001931, 0x2c404b00, 0x13851375, 0x1a030a02,
-    0x18180203, 0x4a1a150a, 0x46001d1d, 0x15011500, 0x0a1f1e15, 0x80011a30, 0x1b1a011a, 0x0f185017, 0x4a055010, 0x2f2005c5, 0x01208382, 0x01528482,
-    0x08795b06, 0x76500520, 0x35272806, 0x3233031e, 0x8735023e, 0x032d088d, 0x9c764744, 0x4c522956, 0x3c161841, 0x38284f48, 0xfe294861, 0xc84b0269,
-    0x976d1cc8, 0x0c072a5f, 0x058c090f, 0x1c070a0c, 0x03435f3d, 0x22a886c5, 0x41ec0001, 0x4c080627, 0x40af000b, 0x7607662c, 0x03078607, 0x09740964,
-    0x7b030984, 0x02018b01, 0x01590149, 0x49030169, 0x02085908, 0x007b006b, 0x4903008b, 0x02005900, 0xe8ffb80a, 0x110b2840, 0x080a0148, 0x09441009,
-    0x09020954, 0x0b9f0009, 0x0bbf0baf, 0x05af5903, 0x0b0b1031, 0x4603070d, 0x04010400, 0xb3c0ffb8, 0x8448251f, 0x1b162107, 0x40390784, 0x48110d11,
-    0x0a070204, 0x08010701, 0x0400050f, 0x3f001500, 0x393f3f32, 0x07a55839, 0xed5d2b3b, 0x2f331132, 0x335d5d38, 0x385d2f33, 0x31393933, 0x5d5d2b30,
-    0x5d5d005d, 0x59048201, 0x21080cc3, 0x8492fe92, 0xdb01b4b4, 0x0149fed3, 0x62f301ce, 0xcc056ffe, 0x0d0261fc, 0x97fd2ffe, 0x01000000, 0xe7828600,
-    0xcc055c2e, 0x33000900, 0x08081a40, 0x05040405, 0x24080942, 0x50070b0a, 0x411f8208, 0x112808ff, 0x2f390112, 0x2f32ed71, 0x2111f841, 0xf441e002,
-    0x01df2806, 0x8e8e8ed5, 0x828eb004, 0x205f825e, 0x083f8263, 0x4e046475, 0x8e003900, 0xff2a00b9, 0x0f09b3d0, 0xffb82048, 0x095940d0, 0x3922480d,
-    0x0d000048, 0x2fbf482e, 0x2fff2fcf, 0x702f6003, 0x2f1f022f, 0x2f3f2f2f, 0x5f2f4f03, 0x8f2f7f2f, 0x2f10042f, 0x2f302f20, 0x3b2f2f03, 0x00480c19,
-    0x020d100d, 0x0f010df0, 0x020d3f0d, 0x0ddf0dcf, 0x010d1002, 0x5006350d, 0x03282219, 0x0f13101f, 0x15000d2f, 0x32323f00, 0x6e173f3f, 0x5d230558,
-    0x61727171, 0x09820596, 0x12ed712c, 0x39ed2f39, 0x2b003031, 0x4f43212b, 0x2b0a830a, 0x031e3327, 0x033e3315, 0x17163233, 0x320f7443, 0x02111506,
-    0x2b1b0c13, 0x26342120, 0x0201a914, 0x83950102, 0x0d023304, 0x2e463324, 0x02135758, 0x48382b12, 0x34543d2f, 0x2583a817, 0x4d422308, 0x6a4fae02,
-    0x5d331b41, 0xa1fd5183, 0x4b225303, 0x05073043, 0x14383529, 0x1f364727, 0x492f6460, 0x9f431a32, 0x08278406, 0xfda8a833, 0x0100008d, 0x0000b300,
-    0x4e041904, 0x3d002500, 0x22702640, 0x04022280, 0x74211421, 0x04218421, 0x00004625, 0x460c1927, 0x0d800d00, 0x06190d02, 0x85ec8350, 0x3f3f22eb,
-    0x053a44ed, 0x99083944, 0x021e25da, 0x64031115, 0x83082f44, 0x01aa2ec4, 0x03020302, 0x6a554118, 0x57805342, 0x0b31442d, 0x2c23b987, 0x44143b39,
-    0x00200953, 0x02260082, 0xecff8200, 0xab824904, 0x000f4308, 0x40590023, 0x0122643d, 0x22562246, 0x011c6402, 0x1c561c46, 0x01186b02, 0x18591849,
-    0x01126b02, 0x12591249, 0xaf470002, 0x10000110, 0x10601010, 0x25101003, 0x0a00471a, 0x50150a01, 0x501f100d, 0x9e4e1605, 0x56ed2007, 0xb46a05ed,
-    0x084c540a, 0x4b121021, 0x7408130b, 0xb57e4349, 0x7db16d72, 0xf4e8fd44, 0x4d2bbdee, 0x6e41406a, 0x4f2f2d4f, 0x6f413969, 0x1e022d50, 0x458cd38e,
-    0x8fd38c44, 0x19011701, 0xe6feeafe, 0x2762a47e, 0x7ba46329, 0x2862a57e, 0x00a66227, 0xb3000200, 0x420457fe, 0x28005004, 0x65003c00, 0x3b644440,
-    0x563b4601, 0x2b6b023b, 0x592b4901, 0x2606022b, 0x26762616, 0x34042686, 0x083b0121, 0x89037901, 0x3bcb8203, 0x29012960, 0x1e333e29, 0x12004611,
-    0x12021280, 0x241e502e, 0x110f1810, 0x0a50381b, 0xed4bce83, 0x079e561a, 0x27022e25, 0x45031e23, 0x7b4206d6, 0x021e2109, 0x2b10dc6e, 0x965c2842,
-    0x5664376e, 0x01051743, 0x59080082, 0x020201b5, 0x0301af01, 0x19040303, 0x3e64503f, 0x285c966e, 0x613b18ba, 0x4d683b49, 0x6a48252d, 0x3b624944,
-    0x7b220219, 0x145596d0, 0x0232462c, 0x1d3a2e1f, 0x030559fe, 0x2a3b4a28, 0x34250309, 0x4c341a3c, 0x93501731, 0x9c647dce, 0x6125386b, 0x9d7387ac,
-    0x6e392a61, 0x008200a2, 0x00025b08, 0x0457fe8a, 0x004a041a, 0x00380024, 0x4b474066, 0x6b2d5b2d, 0x3144032d, 0x31643154, 0x011c3a03, 0x05010335,
-    0x75241524, 0x04248524, 0x201a200a, 0x208a207a, 0x25461204, 0x01135005, 0x13a01390, 0x3a131302, 0x2200472f, 0x50342201, 0x12161f19, 0x05502a1b,
-    0x3f001000, 0xff4ced32, 0x39122307, 0xe6475d2f, 0x3201230c, 0xcd47021e, 0x5d23200a, 0x2322056d, 0x905b030e, 0x09fc7a05, 0x32051264, 0x66421102,
-    0x02183d4f, 0x01050303, 0x020201af, 0x8201b501, 0x023b0800, 0x65513f19, 0xc3beca41, 0x4a281202, 0x61444169, 0x3c1c1d3d, 0x683b4560, 0x4a042d4e,
-    0x2f452e16, 0x23313919, 0x44280903, 0x36fb4362, 0x3a1ab701, 0x331c1e1a, 0x011a354e, 0x82150119, 0x1d4e0803, 0x9e77e0fd, 0x6933285e, 0x9f6a6ea1,
-    0x6327366a, 0x000100ab, 0x040000f2, 0x004e0415, 0x4046001f, 0x8806782b, 0x1a040206, 0x04021a14, 0x02191419, 0x16211f1f, 0x100a4609, 0x6f0a1f10,
-    0x8f0a7f0a, 0x160a040a, 0x101c5203, 0x15090f10, 0x93433f00, 0x7c332606, 0xed10182f, 0x42f18232, 0x012005d3, 0x4706c670, 0x272305cc, 0x44031e33,
-    0x3b08056a, 0x15041716, 0x543e672f, 0xb4315c86, 0x0612100c, 0x0e0f07ab, 0x1c05020a, 0x5274553e, 0x032a6c38, 0x440b0896, 0xfe589c75, 0x38bd0204,
-    0x18526774, 0x44433e18, 0x46643e1d, 0x00070a26, 0xa72ea782, 0x2404ecff, 0x38004b04, 0x58408500, 0x445d186c, 0x6c500805, 0x366a0117, 0x83317301,
-    0x31470231, 0x24023157, 0x1d2a0137, 0x1a030a01, 0x20050203, 0x28022015, 0x00272749, 0x1f151548, 0x0a490b3a, 0x00482f0a, 0x701f601f, 0x041f801f,
-    0x05152f1f, 0x2022502d, 0x02289028, 0x10222828, 0x0b055010, 0x0016050b, 0x24051561, 0x105d2f33, 0x068a59ed, 0xed2f3323, 0x4bdb8211, 0x5d200d96,
-    0x200ae142, 0x068b4737, 0xb95b3420, 0x4d362006, 0x032206b1, 0x7e592223, 0x038d0805, 0x703b2404, 0x975e69a3, 0x9f124d72, 0x624b350c, 0x48633a39,
-    0x79583329, 0x637e4047, 0x4fc9d43d, 0x0e496c8a, 0x432e07a2, 0x2bf52e54, 0x41416c4e, 0x01497189, 0x557a4c35, 0x673e1b2e, 0x41371f4c, 0x29110b22,
-    0x3d323041, 0x11131e2a, 0x4d644128, 0x3f1da693, 0x2d144563, 0x970c2138, 0x1b26392e, 0x462a1011, 0x0100006d, 0xf0ffbe00, 0x5405f903, 0x58001b00,
-    0x186a3640, 0x188a187a, 0x09281803, 0x0606480e, 0x051d1212, 0x901a4609, 0x08008201, 0x401a022a, 0x1a482512, 0x480e0b40, 0x1a011a00, 0x1617500c,
-    0x01500008, 0x01050303, 0x333f000f, 0xed102f33, 0x01ed3f32, 0x2b2b5d2f, 0x3c06a74b, 0x332f3912, 0x0030312f, 0x35135d2b, 0x11331333, 0x11211521,
-    0x32331614, 0x1537023e, 0x08e8820e, 0x11352632, 0x783aaabe, 0x50feb001, 0x55286155, 0x1618454f, 0x36665746, 0xac03a2a2, 0xfe1a018e, 0x74fd8ee6,
-    0x0a074c4f, 0x0689050c, 0x890a0e10, 0x009f0294, 0x3708af83, 0x04ecffb9, 0x003a041f, 0x40450025, 0x8f227f2c, 0x217b0222, 0x0a02218b, 0x2a211a21,
-    0x1c390321, 0x460e1901, 0x01270b0b, 0x80240046, 0x19240224, 0x161f5006, 0x000c1514, 0x3220a582, 0x20067d42, 0x219a82ed, 0x794233ed, 0x015d2205,
-    0x098c5911, 0x20084b4e, 0x2ea08323, 0x1135022e, 0x35176d01, 0x67403f55, 0x46b52749, 0x1a380913, 0x466a523e, 0x2754825a, 0x52fd3a04, 0x1b416a4f,
-    0x517d552d, 0xadfc7302, 0x4605cf46, 0x91230915, 0x83d10264, 0x004524b3, 0x82870400, 0x102308b3, 0x42409400, 0x49010456, 0x020e590e, 0x0f5b0f1b,
-    0x010f0902, 0x03550325, 0x16030602, 0x01280203, 0x59020168, 0x4b2005b3, 0x210bb359, 0xb359024b, 0x10703907, 0x10021080, 0x40c0ffb8, 0x480e0a1e,
-    0x02121010, 0x480e0b40, 0x0f020f02, 0x2805be59, 0x093a092a, 0x01000902, 0x08ae6015, 0x5906ec56, 0x5d201bc5, 0x3b05c559, 0x033e1703, 0x02330137,
-    0x4ffed5cb, 0x080c01ca, 0x06111412, 0x15141306, 0xc9140108, 0x4030e882, 0x3f443f16, 0x423f1515, 0xc202163f, 0x15000100, 0xb820d382, 0x3208d382,
-    0x4052012a, 0x841e7410, 0x1e46021e, 0x24021e56, 0x021e341e, 0xe0ffb81d, 0x18134a40, 0x011d9048, 0x1d751d65, 0x24031d85, 0x021d341d, 0x1d161d06,
-    0x82201c02, 0x1c9f3a18, 0x7b1c6b01, 0x031c8b1c, 0x1c2d1c1d, 0x0b031c3d, 0x1b7b011c, 0x1b021b8b, 0x2fd08220, 0x110d200e, 0x2a0e1a48, 0x030e3a0e,
-    0x0d010e0b, 0x1f204e83, 0x902c3582, 0x0d25010d, 0x0d750d35, 0x01040d85, 0x01294684, 0x3a012a01, 0x03017a01, 0x20238300, 0x08368270, 0x2500156f,
-    0x03003500, 0x01000603, 0x1052010e, 0x0f4b1016, 0x0f0f140e, 0x52010d0e, 0x4c1c161c, 0x07140d07, 0x5201010d, 0x4c1d231d, 0x07140107, 0x00071d01,
-    0x23295201, 0x002a4b29, 0x23002a14, 0x0f031607, 0x2a742a14, 0x2a032a84, 0x2a0f2c2a, 0x32010766, 0x07020107, 0x29161c1c, 0x0f03102a, 0x7516230f,
-    0x02168516, 0x00010d16, 0x3f00150e, 0x3c008233, 0x3f33115d, 0x39123317, 0x5d5f332f, 0x2f012f5d, 0x5d2f3311, 0x87391712, 0xc42b872b, 0x08b35910,
-    0x5b188721, 0x5f230e42, 0x875d2b5d, 0x20098202, 0x850c845d, 0x23212b04, 0x27012e03, 0x07062726, 0xc559010e, 0x15032806, 0x013e3736, 0x63331337,
-    0x34210557, 0x05c3593e, 0x088fcc26, 0x090b0914, 0x85080282, 0xcb940a14, 0x035db2b7, 0x0b080b0b, 0x0714090b, 0x0682c187, 0x0a0b0913, 0x030c0c08,
-    0xd701b065, 0x2520451b, 0x1f242525, 0x2dfe1f47, 0xa1fd3a04, 0x5c605518, 0x23292d1d, 0xa8011449, 0x471457fe, 0x1e2e2923, 0x19565f5a, 0x00005f02,
-    0x5e000100, 0x6d040000, 0x0b003a04, 0x7040b900, 0x76010447, 0x02078607, 0x01790139, 0x76030189, 0x08190108, 0x0a020859, 0x03070902, 0x060b0608,
-    0x04090201, 0x00050803, 0x09820a05, 0x04070236, 0x01090203, 0x02030852, 0x094b0803, 0x09091402, 0x52010002, 0x4b262682, 0x05140005, 0x25820600,
-    0x04040723, 0x08b58203, 0x700b1026, 0x030b800b, 0x050d0b0b, 0x0a070305, 0x08040104, 0x00030f05, 0x323f0015, 0x3917333f, 0x2f332f01, 0x5d2f3311,
-    0x145b0582, 0x22a3590f, 0x215d0128, 0x09230109, 0x02843301, 0xa4032408, 0xbdfebffe, 0xfe9f01c2, 0x2c01c773, 0xfec92a01, 0x01a40173, 0x0244febc,
-    0xfe0e022c, 0xfda5015b, 0x82d2fdf4, 0xfe4224f7, 0x82890457, 0x1f8108f7, 0x5240af00, 0x120f181e, 0x75126548, 0x03128512, 0x1d591d49, 0x0d200302,
-    0x032d4811, 0x2b02033d, 0x02023b02, 0x490c4800, 0x00850075, 0x66002602, 0x106a0200, 0x108a107a, 0x59104903, 0x10000210, 0x79186918, 0x03188918,
-    0x0c091018, 0x081f1848, 0x1f1e1108, 0xffb81f10, 0x110ab7c0, 0x211f1f48, 0xffb81112, 0x110a40f0, 0x480f0b40, 0x01188211, 0xe0ffb818, 0x100d0d40,
-    0x10101848, 0x0c0f111e, 0x05d84d50, 0x2f39332c, 0x015d2b33, 0x33382b2f, 0x05833311, 0x2f39122a, 0x5d2b3912, 0x5d333311, 0x31270082, 0x5d2b0030,
-    0x82012b5d, 0x21580803, 0x2223030e, 0x1e352726, 0x36323301, 0x3301013f, 0x17031e01, 0x1337033e, 0x25c10233, 0x4e786250, 0x13203a22, 0x8b4f1130,
-    0x2afe1230, 0x0b0801c0, 0x02171e20, 0x1f1e1703, 0x62befc0c, 0x043b6f9d, 0x03038707, 0x04318176, 0x1b7efd2f, 0x093e4d4f, 0x4f4b3d0b, 0x0081021d,
-    0x44080082, 0x00930001, 0x042c0400, 0x0009003a, 0x06374058, 0x26071607, 0x04075607, 0x02520107, 0x064b0201, 0x07061407, 0x06600602, 0x08060301,
-    0x03030608, 0xaf019f0b, 0x0301bf01, 0x01010100, 0x04500306, 0x5007010f, 0x062c4f00, 0x2f013224, 0xdf595d5d, 0x415d2005, 0x872005c6, 0x2105de59,
-    0xd9593533, 0x15290806, 0xfda90293, 0xfd4c037f, 0x89cf0256, 0x898b2603, 0x008bdafc, 0xe3000100, 0x250457fe, 0x3100cc05, 0x12407500, 0x0f860f76,
-    0x06d07a02, 0x0918022a, 0xb814480c, 0x3740e0ff, 0x35080882, 0x01318018, 0x20333131, 0x2505f12c, 0x010c3f05, 0x7f110c0c, 0x05000105, 0x0b250501,
-    0x4f0c0ff5, 0x030c6f0c, 0x0caf0c8f, 0x300c0c02, 0x0018f519, 0x1b00f530, 0x55533f00, 0x715d2305, 0x9f8339ed, 0x2f333325, 0x4839125d, 0x5d3505a3,
-    0x00303133, 0x5d5d2b2b, 0x022e2201, 0x2e341135, 0x3e352702, 0x31088203, 0x2133023e, 0x0e222315, 0x14111502, 0x1507020e, 0x0882031e, 0x3b165f08,
-    0x1c031501, 0x2b4e6c41, 0x33634e2f, 0x2f4e6333, 0x416c4e2b, 0x2dd50901, 0x29132a41, 0x2b295342, 0x50284153, 0x57fed55b, 0x446f502c, 0x573f5f01,
-    0x89021a36, 0x56371a02, 0x4660013e, 0x8b2a4f70, 0x364a2e15, 0x5c39a6fe, 0x020a2c45, 0x5d442d0a, 0x6aa5fe3a, 0x01008b59, 0x57fe1302, 0xff82b902,
-    0x17000329, 0xab030a40, 0x82040000, 0x3fbb83d6, 0x0112113f, 0x31ed2f39, 0x33110130, 0xa6130211, 0x750757fe, 0x00008bf8, 0xa7000100, 0xe90357fe,
-    0x313b3382, 0x0d407300, 0x22862276, 0x79296902, 0x03298929, 0xe0ffb81c, 0x0d093d40, 0x82182f48, 0x300b3404, 0x25250125, 0x11f12c20, 0x19330505,
-    0x007f004f, 0x8303008f, 0x260b363f, 0x2f250ff5, 0x6f254f25, 0x258f0425, 0x250225af, 0xf5180125, 0x098b5a19, 0x2f391222, 0x82083441, 0xed33250b,
-    0x5d2f3232, 0x2f054a4e, 0x35135d5d, 0x35363233, 0x023e3411, 0x032e3537, 0x2e310882, 0x35012b02, 0x021e3221, 0x1e141115, 0x0e151702, 0x35088203,
-    0xa723020e, 0x28515bd5, 0x292b5241, 0x14294252, 0xd52d412a, 0x42410901, 0xfe2f080f, 0x6a598b57, 0x5d3a5b01, 0x020a2d44, 0x5c452c0a, 0x365a0139,
-    0x8b152e4a, 0x46704f2a, 0x563ea0fe, 0x89021a37, 0x57361a02, 0x44a1fe3f, 0x822c506f, 0x08ff82fe, 0x29026c20, 0x27036004, 0x5d002000, 0x04161a40,
-    0x04360426, 0x04960466, 0x100604a6, 0x00140930, 0x0584114c, 0xffb81e25, 0x832540c0, 0x841f200f, 0x0d32080f, 0x011d1022, 0x0dad181d, 0x1c174000,
-    0x09400048, 0x1d00480c, 0x130fad0a, 0x2f001301, 0xdd33ed5d, 0xed322b2b, 0x105d2f01, 0x2b3031ce, 0x2b2b2b00, 0xd382015d, 0x031e1722, 0xde48ee82,
-    0x27440806, 0x0e222326, 0x3e350702, 0x29730101, 0x254b4d4f, 0x33333215, 0x347b4517, 0x443d3c1f, 0x49914528, 0x41265881, 0x321d383c, 0x0d270384,
-    0x070d1a14, 0x32080e10, 0x1f16952a, 0x1a2c0813, 0x20170c2d, 0x2e268f15, 0x0233c383, 0xf6fe0302, 0x3a04c902, 0x07000300, 0x15402c00, 0x82980402,
-    0x07103409, 0x08070702, 0x03000009, 0x0f079d06, 0x0e01b803, 0x183f3f00, 0x080fd24d, 0x2313336a, 0x35231513, 0x18941b02, 0x02c2c6c4, 0x0549fcad,
-    0x00c9c944, 0x85000100, 0x4604c3ff, 0x29006305, 0x60409300, 0x10881068, 0x54284402, 0x264a0228, 0x1b02265a, 0x0d18490c, 0x2006130d, 0x06212147,
-    0x10050046, 0x05050205, 0x0046272b, 0xe0131013, 0x0413f013, 0x18502413, 0x217f211f, 0x2103218f, 0x0b181b21, 0x0105200e, 0x602e2683, 0x80057005,
-    0x0605c005, 0x50000505, 0x0182180e, 0x190f0c2f, 0x000c1901, 0x125d2f2f, 0x2f2f3939, 0x05155b10, 0x4a113321, 0xff6f0524, 0x06314b08, 0x32ed3329,
-    0x5d003031, 0x70015d5d, 0x072006e2, 0xbd08bc82, 0x3435032e, 0x3537023e, 0x031e1533, 0x012e0717, 0x15062223, 0x7b021614, 0x2f485d38, 0x3a09b609,
-    0x805a8c63, 0x366da46e, 0x68a3703a, 0x61855680, 0x11b90d3d, 0xa19c7a83, 0x1c0d01a8, 0x0c365136, 0x3e5c743e, 0x08c3c308, 0x6eb88953, 0x538abf76,
-    0x07b8b809, 0x3f6f5637, 0xc96c5b0e, 0x00c9c6bd, 0x00380001, 0x05930400, 0x0036005a, 0x0362409c, 0x480f0c18, 0x1b011406, 0x2d29226f, 0x224f106f,
-    0x7f02225f, 0x020c8f0c, 0x0c012a0f, 0x2a22222a, 0x0006030c, 0x0136006f, 0x32383636, 0x0f0f066e, 0x24174006, 0x10060048, 0x2c060206, 0x1f29730e,
-    0x0f3f010f, 0x0f9f0f6f, 0x0fdf0fcf, 0x20820fef, 0x7325322f, 0x16222216, 0x73320707, 0x06363606, 0x05314c18, 0x333f3224, 0xd94f102f, 0x26f68205,
-    0x5d2f7c01, 0x8418332b, 0x2f7d2411, 0x45ed185d, 0x5d210620, 0x671c825d, 0x2b2d05fc, 0x23030e25, 0x033e3521, 0x3523013d, 0x08fb5633, 0x020e3224,
-    0x16410607, 0x011d2605, 0x15211521, 0x09108214, 0x36322116, 0x09930437, 0x3a513620, 0x482b8ffc, 0xbaba1d33, 0x6c9f6833, 0x48657e4a, 0x180e0112,
-    0x3227111f, 0x7a4e7516, 0xfe980178, 0x3c240f68, 0x3b58022c, 0x2bf00b39, 0x9a2b4456, 0x66463016, 0xdc8e8d4b, 0x3766935c, 0x39563a1d, 0x050a0806,
-    0x403f100c, 0x8ed87d73, 0x4d603b8b, 0x3535173c, 0x9e000200, 0x2f04e100, 0x23007304, 0xea003700, 0x22499d40, 0x2d022259, 0x02223d22, 0x1d591d49,
-    0x3d1d2d02, 0x1949021d, 0x2d021959, 0x02193d19, 0x14561446, 0x32142202, 0x10460214, 0x22021056, 0x02103210, 0x0b560b46, 0x320b2202, 0x0746020b,
-    0x22020756, 0x02073207, 0x02590249, 0x3d022d02, 0x21030202, 0x180c1e06, 0x1815150f, 0x0004211e, 0x1216160e, 0x012e6faa, 0x2e012e10, 0x0439002e,
-    0xaa242020, 0x00100000, 0x00030080, 0x030f060c, 0x1e182115, 0x0603211e, 0x171b0904, 0xb0291f1f, 0x1b601b40, 0x011b3f02, 0x05050d1b, 0x0009b033,
-    0x2f33ed2f, 0x5d5d2f33, 0x11250683, 0x11391712, 0x21018533, 0x12862f01, 0x1c833920, 0x332f3223, 0x251b8911, 0x5d5d3031, 0x00825d00, 0x1b610120,
-    0x08098505, 0x36341324, 0x17372737, 0x3233013e, 0x17371716, 0x15011e07, 0x17070614, 0x010e2707, 0x27262223, 0x2e372707, 0x895a3701, 0xb650080e,
-    0x68642529, 0x497f3663, 0x61367e47, 0x2b256068, 0x6664262c, 0x477e3665, 0x69348048, 0x29256666, 0x664c2d9a, 0x4d66393a, 0x664d2c2c, 0x4c663a39,
-    0x47ac022d, 0x6764367f, 0x2a2b2765, 0x60696126, 0x47477f36, 0x69643580, 0x2a292565, 0x66696926, 0x25824a82, 0x822c2c21, 0x853a2035, 0x82002035,
-    0x01560800, 0x00003400, 0x45059804, 0xb3001600, 0x155d6f40, 0x01154b01, 0x15291519, 0x52031539, 0x40030113, 0x13140113, 0x13341324, 0x40000003,
-    0x03005000, 0x114f110f, 0x0c03115f, 0x06060104, 0x0b100816, 0x1509120b, 0x12080e16, 0x2f130e09, 0x14120112, 0x5c080004, 0x95700d11, 0x10043507,
-    0x09090109, 0x0b071817, 0x0c040c60, 0x10600f03, 0x0c100014, 0x08350182, 0x08031215, 0x3f3f0012, 0x39391233, 0x33112f2f, 0x32ed1033, 0x21048411,
-    0x78620112, 0x32ed3205, 0x5dc43932, 0x18012b32, 0x32e44d10, 0x2f391211, 0x24048433, 0x5e5f3031, 0x2100825d, 0x00825d5f, 0x15210122, 0xdb590184,
-    0x21373805, 0x33012135, 0x02330109, 0xfe4101fc, 0xfe7f0181, 0x83feb281, 0x82027d01, 0x403f080b, 0x01c765fe, 0xc76d0169, 0x898ea702, 0x0100ff90,
-    0x8e899000, 0x97fd9e02, 0x00006902, 0x13020200, 0xb90239fe, 0x0300ae05, 0x25000700, 0x07031140, 0x040400ab, 0x00050908, 0x04010005, 0x8200011b,
-    0x20aa85ab, 0x229f8212, 0x4732ed33, 0x03200537, 0x2d053b47, 0xa402a6a6, 0xf6fc0a03, 0x0b0395fb, 0x4f83f5fc, 0x9f00c508, 0x2c0454ff, 0x4d00cc05,
-    0x05016100, 0x10737340, 0x69021083, 0x60750156, 0x43026085, 0x025f535f, 0x5b535b43, 0x535a4302, 0x835a735a, 0x3e43045a, 0x6a023e53, 0x8a157a15,
-    0x142a0315, 0x145a144a, 0x4a512a03, 0x6a515a51, 0x502a0451, 0x0d185001, 0x482a4811, 0x7c396c01, 0x03398c39, 0x0501392a, 0x021f151f, 0x241a240a,
-    0x154d0502, 0x1d5d024d, 0x41495822, 0x0e4e5346, 0x49064b49, 0x22493705, 0xc0ffb84b, 0x19124040, 0x054b4148, 0x4b052222, 0x182c0441, 0x104e0049,
-    0x4e4e024e, 0x00492d63, 0x532c012c, 0x3c5d4613, 0x8646761d, 0x466a0246, 0x001d4601, 0x20275132, 0x022d802d, 0x0b272d2d, 0x06060051, 0x3f25c982,
-    0xed102f32, 0x07a9502f, 0x115d5d24, 0x02823333, 0x23088445, 0x2f391711, 0x2b220082, 0x0183ed10, 0x39391227, 0x3911ed10, 0x05904539, 0x82079d4c,
-    0x21028307, 0x306a3201, 0x50062007, 0x152606b0, 0x07020e14, 0x0683031e, 0x9d5a2320, 0x33032205, 0x058d5d32, 0xc1452720, 0x26068306, 0x2e340136,
-    0x820e2702, 0x08408227, 0x02033e8e, 0x6c8a4f78, 0x08a10f49, 0x2e55432e, 0x5332817d, 0x8b443b6d, 0x371c4670, 0x4f313652, 0x703a1e37, 0x9a5d6ba4,
-    0xa1134f75, 0x634e370c, 0x4d663a39, 0x7b5f392c, 0x68834141, 0x543b2041, 0x394b2a35, 0xe101d321, 0x3d715835, 0x1f3c593a, 0x3c6c5231, 0x27445d36,
-    0x3f1ecc05, 0x2d144562, 0x5911253d, 0x2e402d47, 0x2e100e20, 0x2d4c6a49, 0x0d374957, 0x51403315, 0x53754933, 0x68401b2c, 0x47371f4d, 0x2d151029,
-    0x49362f44, 0x0f102333, 0x5a082482, 0x47532d49, 0x2e0e0f35, 0x8b305040, 0x30cbfc9b, 0x0e233345, 0x45342103, 0x30422e27, 0x18010f22, 0x0000462f,
-    0x044f0102, 0x057c03c3, 0x0003007b, 0x40310007, 0x0085031f, 0x10850700, 0x05040104, 0x0f049001, 0x5f003f00, 0xbf00af00, 0x40000500, 0x00481e16,
-    0x5d2b2f00, 0x4432ed32, 0xed27056b, 0x35013031, 0x82211533, 0xd9022803, 0xa5d3fda3, 0x82b8c304, 0x82002000, 0x038e0800, 0x26001f00, 0xcc05ad04,
-    0x3d002900, 0x1c015100, 0x507b7740, 0x7402508b, 0x024a844a, 0x4f864f76, 0x864b7602, 0x4674024b, 0x7b024684, 0x02408b40, 0x45894579, 0x89417902,
-    0x50030241, 0x03025013, 0x024a134a, 0x121c120c, 0x0303122c, 0x23181318, 0x00660318, 0x00860076, 0x15c40003, 0x1fc6200a, 0x1f701f0b, 0x0f021f80,
-    0x021f1f1f, 0x153f152f, 0x10401502, 0x1f154814, 0x3e341f15, 0x48110d10, 0x2a10c33e, 0x532a2a01, 0xf0ffb848, 0x10825740, 0x34c3482e, 0x0a400a30,
-    0x0ac00ab0, 0x30050ad0, 0x25080884, 0x050a0a03, 0xc92510c9, 0x1a20201a, 0x108f107f, 0x10ff10ef, 0xb01a5004, 0x031ac01a, 0x1a101a00, 0x1a801a70,
-    0x08821004, 0x43694d3a, 0x43894379, 0x39c84303, 0x764d6600, 0x034d864d, 0xd02fc84d, 0x5ded3f00, 0x122c0282, 0x2f2f3939, 0x115d715d, 0xed102f33,
-    0x23051548, 0x2bed2f01, 0x5d200e82, 0x1c830582, 0x5d5d2b22, 0x10241d82, 0xed1032ed, 0x45062d63, 0x00200581, 0x201ce15e, 0x06057917, 0x18140521,
-    0x08211e4b, 0x1c8e01a7, 0x29385438, 0x0c212f3f, 0x4a341373, 0x855a4363, 0x562b2b57, 0x63435782, 0x72103148, 0x3c2e200a, 0x35533a27, 0x5b1f0319,
-    0x7879d59e, 0x5c5c9fd4, 0x7979d49e, 0x5c5b9ed5, 0x66b2864d, 0x4d84b265, 0x65b2844d, 0x4d86b266, 0x7848fb02, 0x2d1b3056, 0x2b231c38, 0x40263f51,
-    0x625e9e72, 0x243b6f9c, 0x21274b3b, 0x1726321a, 0x4a76532e, 0xb2effebb, 0x01b25555, 0x01bbbb11, 0x5656b111, 0xbbeffeb1, 0x4798eea7, 0xa7ee9847,
-    0x4698efa8, 0x00ef9846, 0x02ce0002, 0x05fd038b, 0x002a0098, 0xb97a003b, 0xe8ff0300, 0x05db4cb3, 0x3740d82d, 0x22480d09, 0x48110928, 0x820d1829,
-    0x82282004, 0x1e1e3517, 0x0624e217, 0x35013500, 0x0d3d0035, 0x2b0e0ee3, 0x100000e3, 0x24084682, 0x28e4301a, 0x0505e436, 0x28212413, 0xb41601b8,
-    0xe40a0d0d, 0x1501b813, 0x33ed3f00, 0x33333f2f, 0xed2f3912, 0x08944210, 0x0e821120, 0x33335d29, 0x312f32ed, 0x832b0030, 0x34132100, 0x18058264,
-    0x24095149, 0x14111516, 0x05de4a16, 0x22230126, 0x0e232726, 0xeb460683, 0x3d690807, 0x030e0701, 0x82633ace, 0x565ebf47, 0x950b5c54, 0x79543008,
-    0x1fa6994f, 0x091c0c2b, 0x52173817, 0x2b04034b, 0x89796692, 0x39261293, 0x415c3b27, 0x5a329a22, 0x66032844, 0x18385c45, 0x5d2b0401, 0x0a4d4459,
-    0x233e522f, 0xddfe8586, 0x03053c3a, 0x5507065e, 0x72594d4b, 0x26321c7d, 0x51442d16, 0x01043325, 0x00351e0d, 0x08dc8200, 0x8d007f45, 0xac036004,
-    0x11000800, 0x2b405000, 0x0308eb00, 0x06ec04eb, 0x130101eb, 0x11eb090a, 0xec0deb0c, 0x0a00eb0f, 0x020b0a01, 0x090c010a, 0x0f020100, 0x03060603,
-    0x00ee00ef, 0x3d39e43f, 0x1133172f, 0x82113233, 0x18012c04, 0xfded5d2f, 0x11edd4ed, 0x842f3912, 0x30312b08, 0x01350125, 0x01091533, 0x08872115,
-    0xfeac0326, 0xb25201ae, 0x54370482, 0xb0fe6ffd, 0xfeb15001, 0x8d5101b1, 0x013f6d01, 0x8cfe1f73, 0x8a1d91fe, 0x00003b0a, 0x00740001, 0x025704b4,
-    0x000500f2, 0x00124021, 0x000705aa, 0x02021002, 0x1a823f02, 0x03ad022e, 0xfd3f00b3, 0x2f015dc6, 0xedde105d, 0x11306e82, 0x11213521, 0xaefcc603,
-    0x01b4e303, 0xc2fd92ac, 0x0021e282, 0x080b4404, 0x00137208, 0x00350027, 0x40ec003e, 0x8b267b29, 0x20740226, 0x76022084, 0x02258625, 0x21862176,
-    0x841c7402, 0x167b021c, 0x7902168b, 0x021b891b, 0x17891779, 0xffb82f02, 0x0b1540d8, 0x28334811, 0x03480c09, 0x02261326, 0x20132003, 0x29293402,
-    0x40f0ffb8, 0x3b312926, 0x282cc42b, 0x35351035, 0x7036c431, 0x02368036, 0x362c362c, 0x0d10140a, 0xc3144811, 0x22a68210, 0x831e4000, 0x8232202a,
-    0x1e2d0810, 0x2c280ac3, 0x3bc82a34, 0x002dc83a, 0x022d102d, 0x2d2d3b2c, 0x23032c3b, 0x19791969, 0x19031989, 0x66000fc8, 0x86237623, 0xc8230323,
-    0x08df4305, 0x2f391723, 0x25e2822f, 0x32ed10ed, 0xda433311, 0x825d200e, 0x382f2214, 0x23058233, 0x11383911, 0x25058955, 0x5d5d2b2b, 0xab5d5d01,
-    0x745d2005, 0x4e181086, 0x052e12dc, 0x23112303, 0x16322111, 0x07061415, 0xe5730313, 0x04362206, 0x20ac43ad, 0xc7defe34, 0x33017fa1, 0x5568978e,
-    0x515f9fdd, 0x5450b6aa, 0x9d43f902, 0xfa3c0822, 0xb0fe5001, 0x6f7e3f03, 0xfe137b66, 0x455002a2, 0x55d3fe48, 0xffffff00, 0x04f205fb, 0x125206d1,
-    0x00420007, 0x00ce0600, 0x01020000, 0x03200347, 0x005a0585, 0x00270013, 0x1100b94a, 0x2a05c743, 0xe8ffb80d, 0x0c092640, 0x82180748, 0x83032004,
-    0xac143f04, 0xac1e0000, 0x0a100a00, 0x0a030a80, 0x0500af23, 0x19050501, 0x00040faf, 0x2f33ed3f, 0x3746ed5d, 0x2b002108, 0xf85b0082, 0x06d16308,
-    0x080f155b, 0x2d85033a, 0x3b3b694e, 0x2e2e4e68, 0x3b3b684e, 0x6d2d4e69, 0x2641301b, 0x1c304125, 0x2541301c, 0x1b304126, 0x683b3d04, 0x4d2d2d4d,
-    0x683c3b68, 0x4d2c2c4d, 0x41263c68, 0x311c1c31, 0x31242583, 0x41311d1d, 0x0032bf83, 0x04000074, 0x00c30457, 0x000f000b, 0x0f37406a, 0x5218040c,
-    0x06200988, 0x3f08df82, 0x0202030a, 0xad0d1110, 0x0e020c40, 0x0e050704, 0x073f072f, 0x8f03078f, 0xdf079f07, 0x0407ef07, 0xad040007, 0xffb80509,
-    0x1613b3c0, 0x2f000548, 0x32ed332b, 0x2b715dc6, 0x4d101800, 0xed1a2fe6, 0x08a45218, 0x2b211682, 0x25148301, 0x31323311, 0xfd490130, 0x33112905,
-    0x01152111, 0x02152135, 0x08aa5218, 0x1dfc5508, 0xa802e303, 0x8b0175fe, 0xfe8a0191, 0x58fd9176, 0x01009191, 0x33023801, 0x8d059403, 0x53002000,
-    0x6a025ab5, 0xb8150202, 0x2840d8ff, 0x1f480e09, 0x6fe1171f, 0x02088f08, 0x22000808, 0x0f0fe00e, 0x001e1e00, 0x02001000, 0x0b0e0e00, 0x01de14e4,
-    0xdd00e41e, 0x2705bf61, 0x2f012f33, 0x112f335d, 0x2006864e, 0x0608455d, 0x015d0126, 0x35053e27, 0x0a564e18, 0x14151622, 0x3e08ed82, 0x3a011721,
-    0x64581b02, 0x47345267, 0x0858444a, 0x4c2e0685, 0x9183436c, 0x63675536, 0xcb011653, 0x67330202, 0x47505f3d, 0x3e325249, 0x0844494b, 0x25405733,
-    0x623d707f, 0x4e494952, 0x82006b2f, 0x01012600, 0x03270232, 0x08b78299, 0x7b00352e, 0xff2a00b9, 0x092040e8, 0x2802480f, 0x30480c09, 0xe122162d,
-    0x2d082323, 0x164f1ce1, 0x1602165f, 0x081c161c, 0xb80fe100, 0x2240c0ff, 0x0f271f82, 0xe109370f, 0x82100800, 0x153033d8, 0x0c1616e4, 0x1f222228,
-    0x0cde28e4, 0x090903e4, 0x5d4edf03, 0x5d4f1805, 0x12ed240c, 0x822b2f39, 0x2f392504, 0xed105d2f, 0x3127e586, 0x2b2b0030, 0x49061401, 0x012106ad,
-    0x4b4f1833, 0x0660081c, 0x031e1507, 0x8e9b9903, 0x24497457, 0x58098806, 0x25534d55, 0x3d1d4338, 0x323d1d39, 0x44474a20, 0x07870654, 0x3a674f32,
-    0x23466845, 0x4b345a56, 0x1b031630, 0x40278074, 0x430d2b51, 0x2d4c4845, 0x6d091d36, 0x28351f0d, 0x4146453c, 0x39563a0c, 0x4f3b211c, 0x146e4b2e,
-    0x36250502, 0x01010044, 0x2c0cf36b, 0x028b027b, 0x01038002, 0x8c020003, 0x0bf36b05, 0x37355208, 0x01051533, 0xfec5e392, 0x14b104d4, 0x00e61def,
-    0x00010000, 0x0477fe90, 0x003a043c, 0x40680027, 0x0f100b18, 0x07394812, 0x05462201, 0x1f201f10, 0xc01f6002, 0x031fd01f, 0xc0ffb81f, 0x53242a40,
-    0x291f1f48, 0x46110d15, 0x53274012, 0x1c401248, 0x39048223, 0x00481512, 0x20120112, 0x1b120f13, 0x050c501a, 0x15001609, 0x333f3f00, 0x0482ed33,
-    0x5d2f012e, 0xed2b2b2b, 0x39123232, 0x715d2b2f, 0x24058e68, 0x032e212b, 0x05014735, 0x1e232722, 0x5a05f07a, 0x41080f48, 0x03019403, 0x35040303,
-    0x805272a7, 0x01030420, 0x3f1bb6b6, 0x70434965, 0x01b52e52, 0x06010202, 0x133f3e31, 0x3a406e6d, 0xfe1b3f20, 0xfdc3058b, 0x5574457c, 0x7e5b342f,
-    0xfc69024b, 0x434c22af, 0xdb830731, 0xfe7f3408, 0x053804bc, 0x00130045, 0x05184041, 0x0106009a, 0x020c0606, 0x9a011313, 0x00150202, 0x020c100c,
-    0xb813040c, 0x12b71001, 0x12010707, 0x00010603, 0x823f332f, 0x05dc47aa, 0xed230882, 0x82112f32, 0xed5d2106, 0x08055c43, 0x2311233f, 0x022e2211,
-    0x023e3435, 0x03152133, 0x85c584b7, 0x35608550, 0x578a5f32, 0xcb044702, 0x0f06f1f9, 0xbe03f1f9, 0x5886582d, 0x325d8554, 0xffff007a, 0xa401f001,
-    0xcf02db02, 0xd3000612, 0x24938300, 0x0144fe77, 0x080982e3, 0x52001b24, 0xff1a00b9, 0x0f2f40e8, 0x1a444813, 0x03021a54, 0x48130d18, 0x17191918,
-    0x0c094016, 0x08161648, 0x27828710, 0x08010829, 0x40199213, 0x8248100d, 0x8d0b3219, 0x3f009505, 0x2f392fed, 0x2f01ed2b, 0xed2f335d, 0x290a8211,
-    0x33113333, 0x2b003031, 0xe1442b5d, 0x27262305, 0x3f4c1635, 0x26580805, 0x07012a23, 0x1e073337, 0x1ee30101, 0x144b6841, 0x2432192d, 0x0f223929,
-    0x1d0e483d, 0x276b410e, 0xfefe5e5e, 0x1a31452a, 0x06620301, 0x1320160d, 0xb6022a28, 0x00530364, 0x021d0101, 0x059b0333, 0x00120082, 0x3f22403f,
-    0x11110111, 0x0802e010, 0x0e010108, 0x02100200, 0x132a0082, 0x09e40814, 0xdc0e0309, 0x0b440110, 0x83332007, 0x01122290, 0x22998239, 0x18332f33,
-    0x20078d54, 0x8d541801, 0x3322080c, 0x01230115, 0x4a370d09, 0x57302b56, 0x79113849, 0x6b3302ec, 0x2a1a6202, 0x126d111e, 0xfd213223, 0xf5826b1c,
-    0x00024908, 0x038b02e2, 0x009805ea, 0x00210013, 0x7a304052, 0x02198a19, 0x158a157a, 0x85217502, 0x1c750221, 0x00021c85, 0xa01490e3, 0x0314c014,
-    0x1a231414, 0x010a6fe3, 0x0a100a00, 0x0a030a50, 0xb80fe417, 0x1fb21501, 0x01b805e4, 0x21080862, 0xc941ed71, 0x05985006, 0x0a025d18, 0x32335108,
-    0x3407021e, 0x06222326, 0x021e1415, 0x03363233, 0x926231ea, 0x61905d62, 0x92613033, 0x5d936762, 0x7278952c, 0x3d227d74, 0x7f753355, 0x8f571204,
-    0x68393968, 0x8f54578f, 0x683a3b68, 0x8697558f, 0x6d4c9588, 0x00852045, 0x6b000200, 0x4c048d00, 0x08085f49, 0xeb032a27, 0x0601ec08, 0xeb0005eb,
-    0x0a130101, 0xec10eb0c, 0x0eeb0f0a, 0x110aeb09, 0x0f071008, 0x08070009, 0x0303030c, 0x145e4906, 0xedd4ed24, 0x5e49fd10, 0x2b098405, 0x23253031,
-    0x35010935, 0x01150133, 0x022c0887, 0x5201b2fa, 0x01b0b0fe, 0xb4d3fc52, 0xb22e0983, 0x1d8d4f01, 0x74016f01, 0x3f8dfe1f, 0x0a8893fe, 0xff003e08,
-    0x001b00ff, 0x05cd0400, 0x00271045, 0x00f6fed4, 0x00261000, 0x110000d1, 0x01d70007, 0x00b6fd98, 0x03174028, 0x03181802, 0x01195002, 0x19011940,
-    0x01146001, 0x00200014, 0x5d110001, 0x24028435, 0x0035355d, 0x8303823f, 0x8211204b, 0x86b0204b, 0x85ec204b, 0x83f0204b, 0x01d52b4b, 0x00b4fdac,
-    0x020d4018, 0x418f1817, 0x00203c82, 0x0b203b83, 0xcd223b82, 0x87825105, 0x21ffd622, 0x19203b85, 0x20258789, 0x02031240, 0x27878335, 0x3a40013a,
-    0x40003a01, 0x7f888287, 0x02004008, 0xdffe9900, 0x39046c04, 0x2b002700, 0x36407700, 0x06760666, 0x66030686, 0x86047604, 0x1b450304, 0x69021b55,
-    0x89007900, 0x090a0300, 0x2b2b9828, 0x00981e00, 0x801d701d, 0x1d1d031d, 0x8298132d, 0x34438274, 0xc0ffb809, 0x130f1540, 0x23090948, 0x692b9d2a,
-    0x89237923, 0x25208223, 0xb8239e18, 0x43480e01, 0x05624305, 0x2508e74f, 0xed2f3912, 0x544d3233, 0x34372706, 0x3337063e, 0x3642070e, 0x58461805,
-    0x01022508, 0x99352315, 0x1dbc4b18, 0x6c71af29, 0x02447eb1, 0x184fc371, 0x2821bb4b, 0xc9c94404, 0xffff0000, 0x08008200, 0x06cc0426, 0x002612a7,
-    0x11000024, 0xff430007, 0x00f300a3, 0x1502b415, 0xb8022605, 0x16b4a3ff, 0x25070419, 0x00352b01, 0x2f880282, 0x2f88a820, 0x5d007428, 0x1300f400,
-    0x30840b40, 0x18155d22, 0x5f8a2d89, 0xc3202f89, 0x2f857082, 0x26051626, 0x151b0002, 0x9d202f94, 0xc5205f88, 0x90832f88, 0x30200022, 0x5d202f94,
-    0x69202f88, 0xe2252f82, 0x0d401700, 0x24908303, 0x19000203, 0x83318517, 0x823520c0, 0x20c3881c, 0x30338660, 0x03c40006, 0x40160055, 0x3802030c,
-    0x03020303, 0x4292861f, 0x49080697, 0x01000200, 0xab040000, 0x0f004505, 0x85001800, 0x040b5140, 0x049b042b, 0x02011703, 0x02520104, 0x035e0211,
-    0x04031404, 0x05090302, 0x080d0509, 0x0f185c0c, 0x0d0d030f, 0x5f01031a, 0x085f0b17, 0x083f080f, 0x088f087f, 0x04826f04, 0x089f2b08, 0x08df08bf,
-    0x17081705, 0x07110c08, 0x0c03045f, 0x120f035f, 0xed333f00, 0x1232ed3f, 0x2f2f3939, 0xed107271, 0x2f01ed10, 0x02833912, 0x15863320, 0x2d08975b,
-    0x31c0c010, 0x015d0130, 0x01230321, 0x46181521, 0x5f0807eb, 0x0e231121, 0x21030703, 0xb1fe8602, 0xe601a88e, 0xaffe9b02, 0xb9fe4701, 0xdbfd7a01,
-    0x15140449, 0x018b0615, 0xfe9c011c, 0x98450564, 0xfe9652fe, 0xb204982f, 0x44484210, 0x006ffe12, 0x7100ffff, 0x760444fe, 0x26125a05, 0x00002600,
-    0x78000711, 0x00006201, 0x01b60b00, 0x152a321b, 0x2b01250b, 0x26063741, 0x040000a2, 0x82a80662, 0x84282027, 0xff433427, 0x00f400b9, 0x0c01b415,
-    0xb8012605, 0x0db49dff, 0x420a0010, 0x2f8f0a2b, 0x5b007422, 0x84052b42, 0x0c3f2230, 0x202d890f, 0x8f878300, 0x052b422f, 0x0d205f82, 0xe4235f84,
-    0x920c12b4, 0x885d205f, 0x0069288f, 0x00e20014, 0x8302b619, 0x8202205f, 0xb4f82391, 0x31850e10, 0x2305fd41, 0xca00ffff, 0x0120c382, 0x2c20c384,
-    0xaf20c386, 0xb020c38b, 0x0120c383, 0x2f8fc38a, 0x67007422, 0x6720c38a, 0x2d88c382, 0x2f8fc384, 0x2008ef42, 0x20c48301, 0x93c18200, 0x85c3832f,
-    0x08bf428f, 0x0020c486, 0x3184c182, 0x0025c185, 0x00020000, 0x08c3821b, 0x45056540, 0x1f001000, 0x62408e00, 0x16821672, 0x16300202, 0x14021660,
-    0x02162416, 0x1a891a79, 0x8f197f02, 0x191b0219, 0x193b192b, 0x1104196b, 0x5a000611, 0x17011700, 0x131e2117, 0x060a065a, 0x21590808, 0x12220805,
-    0x1f1e5f08, 0x02094f09, 0x096f093f, 0x09cf099f, 0x09ef09df, 0x1f400906, 0x09094828, 0x0b5f1d13, 0x4c181303, 0x2b260a3c, 0xed33715d, 0x9b4b0132,
-    0xed102705, 0x2f391232, 0x3566ed5d, 0x5d5d2208, 0x06294e5f, 0x23112137, 0x21113335, 0x01021e32, 0x32331121, 0x2e341112, 0x11012b02, 0x344a1821,
-    0x87320807, 0x9e370187, 0xfe55a6f3, 0xa2dffe1d, 0x7238ced4, 0x017975ac, 0xa8b00221, 0x59aefffe, 0x02955502, 0xfaa24d5b, 0x47fef9fe, 0x0a010a01,
-    0x3979c087, 0x1f4241fe, 0x062a3e07, 0x0026129e, 0x11000031, 0x00c50007, 0x00f50000, 0x010b4013, 0x01260514, 0x082f1f00, 0x07b94112, 0x2f830020,
-    0xecff6626, 0xa8066604, 0x32202f82, 0x43342f84, 0xf400aaff, 0x02b41500, 0x0226051e, 0xb4aaffb8, 0x000a221f, 0x8f0aeb41, 0x0074222f, 0x05eb4162,
-    0x62223084, 0x2d89211e, 0xeb415f94, 0x1f022108, 0x00226082, 0x2f941e24, 0x8f889d20, 0x8309db44, 0x29002290, 0x202f9439, 0x232f885d, 0x00030069,
-    0x8206db44, 0x02032430, 0x85202202, 0x081b4231, 0x00013508, 0x04e1009d, 0x0073042e, 0x408e000b, 0xc902b91d, 0x0302d902, 0x00c900b9, 0xb60300d9,
-    0xd608c608, 0x06b60308, 0x06d606c6, 0xffb80703, 0x120e40f0, 0x10014816, 0x0a200482, 0x04200483, 0xb3201282, 0x05200c82, 0xb6200782, 0x19230782,
-    0x82030105, 0x2640210a, 0x03220b83, 0x23830901, 0x01091623, 0x2607840b, 0x8004010b, 0x494f010a, 0x02330521, 0xb201070a, 0x333f1900, 0x5d5d2f01,
-    0x3031335d, 0x852b5d00, 0x2b2b2401, 0x822b2b01, 0x5d360813, 0x37010913, 0x09170109, 0x01090701, 0xfe62019d, 0x5e0168a0, 0xfe695e01, 0x666001a2,
-    0x9cfe9ffe, 0x62014a01, 0xfe676001, 0x695f019f, 0xa0fea4fe, 0xfe610169, 0x0082009d, 0x00032a08, 0x04daff38, 0x00700592, 0x0022001a, 0x40c5002b,
-    0x011d8b8c, 0x19751965, 0x6a031985, 0x8a0c7a0c, 0x0b77030c, 0x87256701, 0x05d85a25, 0x56114623, 0xf95f1811, 0x3439080a, 0x84227422, 0x1f760322,
-    0x7b021f86, 0x021e8b1e, 0x74011e36, 0x26390126, 0x7b2b3b01, 0x032b8b2b, 0x251e261d, 0x181b2304, 0x040b0815, 0x5b00170e, 0x1b011b5f, 0x481c1940,
-    0x08078200, 0x232d1b2e, 0x0e500a5b, 0x010e1001, 0x1d251e0e, 0x29200426, 0x180b085f, 0x16050415, 0x5f200413, 0x00130509, 0x3fed333f, 0x39171233,
-    0x391711ed, 0x712afe82, 0x3912ed33, 0x712b5d2f, 0x108232ed, 0x18821120, 0x10655818, 0x005d5d22, 0x5a062843, 0x352607a2, 0x013e1234, 0xc15a3233,
-    0x07770805, 0x16012734, 0x01123233, 0x2e011714, 0x02222301, 0x84466604, 0xac6f78bf, 0x8d5e753f, 0x82442f30, 0x80d97cbf, 0x308c5e74, 0xfe1ec930,
-    0xa3984f00, 0x1e92fd94, 0x74270002, 0x029c9c4b, 0xfafeada9, 0x444659b1, 0x58bd419c, 0x01ad91e8, 0x8656ac02, 0x55bb419c, 0x72a492e4, 0x018a52fd,
-    0xa60a0118, 0x42ac0274, 0x00f9fe41, 0x00ffff00, 0x04ecff8e, 0x12a8063d, 0x43380026, 0x9f2f0623, 0x1500f400, 0x051a01b4, 0xffb80126, 0x421bb4a0,
-    0x2f920ac5, 0x56007422, 0x84052343, 0x1a562230, 0x0ec3421d, 0x23435f8f, 0x1b012108, 0x00226082, 0x2f941a20, 0x8f885d20, 0x820a0f45, 0x01022491,
-    0x421c1e00, 0x93820df3, 0x00002424, 0xc384a804, 0xc3843c20, 0x65007422, 0x09209386, 0x65246382, 0x08040c09, 0x18091744, 0x080af746, 0x1b00102e,
-    0x42406300, 0x0f860f76, 0x751a6502, 0x031a851a, 0x127a126a, 0x0003128a, 0x8f117f5a, 0x40110211, 0x00481c19, 0x11110111, 0x070b161d, 0x0afc4618,
-    0x06601626, 0x060b6015, 0x07240182, 0x12070309, 0x2607c05a, 0xed10ed10, 0x4e5d2f01, 0x5d23059c, 0x41ed5d2b, 0x012c05fa, 0x23020e14, 0x11231521,
-    0x32211533, 0x14014718, 0x0d01bf23, 0x0247187d, 0x0254080b, 0x789f58b4, 0x4505fe47, 0x9c6f3ceb, 0xfd958663, 0x6b4f2cc0, 0x01000000, 0xe3ff8e00,
-    0xcc058f04, 0xbd004300, 0x3a7c2940, 0x75023a8c, 0x02388538, 0x66014265, 0x3f440141, 0x3f743f54, 0x65043f84, 0x2e65012f, 0x2e852e75, 0x09280303,
-    0xb833480c, 0x2540e8ff, 0x27080882, 0x36011f39, 0x3d261f48, 0x3d023d36, 0x18401848, 0x18901850, 0x1f0418a0, 0x09181809, 0x002a031f, 0xffb81148,
-    0x1712b3c0, 0x2a080784, 0x0e092940, 0x45111148, 0x402b462a, 0x00481512, 0x112b012b, 0x05031f3d, 0x00315024, 0x0960152b, 0x09800970, 0x0e090903,
-    0x4a160550, 0x3f2e05d7, 0x1712ed3f, 0x5d2f0139, 0x3912ed2b, 0x05822b2f, 0x26077554, 0x5ded105d, 0x44003031, 0x5d2f0509, 0x5d005d01, 0x020e1401,
-    0x2f262223, 0x50031e01, 0x042305e9, 0x823e3435, 0x822e2003, 0x020e2615, 0x11231115, 0x05387934, 0x1415a108, 0x1415040e, 0x8f04041e, 0x5f875729,
-    0x02379450, 0x4e4a421a, 0x36625c25, 0x36515f51, 0x313a3121, 0x5a3f2121, 0x496b4439, 0x783fb427, 0x9b666eae, 0x33213569, 0x3721333a, 0x37525f52,
-    0x76422701, 0x18193458, 0x121a0fa4, 0x3b4f5f0a, 0x47393f52, 0x4933465e, 0x3f34303a, 0x2d3e252b, 0x7a4d231a, 0x0403fc58, 0x70ac7703, 0x6d502e36,
-    0x43573b3e, 0x20323134, 0x403a3d28, 0xffff6f54, 0xecff8000, 0xb4058804, 0x44002612, 0x06110000, 0x008e4300, 0x02b41500, 0x02261142, 0xb470ffb8,
-    0x03154643, 0x8f0c7346, 0x4d74262f, 0x40130000, 0x2230840b, 0x8945422f, 0x275b922d, 0x0000eec3, 0x4302b719, 0x20285b82, 0xffb80148, 0x4248b4d0,
-    0x5d223084, 0x83490035, 0x205f8507, 0x268f88a9, 0x0000f8c5, 0x840e4022, 0x4d30275f, 0x014d2001, 0x3a824d10, 0x4db4da23, 0x203a855d, 0x883c865d,
-    0x887b206f, 0xf069273b, 0x401e0000, 0x3c83030a, 0x20020323, 0x23378246, 0x4446b4d2, 0x35203785, 0x87065446, 0x0b062137, 0xc4203788, 0x17317382,
-    0x02030d40, 0x03261147, 0x424c1202, 0x01252f27, 0x0830872b, 0x14000376, 0xb804ecff, 0x41004e04, 0x59005000, 0x8140c600, 0x588c587c, 0x8c547c02,
-    0x136a0254, 0x138a137a, 0x7c116c03, 0x03118c11, 0x3d153d05, 0x15370502, 0x21030237, 0x1b022113, 0x480e0928, 0x00563814, 0x4b244b49, 0x0a0a4909,
-    0xcf574840, 0x024bdf4b, 0x4b015710, 0x1e574b57, 0x30482f5b, 0x4f484230, 0x9f1e5f1e, 0x041eaf1e, 0x502a511e, 0x56500035, 0x5624514b, 0x24080182,
-    0x2f35383b, 0x022f8f2f, 0x10352f2f, 0x19504506, 0x80190f14, 0x09090109, 0x3f001619, 0x115d2f33, 0xed103333, 0x25098632, 0x2f2f3939, 0x0183ed10,
-    0x2f013229, 0x2f33ed5d, 0x831211ed, 0x5d5d2113, 0x0c822382, 0x39262a83, 0x00303139, 0x00855d2b, 0x64150121, 0x1727054d, 0x2223030e, 0x8527022e,
-    0x141a7e06, 0x013e1729, 0x021e3233, 0x6d05011d, 0x7c080560, 0x0e07013d, 0x0e220103, 0x2e210702, 0x01a70201, 0x31462c15, 0x8a10594b, 0x6d492b0c,
-    0x485c394d, 0x36151235, 0x443a5c49, 0x391e3f61, 0xa73e765d, 0x2434210f, 0x17263320, 0x2808a804, 0x5b50714a, 0x7d2d2379, 0x4e81604c, 0x3905fc20,
-    0x34513839, 0x4a257a19, 0x9e02253a, 0x23333e1c, 0x09690102, 0x11f70158, 0x37628852, 0x2d2d485e, 0x182f495b, 0x31405937, 0x2c243e55, 0x6b4b7754,
-    0x114d7e89, 0x4a45462b, 0xd29b5841, 0x52cc187a, 0x09527e64, 0x1d520236, 0xab627f4a, 0x00ffff9d, 0x0444fe82, 0x124e0438, 0x00460026, 0x2b050f4c,
-    0x00000051, 0x2101b60b, 0x1c00262e, 0x26090f4c, 0x04ecff85, 0x82b40546, 0x82482027, 0x00063427, 0x0000b143, 0x2c02b415, 0xb8022611, 0x2db4b2ff,
-    0x431f1530, 0x2f8f0c1b, 0x436f7421, 0x3083051b, 0x2f2c6f22, 0x83822d89, 0xc3212b8f, 0x202b8507, 0x225c822d, 0x922c3207, 0x887b202b, 0x08692287,
-    0x05014e00, 0x03245882, 0x2e300802, 0x034c2d85, 0x008f2408, 0x84650400, 0x85c020b7, 0x00bd38b7, 0x0b401e00, 0x26110a01, 0x010b6001, 0xb8010b50,
-    0x0bb4a9ff, 0x8201030e, 0x0a3f43be, 0x7421378f, 0x84938468, 0x0a542237, 0x832e840d, 0x82002064, 0x282b8fbf, 0x00000ac3, 0x010e4022, 0x2663830b,
-    0x10500110, 0x82103001, 0xb4f62366, 0x37840a10, 0x67905d20, 0x9f85cf83, 0x00296927, 0x1f402f00, 0x30688302, 0x0e900102, 0x010e8001, 0x60010e70,
-    0x0e50010e, 0x24538201, 0x060c0e00, 0x82aa8409, 0x435d2045, 0x5d080787, 0xff7d0002, 0x054e04ec, 0x002500d8, 0x40bb0037, 0x55364581, 0x03366536,
-    0x31553145, 0x4a033165, 0x6a2e5a2e, 0x284a032e, 0x286a285a, 0x3b042b03, 0x03046b04, 0x24152405, 0x06101302, 0x08120409, 0x0c120c08, 0x47172112,
-    0x01267003, 0x000126a0, 0x60261026, 0x26260326, 0xff473039, 0x02820121, 0x21004908, 0x10652101, 0x10851075, 0x7a066a03, 0x03068a06, 0x06130910,
-    0x2b110704, 0x00030050, 0x00100000, 0x07000702, 0x50330c00, 0x1112161c, 0x00000c11, 0x332f333f, 0x3911ed3f, 0x5d2f2f39, 0xed103311, 0x39171211,
-    0x2f015d5d, 0x079c4918, 0x33727122, 0x33211d85, 0x0b37492f, 0x16320129, 0x27012e17, 0x82372705, 0x1e332905, 0x17251701, 0x1d121607, 0x210b7b59,
-    0x38463401, 0x05714306, 0x64026808, 0x272b7547, 0xfcfe4c69, 0x7838da37, 0x532dd142, 0x3708012a, 0x39a7a4d3, 0x7d84bc78, 0x343876b5, 0xb201ba74,
-    0x50714721, 0x21497351, 0x76519190, 0xd303244b, 0x9f591b20, 0x5e6e7345, 0x14234e2d, 0x6c721f33, 0x7dfe955c, 0xc47906f4, 0x84494b8a, 0xb66b6fb9,
-    0x0efe4b86, 0x2c5a895e, 0x5c885c2d, 0x5a2cb2be, 0x77ffff8b, 0x052c050b, 0x002612a9, 0x11000051, 0x0ac50006, 0x28051342, 0x01261126, 0x13413109,
-    0x0a5f4c24, 0xecff8226, 0xb4054904, 0x52202b82, 0x43302b84, 0x150000ba, 0x112402b4, 0xffb80226, 0x2825b4bb, 0x8f0e0b49, 0x6574212f, 0x30845b84,
-    0x27246522, 0x8f0cbb4c, 0x00c3212b, 0x25202b85, 0x00225c82, 0x2b92242a, 0x8785b383, 0x2b86c520, 0x00228883, 0x2b923f2f, 0xb3887b20, 0x2b826920,
-    0x0d401723, 0x24848303, 0x28000203, 0x0c8d4926, 0x00035b08, 0x04df0074, 0x00750457, 0x00070003, 0x4063000b, 0x0b0e063c, 0x700e0805, 0x03050105,
-    0x3f00ab0b, 0x02084f08, 0x0a010800, 0x0d080803, 0x40ae090c, 0x01040e08, 0xae000e05, 0x013f012f, 0x4f03014f, 0x9f018f01, 0x0401ef01, 0x05ad0401,
-    0xed3f00b3, 0xed715dd6, 0x1018002b, 0xa35af64d, 0x335d2309, 0x6d1832ed, 0x312807e7, 0x33350130, 0x21350115, 0x33380382, 0xa8110215, 0xe303bbfd,
-    0x03a8bafd, 0xfeb7b7be, 0xfe9292a2, 0x00b7b77f, 0x39088d82, 0x04ecff6e, 0x004e045d, 0x00250019, 0x40db0031, 0x55244524, 0x03246524, 0x4a01306b,
-    0x02305a30, 0x110b200c, 0x89077948, 0x40070207, 0x74480f0b, 0x02198419, 0xc0ffb819, 0x0d830940, 0x14841424, 0x0d831402, 0x0d826720, 0x1e2a1d26,
-    0x1a260429, 0x3f062f4c, 0x20470017, 0x401a301a, 0x801a701a, 0x061a901a, 0x1a501a00, 0x1ab01aa0, 0x00051ac0, 0x601a101a, 0x2e081784, 0x1a061ae0,
-    0x4726331a, 0x0e0a0a0e, 0x482e2840, 0x1b18400e, 0x1d2a0e48, 0x21041e29, 0x180b082d, 0x05130415, 0x502d1616, 0x50211013, 0x74090905, 0xed2608c5,
-    0x12112f33, 0x03833917, 0x2b2f0123, 0x08a1682b, 0x32ed7223, 0x095d4c2f, 0x015d2b25, 0x83005d2b, 0x5d002105, 0x6607d574, 0x352306fb, 0x4c023e34,
-    0x162e0557, 0x27263407, 0x33011e01, 0x25023e32, 0x5a4c1614, 0x0e700805, 0x465d0402, 0x6577bc83, 0x4c4d40a6, 0x43333054, 0xd579bc81, 0x504e487a,
-    0x1011bd61, 0x722b03fe, 0x56764540, 0x118bfd30, 0x2afd0111, 0x75454571, 0x1e023055, 0x458cd38e, 0x44573635, 0x7abc455f, 0x468dd18c, 0x5a445264,
-    0x784cf789, 0x35c0fd2e, 0xa662272a, 0x2e754b7e, 0x27324002, 0x00a46329, 0xffff0000, 0xecffb900, 0xb4051f04, 0x58002612, 0x3105f742, 0x150000a2,
-    0x112601b4, 0xffb80126, 0x2a27b49c, 0x27461324, 0x212f8f0c, 0x53435a74, 0x26542209, 0x922d8929, 0x82c3205b, 0x205b8272, 0x235b8427, 0x262cb4fa,
-    0x7b205b94, 0x69208b88, 0x19222f82, 0x8c8302b6, 0x8d820220, 0x2ab4fa23, 0x46318528, 0xbf84052d, 0x57fe4224, 0xbf848904, 0xbf845c20, 0x856b7421,
-    0x8220208f, 0x206b2364, 0xe5461123, 0x00022209, 0x082b82b9, 0xcc054252, 0x38001300, 0x44406500, 0x21892179, 0x01126402, 0x12561246, 0x01026b02,
-    0x02590249, 0x01163502, 0x0601263a, 0x761b161b, 0x041b861b, 0x0060471e, 0x3a000001, 0x462f0a32, 0x30803000, 0x00313002, 0x0f281b2f, 0x14162350,
-    0x10195005, 0x33ed3f00, 0x3f200283, 0x4c095a4c, 0x5d200658, 0x77780083, 0x3e01240f, 0x18323303, 0x32099075, 0x031e2327, 0x11231115, 0x06141133,
-    0x03070607, 0x793b1888, 0xfd230d83, 0x793f19e8, 0xc179069f, 0x01b4210e, 0x02210082, 0x0e7f7922, 0x79ce0121, 0xbb790798, 0x75072c0e, 0x391d59fe,
-    0x00171a16, 0x4100ffff, 0x7b230533, 0x41002612, 0x69300533, 0x17000005, 0x01020d40, 0x02261120, 0x22240501, 0x41053541, 0x01280665, 0x00008f00,
-    0x3a046504, 0x7f05df7d, 0xdf7d05ed, 0x0a0b2108, 0x7d0edf7f, 0xe9201bdf, 0x2609d47f, 0x038e8e8e, 0x82008e1e, 0x023c0800, 0xfbff1400, 0x4b05c504,
-    0x28001700, 0x49407400, 0x26862676, 0x56094602, 0x04490209, 0x12020459, 0x160e120e, 0x1b5c1511, 0x1616061b, 0x065c242a, 0x110f5f14, 0x117f113f,
-    0x6f04118f, 0x9f390482, 0xdf11bf11, 0x11110511, 0x5f16180e, 0x17030317, 0x5f0f1f12, 0x0e0b0b0e, 0x0b3c6c03, 0x3911322c, 0xed72712f, 0x12ed2f01,
-    0x02822f39, 0xd255ed20, 0x05044e05, 0x010e2126, 0x11022223, 0x5506e84f, 0x252509bb, 0x11373632, 0x1b46182e, 0x02ce0808, 0x1a311761, 0x7b3decff,
-    0x333a7cb9, 0x72fe2e02, 0x91fe6f01, 0x3bfdb701, 0x13133b16, 0x754e153b, 0x4f28274e, 0x01030274, 0xb45c0152, 0x4ca20001, 0x48fe9806, 0x9839fe96,
-    0x0404028c, 0x3a030321, 0x8e8fc87f, 0x003f84cc, 0x1c000300, 0xb404ecff, 0x26004e04, 0x43003a00, 0x7340aa00, 0x428b427b, 0x8a3e7a02, 0x3876023e,
-    0x79023886, 0x022a892a, 0x03760366, 0x64030386, 0x84337433, 0x2f6b0333, 0x2f8b2f7b, 0x15220503, 0x1a050222, 0x0a021a15, 0x02151a15, 0x00401d10,
-    0x18272748, 0x09490825, 0x10482509, 0x41410141, 0x4f483145, 0x9f185f18, 0x0418af18, 0x40500018, 0x2c3b3640, 0x1b1d2050, 0x50360510, 0x130e1013,
-    0x08010880, 0x794b1308, 0xed33260d, 0x2f391232, 0x08f958ed, 0x5a2f3221, 0x3221058a, 0x09d66839, 0x00825d20, 0x335b0120, 0x17373105, 0x2223030e,
-    0x23010e27, 0x35022e22, 0x32331210, 0x2008594b, 0x89691825, 0x085d4b0e, 0x13c84408, 0x412c4029, 0x0b8a0e4e, 0x48664428, 0x852a51b6, 0x55784b5b,
-    0xbba2aa2d, 0x51852d4f, 0x1f4a7b5b, 0x2c186bfd, 0x4127273f, 0x2e1b192f, 0x4128233e, 0x4c01192e, 0x202f3719, 0x08440102, 0x55f70150, 0x4b39678f,
-    0xb7350648, 0x8c445a5d, 0x17018fd3, 0x5eb11901, 0xd29b5853, 0x7e27187a, 0x0c9a7da4, 0x4b290221, 0x4e080535, 0x01000000, 0xb1041b01, 0xb405b103,
-    0x25000900, 0x01201740, 0x01600150, 0x01040180, 0x0b200306, 0x8e03480f, 0x02058c09, 0x333f0093, 0x012bedfd, 0x315dc42f, 0x23150130, 0x23072327,
-    0x03333735, 0x02db69b1, 0xa4fe68e8, 0x8a14c504, 0x82ef148a, 0x02002f4e, 0x7c047401, 0x0b065803, 0x27001300, 0xb3628b00, 0x480f2c06, 0xe8ffb80d,
-    0x0f096140, 0x82180748, 0x83032004, 0x14410804, 0x10000084, 0x03002000, 0x00700030, 0x00b00080, 0x00d000c0, 0x01006006, 0x001f000f, 0x841e0002,
-    0x0a010a00, 0x0f7f8e19, 0x0f020f8f, 0x480c0940, 0x2f8e230f, 0x6f054f05, 0x0405df05, 0x052f050f, 0x340c843f, 0x059f057f, 0x050805bf, 0x48191640,
-    0x2b2f0005, 0xd4ed715d, 0x05f1622b, 0x5d5dd426, 0x31ed7271, 0x62058d66, 0x582820f4, 0x3d5b3c1e, 0x1e3c5b3d, 0x792a0787, 0x212e1d0d, 0x0d1e2e21,
-    0x07831e0d, 0x050d1d3d, 0x38482744, 0x48382121, 0x37482727, 0x48372121, 0x181d0f27, 0x1d180f0f, 0x831e0f0f, 0x001e2b07, 0xff000100, 0xcc03b104,
-    0xc382a905, 0x10405128, 0x1f1a1f0a, 0xed831e02, 0x0f053508, 0x0e020f15, 0x40e8ffb8, 0x480f0924, 0x1b0f831a, 0x1b3f1b2f, 0x1b8f1b7f, 0x0a1b1b05,
-    0x300b0083, 0x1a0b020b, 0x8c108f05, 0x000a8f15, 0x323f0093, 0x33edfded, 0x2005e54d, 0x24c3845d, 0x015d2b5d, 0x05304a22, 0x45230721, 0x3508052e,
-    0x023e3233, 0x030e3337, 0x542a0203, 0x17234d50, 0x050a131d, 0x2d14056f, 0x542c3b4a, 0x17214a50, 0x040a141e, 0x2b140570, 0x25b1044a, 0x1e10252d,
-    0x582d1d2c, 0x0a832c47, 0x1c2c1f26, 0x2d47582c, 0x2808af82, 0x04c301aa, 0x004c0222, 0xb50f0003, 0xb9000002, 0x3f00bc01, 0x2f2f01ed, 0x35133031,
-    0x03aa1521, 0x89c30178, 0xff010089, 0x202782f6, 0x202794d6, 0x22278203, 0x85e0040a, 0x01220827, 0x035e038d, 0x00cc053f, 0xb52a0003, 0x01160106,
-    0xffb80102, 0x0e1140f0, 0x9a034811, 0x99019700, 0x12820200, 0x00009c22, 0x75186584, 0x013007ee, 0x03012103, 0xf7fea93f, 0xcc053701, 0x6e0292fd,
-    0x00231f82, 0x828f0101, 0x8441204b, 0x4033244b, 0x82180022, 0x00092743, 0x09020019, 0x76181902, 0x00200c47, 0x0322c682, 0x528d019c, 0x012b5d24,
-    0x42822113, 0x0901a92a, 0x5e03c9fe, 0x92fd6e02, 0x01285482, 0x95fe5d01, 0x03010f03, 0x3b229f82, 0x53992840, 0x53822f20, 0x00100024, 0x76180002,
-    0xae870b9c, 0x5d205b86, 0xfe215b84, 0x265b8695, 0x03b10002, 0x841a045e, 0x000729af, 0x0506b557, 0x05020516, 0x0920fd83, 0x0b41b982, 0x82262009,
-    0x9a07300d, 0x99059704, 0x069f062f, 0x10060002, 0x41060206, 0x1020071c, 0x0524d982, 0x039c0107, 0x3323cd83, 0x832f0132, 0x5d2f2173, 0x2b267987,
-    0x2103015d, 0x03822101, 0xa9630228, 0x3701f7fe, 0x35413202, 0x0539410a, 0xb2000222, 0x1b208782, 0x68248786, 0x18044b40, 0x09277182, 0x02041904,
-    0x82190609, 0x8210206b, 0x33f9930e, 0x97069905, 0x04009a07, 0x04900410, 0x99010403, 0x9a039702, 0x21080741, 0x62410507, 0x85948406, 0xfded2895,
-    0x2b3031ed, 0x832b5d5d, 0x13012103, 0x03829882, 0xa9690228, 0xc9fe0901, 0x7941cefd, 0x6e02240a, 0x820092fd, 0x94fe2d97, 0x02011b04, 0x07000300,
-    0x4c406a00, 0x042997c4, 0x01059c00, 0x1000089b, 0x051f6df4, 0xfe2199a8, 0x42958394, 0x33080817, 0x03910150, 0x00bc037b, 0x40370013, 0x25111525,
-    0x03113511, 0x0d250d15, 0x1a030d35, 0x3a072a07, 0x031a0307, 0x033a032a, 0x10000003, 0x050a010a, 0x2f000f05, 0x2106f265, 0x4a613031, 0x7b033914,
-    0x3a664d2c, 0x2b4b6339, 0x39634b2b, 0x2c4d663a, 0x663aaa02, 0x4c2d2d4c, 0x64351582, 0x4a2b2b4a, 0x01010064, 0x038d005a, 0x00ac035d, 0x402e0008,
-    0x08856a18, 0x01014f22, 0x01221b82, 0x726a0102, 0x3333230b, 0x0a421801, 0xedd42105, 0x210a636a, 0x4f6aaa02, 0x203f8214, 0x205b826e, 0x225b8471,
-    0x611a4030, 0x00290981, 0xd0016001, 0x08010301, 0x0b716107, 0x6b615d85, 0x0a616105, 0x61200221, 0x51200658, 0x3f094e61, 0x00010000, 0x030000cc,
-    0x004505fe, 0xb7270003, 0x03100302, 0x01000503, 0x40f0ffb8, 0x1001000a, 0x023cb782, 0x00180006, 0x2f013f3f, 0x1233385d, 0x33382f39, 0x23213031,
-    0x42013301, 0x73bf0276, 0x00203682, 0x68084383, 0x04ecff5b, 0x005a0563, 0x4096003c, 0x01316955, 0x03470337, 0x2b030357, 0x350c2a2a, 0x0b390000,
-    0x3e1c0c0c, 0x39010133, 0x00201c6e, 0x17170117, 0x1616221c, 0x0e0b401c, 0x17011c48, 0x183b1873, 0x21732036, 0x186f2133, 0x01213f01, 0x21182118,
-    0x25732e06, 0x07252b2b, 0x30117306, 0x0b0b010b, 0x3f001911, 0x105d2f33, 0x200582ed, 0x06bb6610, 0x72115d21, 0x0126085a, 0x2f332b2f, 0x21821133,
-    0xed103223, 0x064e7232, 0x1282ac82, 0xaf821120, 0x5d5d0028, 0x031e2101, 0xd0603233, 0x23272909, 0x012e3335, 0x37363435, 0x30530882, 0x07172105,
-    0x08050749, 0x15210725, 0x15010e21, 0x03211714, 0x0835fe69, 0x50744d2a, 0x424b5734, 0x582a4c1e, 0x783e6c60, 0x0d477bb2, 0x82027783, 0x774d0800,
-    0xe5fb1d81, 0x575d6438, 0x8a3a522b, 0x53724956, 0xcd010b33, 0x010125fe, 0x01da0103, 0x547a4fcf, 0x251e122b, 0x2e1c8713, 0x7d441220, 0x17906db2,
-    0x231a1222, 0xecea8e12, 0x1e2c1c0e, 0x1c3a2a8c, 0x8d5f7a47, 0x2a152b0e, 0x00000020, 0x07576501, 0x00030027, 0x03184028, 0x2a128296, 0x05040000,
-    0x000f9b01, 0x823f001f, 0x0e402815, 0x00004811, 0x695d2b2f, 0xc265052d, 0x11332a05, 0x01ebf001, 0xfe2b01a4, 0x2d3082d5, 0x4d022501, 0x4505c702,
-    0x44001200, 0xe0641c40, 0x09003914, 0x03090901, 0x1101b80e, 0xe40110b3, 0x1201b800, 0x32ed3f00, 0x2f33333f, 0x0a825787, 0x0805e964, 0x01303130,
-    0x0e113335, 0x32352303, 0x3337023e, 0x01153311, 0x2f0d8749, 0x120d2f33, 0x112f3330, 0x4d027479, 0x1a01026b, 0x770a1724, 0x212c1b0c, 0x235873fd,
-    0x02fa3805, 0x0504034d, 0x00200051, 0x1500b94f, 0x2040d8ff, 0x1f481109, 0x69e1171f, 0x5f2d1079, 0x0e0e010e, 0xb814e40b, 0x01b31301, 0x208c891e,
-    0x5d8c82ed, 0xa24906e6, 0x312f2607, 0x132b0030, 0x147f6935, 0xfa153808, 0x54544a18, 0x3c332a44, 0x82083b3d, 0x5c412706, 0x2e79783d, 0x44525647,
-    0x027c0110, 0x5537614d, 0x47403f48, 0x3e40392c, 0x502f053d, 0x6770213a, 0x414b5937, 0x8526413f, 0x02ea24af, 0x82ed023b, 0x003325af, 0x2a00b98a,
-    0x4020af82, 0x0321af82, 0x32048228, 0x1c101c00, 0x7b031c20, 0xe1220130, 0x2d0a2323, 0x82181ce1, 0x000a2901, 0xe10b11e1, 0x3511110a, 0x2e087e5c,
-    0x16171830, 0x5f280e16, 0x22220122, 0x8228e41f, 0x09402dcf, 0x5005e40e, 0x0b0b010b, 0x1401b805, 0x2007bc42, 0x26d882ed, 0x2f391211, 0x823911c4,
-    0x825d20df, 0xed102109, 0x6906ce42, 0x00220589, 0xa958015d, 0x0f771805, 0x0c8b690a, 0x34353627, 0x06222326, 0x3d7a1807, 0x06740808, 0x011e1507,
-    0x4427ed02, 0x5c40385e, 0x8806223e, 0x36304109, 0x36291942, 0x4425291d, 0x2d293640, 0x07870642, 0x3055442c, 0x1d3a573a, 0x4b524543, 0x53361a03,
-    0x3c251d39, 0x3c0d274c, 0x25413c3d, 0x6d0a1a2f, 0x32354239, 0x360c393f, 0x1f1a3650, 0x422a4a37, 0x12021a55, 0x02000064, 0x4b02c500, 0x45053503,
-    0x17000a00, 0x12405d00, 0x01080909, 0x600612e0, 0x07c27b18, 0x11192c08, 0x401701b8, 0x0d400420, 0x04004811, 0x04020410, 0x08e40400, 0x1f110f05,
-    0x9f112f11, 0x0511bf11, 0x0b011111, 0x1101ba06, 0x76010100, 0x78180614, 0x2b2108cc, 0x08ff82ed, 0x33335d4a, 0x2f3232ed, 0x15013031, 0x35213523,
-    0x33113301, 0x030e0315, 0x11210307, 0x0236023c, 0x89fe7fbb, 0x7a8d6901, 0x181506f8, 0x01b90717, 0xec020109, 0x0163a1a1, 0x650cfef6, 0x1f09d901,
-    0xff0a2022, 0x0d040100, 0x001b1f20, 0x1e240083, 0x01006e01, 0x03820883, 0x6c003522, 0x01240b86, 0xb2000700, 0x02200b86, 0xca200b82, 0x03240b86,
-    0xf8001200, 0x04240b86, 0x1b010700, 0x05240b86, 0x3d010c00, 0x06200b86, 0x5a201782, 0x07220b86, 0xe1825000, 0x08245f85, 0x7f021400, 0x09231786,
-    0x87020e00, 0x010a245f, 0x86890563, 0x000b2417, 0x8627071c, 0x000c240b, 0x86a2072e, 0x000d230b, 0x5f870835, 0x1a000e26, 0x0300a908, 0x0920c482,
-    0x6a20b382, 0x0b850382, 0x0e000124, 0x1786a200, 0x0b820220, 0x0b86ba20, 0x24000324, 0x0b86d200, 0x0e000424, 0x0b860b01, 0x18000524, 0x0b862301,
-    0x17820620, 0x0b864a20, 0xa0000724, 0x0b866201, 0x28000824, 0x0b865502, 0x1c000924, 0x0b869402, 0xc6020a24, 0x0b86c102, 0x38000b24, 0x0b86ed06,
-    0x5c000c24, 0x0b864407, 0x6a000d24, 0x0b86d107, 0x34000e2a, 0x44007308, 0x67006900, 0x74200382, 0x7a260382, 0x64006500, 0x03822000, 0x74006124,
-    0x09826100, 0x6f006328, 0x79007000, 0x25847200, 0x15826820, 0x28002026, 0x29006300, 0x32241b82, 0x31003000, 0x20220382, 0x25824700, 0x45826f20,
-    0x3f826c20, 0x43002022, 0x72200d82, 0x6f203582, 0x47833582, 0x0f826920, 0x006e3808, 0x4400002e, 0x74696769, 0x64657a69, 0x74616420, 0x6f632061,
-    0x69727970, 0x20746867, 0x20296328, 0x30313032, 0x6f6f4720, 0x20656c67, 0x70726f43, 0x7461726f, 0x826e6f69, 0x224f8336, 0x82730075, 0x826e2081,
-    0x43002a5f, 0x6973756f, 0x0000656e, 0x240d8252, 0x00750067, 0x20a9826c, 0x240e8272, 0x6c756765, 0x20088261, 0x202b8241, 0x201b8263, 0x20c7826e,
-    0x22838265, 0x822d0020, 0x29458ead, 0x65637341, 0x7265646e, 0x6d822d20, 0x228e5086, 0x56216888, 0x83468300, 0x006f2280, 0x204a826e, 0x20cc8231,
-    0x24f88230, 0x72655600, 0x25a38273, 0x302e3120, 0xf7840030, 0x568da793, 0xc7822020, 0x44827320, 0x03826120, 0x9d827420, 0xa5846120, 0xc3846d20,
-    0x13826b20, 0x66006f22, 0x51410582, 0x8261200d, 0x82642076, 0x20258315, 0x20078279, 0x20908262, 0x223b8220, 0x84670065, 0x8474204d, 0x05bb41a0,
-    0x2b826920, 0x63002022, 0x74201184, 0x0f855582, 0x75006a22, 0x69242f82, 0x64007300, 0x63223182, 0x05827400, 0x7320cc83, 0x5141ca82, 0x69203107,
-    0x20612073, 0x64617274, 0x72616d65, 0x666f206b, 0x3d078f41, 0x20646e61, 0x2079616d, 0x72206562, 0x73696765, 0x65726574, 0x6e692064, 0x72656320,
-    0x07826174, 0x72756a2f, 0x69647369, 0x6f697463, 0x002e736e, 0x11824100, 0x20151442, 0x08864100, 0x220af241, 0x82530000, 0x0065229f, 0x20e58476,
-    0x20c3824d, 0x220f8474, 0x826f0073, 0x53002edb, 0x65766574, 0x74614d20, 0x6f736574, 0x0f76416e, 0x77002022, 0x73223082, 0xe8822000, 0xee826520,
-    0x67006922, 0x1a413482, 0x00622205, 0x9b178279, 0x8620205c, 0x8261203b, 0x00202233, 0x20058269, 0x2074826e, 0x20828476, 0x20908469, 0x2041822c,
-    0x21988272, 0x05830066, 0x68007322, 0x67202584, 0x73201582, 0x6e202582, 0x20207182, 0x65200382, 0x69221d82, 0x858e6600, 0xc6822020, 0x4b846820,
-    0xa3835b83, 0x49826d20, 0x2b847420, 0x17826320, 0x6c006c22, 0x6320a184, 0x6d227382, 0x29847000, 0x62006922, 0x65201582, 0x77204982, 0x74206982,
-    0x60436f82, 0x84752005, 0x05de4235, 0x45824e20, 0x22217724, 0xe6422e00, 0x82202010, 0x82662049, 0x05bf4287, 0x6d207583, 0x72205782, 0x1341d384,
-    0x826f2005, 0x822d20e3, 0x846320b1, 0x846520cf, 0x22d983f7, 0x82640061, 0x8262207f, 0x846c2073, 0x82792077, 0x8263205b, 0x8261207d, 0x00612227,
-    0x85c98263, 0x827320e3, 0x82692009, 0x05d2420f, 0x35826e20, 0xb183e585, 0x6e25c183, 0x45002d00, 0x20ad8300, 0x2079826f, 0x20538265, 0x2449826e,
-    0x00470057, 0x2051944c, 0x208b8220, 0x20538265, 0x20298420, 0x20238264, 0x22ad8273, 0x8276006c, 0x206383e3, 0x83838274, 0x826e205b, 0x8265200f,
-    0x4313836d, 0x64200532, 0x25831182, 0x2f826c20, 0x0b827020, 0x49827220, 0x83002021, 0x006f220d, 0x08a5416b, 0x1d826620, 0x55827220, 0x11827720,
-    0x67826420, 0x9f826820, 0x83156f41, 0x826e2029, 0x20758521, 0x2033826f, 0x206f8261, 0x20ff8264, 0x42598265, 0x6f200561, 0x7522f982, 0x6d826d00,
-    0x20202983, 0x2006f444, 0x10394174, 0x27826120, 0x79827220, 0x93847320, 0x95827020, 0x59826120, 0x6d208b85, 0x2e211382, 0x08844300, 0x7361772f,
-    0x73656420, 0x656e6769, 0x79622064, 0x0dee4220, 0x1d822020, 0x6e612308, 0x6e6e6920, 0x7461766f, 0x2c657669, 0x66657220, 0x68736572, 0x20676e69,
-    0x736e6173, 0x72657320, 0x42866669, 0x68742037, 0x69207461, 0x656d2073, 0x63697274, 0x796c6c61, 0x6d6f6320, 0x353a8270, 0x20656c62, 0x68746977,
-    0x756f4320, 0x72656972, 0x77654e20, 0x0c452eaa, 0x6f202d07, 0x72656666, 0x6d692073, 0x766f7270, 0x6f288982, 0x63732d6e, 0x6e656572, 0x61276f82,
-    0x69626164, 0x8274696c, 0x6168254b, 0x74636172, 0x73287182, 0x73636974, 0x646e6120, 0x652b7282, 0x6e617020, 0x7275452d, 0x8265706f, 0x475724ac,
-    0x8763204c, 0x209e8228, 0x25268474, 0x766c6f73, 0x2d847365, 0x65656e24, 0x71827364, 0x7622b482, 0x34826c65, 0x6c237882, 0x836b6f6f, 0x6f6622d2,
-    0x23a68272, 0x2d687464, 0x6623b78a, 0x82746e6f, 0x206f363a, 0x72646461, 0x20737365, 0x75636f64, 0x746e656d, 0x726f7020, 0x239c8774, 0x6f726361,
-    0x70231b82, 0x8274616c, 0x736d2745, 0x6800002e, 0x01827400, 0x3a007024, 0x01822f00, 0x83007721, 0x002e2201, 0x0e304661, 0x6f006329, 0x70007200,
-    0x42002e00, 0x2f200519, 0x742a3882, 0x2f3a7074, 0x7777772f, 0x3946612e, 0x6f632406, 0x822e7072, 0xb61d8394, 0x00742256, 0x20668279, 0x0eaa4465,
-    0x8e827220, 0xaa842e20, 0x6c006d22, 0x74237a9d, 0x42657079, 0x7225062c, 0x74682e73, 0x222f826d, 0x8269004c, 0x006522b7, 0x4346826e, 0x752005e3,
-    0x64210b82, 0x052b4400, 0x28073f43, 0x00490053, 0x0020004c, 0x2080844f, 0x2009826e, 0x42f58246, 0x418d05c5, 0x1b822c20, 0x08130147, 0x00003123,
-    0x6563694c, 0x6465736e, 0x646e7520, 0x74207265, 0x53206568, 0x4f204c49, 0x206e6570, 0x746e6f46, 0x21208620, 0x2947202c, 0x41368209, 0x73200d85,
-    0x7220ad82, 0x7022b382, 0xf8847400, 0x0b827320, 0x2e006c22, 0x72248d82, 0x2f006700, 0x4620a182, 0x0021a982, 0x05814168, 0x72637333, 0x73747069,
-    0x6c69732e, 0x67726f2e, 0x4c464f2f, 0x21008200, 0x00840002, 0x0023fe23, 0x20088254, 0x8d038201, 0x84d82002, 0x02580815, 0x04000300, 0x06000500,
-    0x08000700, 0x0a000900, 0x0c000b00, 0x0e000d00, 0x10000f00, 0x12001100, 0x14001300, 0x16001500, 0x18001700, 0x1a001900, 0x1c001b00, 0x1e001d00,
-    0x20001f00, 0x22002100, 0x24002300, 0x26002500, 0x28002700, 0x2a002900, 0x2c002b00, 0x2e002d00, 0x3c08a682, 0x00310030, 0x00330032, 0x00350034,
-    0x00370036, 0x00390038, 0x003b003a, 0x003d003c, 0x003f003e, 0x00410040, 0x00430042, 0x00450044, 0x00470046, 0x00490048, 0x004b004a, 0x004d004c,
-    0x26e4824e, 0x00510050, 0x82530052, 0x550c09bf, 0x57005600, 0x59005800, 0x5b005a00, 0x5d005c00, 0x5f005e00, 0x61006000, 0x8400a300, 0xbd008500,
-    0xe8009600, 0x8e008600, 0x9d008b00, 0xa400a900, 0xda008a00, 0x93008300, 0x03010201, 0x97008d00, 0xc3008800, 0x0401de00, 0xaa009e00, 0xf400f500,
-    0xa200f600, 0xc900ad00, 0xae00c700, 0x63006200, 0x64009000, 0x6500cb00, 0xca00c800, 0xcc00cf00, 0xce00cd00, 0x6600e900, 0xd000d300, 0xaf00d100,
-    0xf0006700, 0xd6009100, 0xd500d400, 0xeb006800, 0x8900ed00, 0x69006a00, 0x6d006b00, 0x6e006c00, 0x6f00a000, 0x70007100, 0x73007200, 0x74007500,
-    0x77007600, 0x7800ea00, 0x79007a00, 0x7d007b00, 0xb8007c00, 0x7f00a100, 0x80007e00, 0xec008100, 0xba00ee00, 0xb000d700, 0xd800b100, 0xd900dd00,
-    0xb300b200, 0xb700b600, 0xb400c400, 0xc500b500, 0xbe008700, 0xbc00bf00, 0x06010501, 0x08010701, 0x0a010901, 0x696e7507, 0x32423030, 0x33200786,
-    0x39250786, 0x72754504, 0x330c836f, 0x39313232, 0x656e6f0b, 0x63617266, 0x6e6f6974, 0x6f77740b, 0x0d240b87, 0x65726874, 0x69281984, 0x0c6e6f74,
-    0x72756f66, 0x00201a87, 0x032c0083, 0x02000800, 0x01001100, 0x0300ffff, 0x01201082, 0x00220382, 0x05820100, 0x03820e20, 0x03821820, 0x1f820020,
-    0x11820120, 0x0382d720, 0x0f820420, 0x83000221, 0x24218300, 0xb0fec700, 0x2b0c83df, 0x248976bd, 0x00000000, 0xc42d6fc9, 0x2c56fa05, 0x00009529,
-};
-
 // File: 'DroidSans.ttf' (190044 bytes)
 // Exported using binary_to_compressed_c
 static const unsigned int droid_compressed_size = 134345;
@@ -0,0 +1,81 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#include "font.h"
+#include "font_atlas.h"
+
+#include <imgui.h>
+
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+// Zero runs are most of the atlas; see font_atlas.h for the encoding.
+std::vector<unsigned char> encode(const unsigned char* pixels, int count) {
+    std::vector<unsigned char> encoded;
+    for (int i = 0; i < count;) {
+        if (pixels[i] != 0) {
+            encoded.push_back(pixels[i++]);
+            continue;
+        }
+        int run = 1;
+        while (run < 256 && i + run < count && pixels[i + run] == 0)
+            ++run;
+        encoded.push_back(0);
+        encoded.push_back((unsigned char)(run - 1));
+        i += run;
+    }
+    return encoded;
+}
+
+}
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        std::fprintf(stderr, "usage: beagle-font-baker OUTPUT\n");
+        return 1;
+    }
+
+    ImFontAtlas atlas;
+    ImFont* font = atlas.AddFontFromMemoryCompressedTTF(droid_compressed_data, droid_compressed_size, BAKED_FONT_SIZE);
+    unsigned char* pixels;
+    int width, height;
+    atlas.GetTexDataAsAlpha8(&pixels, &width, &height);
+    const auto encoded = encode(pixels, width * height);
+
+    FILE* file = std::fopen(argv[1], "w");
+    if (!file) {
+        std::perror(argv[1]);
+        return 1;
+    }
+
+    std::fprintf(file, "// Generated by beagle-font-baker from %s at %g px. Do not edit.\n\n", BAKED_FONT_NAME, BAKED_FONT_SIZE);
+    std::fprintf(file, "static const int baked_atlas_width = %d;\n", width);
+    std::fprintf(file, "static const int baked_atlas_height = %d;\n", height);
+    std::fprintf(file, "static const float baked_white_pixel_u = %.9g;\n", atlas.TexUvWhitePixel.x);
+    std::fprintf(file, "static const float baked_white_pixel_v = %.9g;\n", atlas.TexUvWhitePixel.y);
+    std::fprintf(file, "static const float baked_font_size = %.9g;\n", font->FontSize);
+    std::fprintf(file, "static const float baked_font_ascent = %.9g;\n", font->Ascent);
+    std::fprintf(file, "static const float baked_font_descent = %.9g;\n\n", font->Descent);
+
+    std::fprintf(file, "static const BakedGlyph baked_glyphs[] =\n{\n");
+    for (int i = 0; i < font->Glyphs.Size; ++i) {
+        const auto& glyph = font->Glyphs[i];
+        // The tab glyph is derived from the space by BuildLookupTable().
+        if (glyph.Codepoint == '\t')
+            continue;
+        std::fprintf(file, "    { %u, %.9g, %.9g, %.9g, %.9g, %.9g, %.9g, %.9g, %.9g, %.9g },\n",
+            (unsigned)glyph.Codepoint, glyph.XAdvance,
+            glyph.X0, glyph.Y0, glyph.X1, glyph.Y1,
+            glyph.U0, glyph.V0, glyph.U1, glyph.V1);
+    }
+    std::fprintf(file, "};\n\n");
+
+    std::fprintf(file, "// %d x %d alpha, %d bytes encoded\n", width, height, (int)encoded.size());
+    std::fprintf(file, "static const unsigned char baked_atlas_pixels[] =\n{");
+    for (size_t i = 0; i < encoded.size(); ++i)
+        std::fprintf(file, "%s%u,", (i % 24 == 0) ? "\n    " : "", (unsigned)encoded[i]);
+    std::fprintf(file, "\n};\n");
+
+    return std::fclose(file) == 0 ? 0 : 1;
+}
@@ -1,56 +1,186 @@
 //  Copyright (c) 2015 hoseking. All rights reserved.
 
-#include "font.h"
+#include "imgui_impl_gl3.h"
 #include "imgui_impl_glfw.h"
+#include "Event.h"
+#include "EventFilter.h"
+#include "EventLog.h"
+#include "EventMerger.h"
 #include "MidiManager.h"
 #include "MidiTypes.h"
+#include "PortWatcher.h"
+#include "SpscRing.h"
+#include "SysExPool.h"
+#include "TrafficStats.h"
 
 #include <GLFW/glfw3.h>
 #include <imgui.h>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <functional>
+#include <future>
 #include <map>
-#include <mutex>
+#include <memory>
 #include <string>
 #include <thread>
-#include <queue>
+#include <vector>
+
+using InputRing = midi::SpscRing<midi::Event, 4096>;
 
 midi::MidiManager midiManager;
-std::string selectedInputPort;
+midi::PortWatcher portWatcher;
 std::string selectedOutputPort;
 std::map<std::string, bool> inputPortNamesMap;
 std::map<std::string, bool> outputPortNamesMap;
-std::deque<std::pair<midi::ChannelMessage, double>> inputLog;
-std::deque<midi::ChannelMessage> outputLog;
-std::mutex inputMutex;
+// Connections in flight on the manager's control thread.
+std::map<std::string, std::future<bool>> pendingInputs;
+std::future<bool> pendingOutput;
+midi::SysExPool sysExPool;
+midi::EventLog inputLog(1 << 20, &sysExPool, true);
+midi::EventLog outputLog(1 << 16);
+std::unique_ptr<InputRing> inputRings[256];
+std::vector<midi::byte> inputRingPorts;
+midi::EventMerger inputMerger;
+midi::FilteredView inputFilter;
+bool inputFilterActive = false;
+midi::TrafficStats trafficStats;
+bool showTrafficWindow = false;
+bool showSysExWindow = false;
+uint64_t selectedSysEx = 0;
+std::atomic<bool> redrawPending(false);
+int maxFrameRate = 60;
+// The fixed function renderer is kept for comparison; run with --legacy-gl.
+bool coreProfile = true;
+double renderMilliseconds = 0.0;
+
+// Wakes the render loop. Only the first request per frame posts an event.
+void requestRedraw() {
+    if (!redrawPending.exchange(true, std::memory_order_acq_rel))
+        glfwPostEmptyEvent();
+}
 
-void closePort() {
-    for (auto& pair : inputPortNamesMap) {
-        pair.second = false;
+// Each input thread publishes into its own ring, created before the port
+// opens so the callback never races its allocation.
+void openInputPort(const std::string& portName) {
+    const auto port = midiManager.inputPortId(portName);
+    if (port == midi::MidiManager::kNoPortId) {
+        inputPortNamesMap[portName] = false;
+        return;
     }
+    if (!inputRings[port]) {
+        inputRings[port].reset(new InputRing());
+        inputRingPorts.push_back(port);
+    }
+
+    // One wakeup per driver batch rather than per event.
+    auto messagesRecieved = [](const midi::Event* events, size_t count) {
+        for (size_t index = 0; index < count; ++index) {
+            const auto& event = events[index];
+            if (!inputRings[event.port]->push(event) && event.isSysEx())
+                sysExPool.release(event.payload());
+        }
+        requestRedraw();
+    };
+    inputPortNamesMap[portName] = true;
+    pendingInputs[portName] = midiManager.openBatchedInputPortAsync(portName, messagesRecieved);
+}
+
+// Dropping a pending future discards its result; the close is queued after
+// the open, so the port ends up closed either way.
+void closeInputPort(const std::string& portName) {
+    pendingInputs.erase(portName);
+    midiManager.closeInputPortAsync(portName);
+    inputPortNamesMap[portName] = false;
+}
+
+void openOutputPort(const std::string& portName) {
     for (auto& pair : outputPortNamesMap) {
         pair.second = false;
     }
-    midiManager.closePort();
+    selectedOutputPort = portName;
+    outputPortNamesMap[portName] = true;
+    pendingOutput = midiManager.openOutputPortAsync(portName);
 }
 
-void openPort() {
-    closePort();
-    inputPortNamesMap[selectedInputPort] = true;
-    outputPortNamesMap[selectedOutputPort] = true;
+void closeOutputPort() {
+    selectedOutputPort = "";
+    pendingOutput = std::future<bool>();
+    midiManager.closeOutputPortAsync();
+}
 
-    auto messageRecieved = [](const midi::ChannelMessage& message, const double& delay) {
-        inputMutex.lock();
-        inputLog.push_front({message, delay});
-        inputMutex.unlock();
-    };
-    midiManager.openPort(selectedInputPort, selectedOutputPort, messageRecieved);
+bool isReady(const std::future<bool>& future) {
+    return future.valid() && future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+bool connectionsPending() {
+    return !pendingInputs.empty() || pendingOutput.valid();
+}
+
+// Checkboxes are ticked when clicked and cleared here if the open failed.
+void applyConnections() {
+    for (auto it = pendingInputs.begin(); it != pendingInputs.end();) {
+        if (!isReady(it->second)) {
+            ++it;
+            continue;
+        }
+        const auto found = inputPortNamesMap.find(it->first);
+        const bool opened = it->second.get();
+        if (found != inputPortNamesMap.end())
+            found->second = opened;
+        it = pendingInputs.erase(it);
+    }
+
+    if (isReady(pendingOutput)) {
+        const auto found = outputPortNamesMap.find(selectedOutputPort);
+        const bool opened = pendingOutput.get();
+        if (found != outputPortNamesMap.end())
+            found->second = opened;
+        if (!opened)
+            selectedOutputPort = "";
+    }
+}
+
+uint64_t droppedInputCount() {
+    uint64_t dropped = inputMerger.overflowCount();
+    for (auto port : inputRingPorts) {
+        dropped += inputRings[port]->overflowCount();
+    }
+    return dropped;
+}
+
+void drainInput() {
+    redrawPending.store(false, std::memory_order_release);
+    for (auto port : inputRingPorts) {
+        inputRings[port]->drain([](const midi::Event& event) {
+            if (!inputMerger.add(event) && event.isSysEx())
+                sysExPool.release(event.payload());
+        });
+    }
+    inputMerger.merge(midi::monotonicNanoseconds(), [](const midi::Event& event) {
+        inputLog.push(event);
+    });
+}
+
+// The first real device; the in-process loopback is only opened by hand.
+std::map<std::string, bool>::const_iterator defaultPort(const std::map<std::string, bool>& portNamesMap) {
+    for (auto it = portNamesMap.begin(); it != portNamesMap.end(); ++it) {
+        if (it->first != midi::kLoopbackPortName)
+            return it;
+    }
+    return portNamesMap.end();
 }
 
 void refreshPorts() {
     midiManager.closePort();
+    pendingInputs.clear();
+    pendingOutput = std::future<bool>();
     inputPortNamesMap.clear();
     outputPortNamesMap.clear();
     inputLog.clear();
@@ -64,15 +194,68 @@ void refreshPorts() {
         outputPortNamesMap[portName] = false;
     }
 
-    if (inputPortNamesMap.size() > 0) {
-        selectedInputPort = inputPortNamesMap.begin()->first;
+    const auto input = defaultPort(inputPortNamesMap);
+    if (input != inputPortNamesMap.end()) {
+        openInputPort(input->first);
+    }
+
+    const auto output = defaultPort(outputPortNamesMap);
+    if (output != outputPortNamesMap.end()) {
+        openOutputPort(output->first);
+    }
+}
+
+// Ports that stay keep their connections and the logs are untouched. A
+// port that goes away while open is closed.
+void applyPortChange(const midi::PortChange& change) {
+    const bool input = change.direction == midi::Direction::Input;
+    auto& portNamesMap = input ? inputPortNamesMap : outputPortNamesMap;
+    if (change.kind == midi::PortChange::Kind::Added) {
+        portNamesMap.emplace(change.name, false);
+        return;
+    }
+
+    const auto found = portNamesMap.find(change.name);
+    if (found == portNamesMap.end())
+        return;
+    if (input && found->second) {
+        closeInputPort(change.name);
+    } else if (!input && selectedOutputPort == change.name) {
+        closeOutputPort();
+    }
+    portNamesMap.erase(found);
+}
+
+void applyPortChanges() {
+    static std::vector<midi::PortChange> changes;
+    portWatcher.takeChanges(changes);
+    if (!changes.empty())
+        midiManager.invalidatePorts();
+    for (auto& change : changes) {
+        applyPortChange(change);
     }
+    changes.clear();
+}
 
-    if (outputPortNamesMap.size() > 0) {
-        selectedOutputPort = outputPortNamesMap.begin()->first;
+// Re-enumerates by hand, for backends that announce nothing.
+void syncPorts(std::map<std::string, bool>& portNamesMap, const std::vector<std::string>& portNames, midi::Direction direction) {
+    std::vector<midi::PortChange> changes;
+    for (auto& pair : portNamesMap) {
+        if (std::find(portNames.begin(), portNames.end(), pair.first) == portNames.end())
+            changes.push_back({midi::PortChange::Kind::Removed, direction, pair.first, -1, -1});
+    }
+    for (auto& portName : portNames) {
+        changes.push_back({midi::PortChange::Kind::Added, direction, portName, -1, -1});
     }
+    for (auto& change : changes) {
+        applyPortChange(change);
+    }
+}
 
-    openPort();
+void syncPorts() {
+    midiManager.invalidatePorts();
+    syncPorts(inputPortNamesMap, midiManager.getInputPortNames(), midi::Direction::Input);
+    syncPorts(outputPortNamesMap, midiManager.getOutputPortNames(), midi::Direction::Output);
 }
 
 void showInputs() {
@@ -85,8 +268,18 @@ void showInputs() {
         auto portName = pair.first;
         auto selected = &pair.second;
         if (ImGui::Checkbox(portName.c_str(), selected)) {
-            selectedInputPort = *selected ? portName : "";
-            openPort();
+            if (*selected)
+                openInputPort(portName);
+            else
+                closeInputPort(portName);
+        }
+        if (pendingInputs.count(portName)) {
+            ImGui::SameLine();
+            ImGui::TextDisabled("connecting...");
+        } else if (*selected) {
+            const auto timing = midiManager.inputPortTiming((midi::byte)midiManager.inputPortId(portName));
+            ImGui::SameLine();
+            ImGui::TextDisabled("jitter %.3f ms", timing.jitter * 1e-6);
         }
     }
     ImGui::EndChild();
@@ -104,8 +297,14 @@ void showOutputs() {
         auto portName = pair.first;
         auto selected = &pair.second;
         if (ImGui::Checkbox(portName.c_str(), selected)) {
-            selectedOutputPort = *selected ? portName : "";
-            openPort();
+            if (*selected)
+                openOutputPort(portName);
+            else
+                closeOutputPort();
+        }
+        if (pendingOutput.valid() && selectedOutputPort == portName) {
+            ImGui::SameLine();
+            ImGui::TextDisabled("connecting...");
         }
     }
     ImGui::EndChild();
@@ -119,9 +318,35 @@ void showOptions() {
     ImGui::Separator();
 
     if (ImGui::Button("Refresh Devices")) {
-        refreshPorts();
+        syncPorts();
+    }
+
+    ImGui::SameLine();
+    ImGui::Checkbox("Traffic", &showTrafficWindow);
+
+    if (ImGui::InputInt("Max FPS", &maxFrameRate))
+        maxFrameRate = std::max(1, std::min(maxFrameRate, 240));
+
+    static int maxEvents = (int)inputLog.capacity();
+    static int maxAgeSeconds = 0;
+    bool retentionChanged = ImGui::InputInt("Max Events", &maxEvents, 1000, 100000);
+    retentionChanged |= ImGui::InputInt("Max Age (s)", &maxAgeSeconds);
+    if (retentionChanged) {
+        maxEvents = std::max(1, std::min(maxEvents, (int)inputLog.capacity()));
+        maxAgeSeconds = std::max(0, maxAgeSeconds);
+
+        midi::RetentionPolicy policy;
+        policy.maxCount = maxEvents;
+        policy.maxAge = maxAgeSeconds * 1000000000ull;
+        inputLog.setRetention(policy);
+        outputLog.setRetention(policy);
     }
 
+    if (coreProfile)
+        ImGui::TextDisabled("Render %.2f ms, %d draws (GL 3.2)", renderMilliseconds, ImGui_ImplGL3_DrawCallCount());
+    else
+        ImGui::TextDisabled("Render %.2f ms (legacy GL)", renderMilliseconds);
+
     ImGui::EndChild();
 }
 
@@ -175,21 +400,121 @@ void showOutput() {
         uint8_t statusByte = typeByte | channelByte;
         midi::ChannelMessage message(statusByte, dataByte1, dataByte2);
         midiManager.sendMessage(message);
-        outputLog.push_front(message);
+        outputLog.push(midi::Event::make(message, midi::monotonicNanoseconds(), 0, midi::Direction::Output));
     }
 
     ImGui::EndChild();
 }
 
+enum class LogJump {
+    None,
+    Newest,
+    Oldest
+};
+
+void showJumpButtons(LogJump& jump) {
+    ImGui::SameLine();
+    if (ImGui::SmallButton("Newest"))
+        jump = LogJump::Newest;
+    ImGui::SameLine();
+    if (ImGui::SmallButton("Oldest"))
+        jump = LogJump::Oldest;
+}
+
+// Rows are evenly spaced, so jumping only needs the scroll extents.
+void applyJump(LogJump& jump) {
+    if (jump == LogJump::Newest)
+        ImGui::SetScrollY(0);
+    else if (jump == LogJump::Oldest)
+        ImGui::SetScrollY(ImGui::GetScrollMaxY());
+    jump = LogJump::None;
+}
+
+// One line of controls over the input log. Changing them rescans the log;
+// new events are matched incrementally as they arrive.
+// Seconds as the log shows them, or fallback if the field is empty.
+uint64_t parseSeconds(const char* text, uint64_t fallback) {
+    char* end;
+    const auto seconds = std::strtod(text, &end);
+    if (end == text || seconds < 0)
+        return fallback;
+    return (uint64_t)(seconds * 1e9 + 0.5);
+}
+
+void showInputFilter() {
+    static const char* types = "Any\0Note Off\0Note On\0Poly AT\0CC\0Program\0Channel AT\0Pitch\0System\0\0";
+    static const char* channels = "Any\0" "1\0" "2\0" "3\0" "4\0" "5\0" "6\0" "7\0" "8\0" "9\0" "10\0" "11\0" "12\0" "13\0" "14\0" "15\0" "16\0\0";
+    static int type = 0;
+    static int channel = 0;
+    static int data1[2] = {0, 127};
+    static int data2[2] = {0, 127};
+    static char timeMin[24] = "";
+    static char timeMax[24] = "";
+
+    bool changed = false;
+    ImGui::PushItemWidth(110);
+    changed |= ImGui::Combo("Type##filter", &type, types);
+    ImGui::SameLine();
+    changed |= ImGui::Combo("Channel##filter", &channel, channels);
+    ImGui::SameLine();
+    changed |= ImGui::DragIntRange2("Data 1##filter", &data1[0], &data1[1], 0.25f, 0, 127);
+    ImGui::SameLine();
+    changed |= ImGui::DragIntRange2("Data 2##filter", &data2[0], &data2[1], 0.25f, 0, 127);
+    ImGui::SameLine();
+    changed |= ImGui::InputText("From##filter", timeMin, sizeof(timeMin), ImGuiInputTextFlags_CharsDecimal);
+    ImGui::SameLine();
+    changed |= ImGui::InputText("To##filter", timeMax, sizeof(timeMax), ImGuiInputTextFlags_CharsDecimal);
+    ImGui::PopItemWidth();
+
+    if (changed) {
+        midi::EventQuery query;
+        if (type == 8) {
+            query.statusMin = 0xF0;
+        } else if (type > 0) {
+            query.statusMask = 0xF0;
+            query.statusValue = (midi::byte)(0x70 + type * 0x10);
+        }
+        if (channel > 0) {
+            query.statusMask |= 0x0F;
+            query.statusValue |= (midi::byte)(channel - 1);
+            // Bounded to channel messages so the index can use its channel lists.
+            query.statusMin = std::max<midi::byte>(query.statusMin, 0x80);
+            query.statusMax = std::min<midi::byte>(query.statusMax, 0xEF);
+        }
+        // A full range stays open so SysEx payload ids are not filtered out.
+        query.data1Min = (midi::byte)data1[0];
+        query.data1Max = data1[1] == 127 && data1[0] == 0 ? 0xFF : (midi::byte)data1[1];
+        query.data2Min = (midi::byte)data2[0];
+        query.data2Max = data2[1] == 127 && data2[0] == 0 ? 0xFF : (midi::byte)data2[1];
+        query.timeMin = parseSeconds(timeMin, 0);
+        query.timeMax = parseSeconds(timeMax, UINT64_MAX);
+        inputFilterActive = !query.matchesAll();
+        inputFilter.setQuery(query);
+    }
+    if (inputFilterActive) {
+        inputFilter.update(inputLog.store(), inputLog.index());
+        ImGui::SameLine();
+        ImGui::TextDisabled("%zu matches (%s)", inputFilter.size(), midi::filterKernelName());
+    }
+}
+
 void showInputLog() {
-    if(!inputMutex.try_lock())
-        return;
+    static LogJump jump = LogJump::None;
 
     ImGui::BeginChild("input log");
-    ImGui::Text("Input Log");
+    const auto dropped = droppedInputCount();
+    if (dropped > 0) {
+        ImGui::Text("Input Log (%llu dropped)", (unsigned long long)dropped);
+    } else {
+        ImGui::Text("Input Log");
+    }
+    showJumpButtons(jump);
+    showInputFilter();
 
     ImGui::BeginChild("header", {0, 26});
-    ImGui::Columns(5);
+    ImGui::Columns(7);
+    ImGui::Text("Port");    ImGui::NextColumn();
+    ImGui::Text("Time");    ImGui::NextColumn();
     ImGui::Text("Delay");   ImGui::NextColumn();
     ImGui::Text("Type");    ImGui::NextColumn();
     ImGui::Text("Channel"); ImGui::NextColumn();
@@ -199,26 +524,99 @@ void showInputLog() {
     ImGui::EndChild();
 
     ImGui::BeginChild("table");
-    ImGui::Columns(5);
-    for (auto& pair : inputLog) {
-        const auto message = pair.first;
-        const auto delay = pair.second;
-
-        ImGui::Text(std::to_string(delay).c_str());             ImGui::NextColumn();
-        ImGui::Text(message.typeString().c_str());              ImGui::NextColumn();
-        ImGui::Text(std::to_string(message.channel()).c_str()); ImGui::NextColumn();
-        ImGui::Text(std::to_string(message.byte1()).c_str());   ImGui::NextColumn();
-        ImGui::Text(std::to_string(message.byte2()).c_str());   ImGui::NextColumn();
+    applyJump(jump);
+    const int count = (int)(inputFilterActive ? inputFilter.size() : inputLog.size());
+    const auto oldest = inputLog.store().sequence(0);
+    ImGuiListClipper clipper(count, ImGui::GetTextLineHeightWithSpacing());
+    ImGui::Columns(7);
+    for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+        const auto index = inputFilterActive ? (int)(inputFilter[count - 1 - row] - oldest) : count - 1 - row;
+        const auto& text = inputLog.text(index);
+        ImGui::TextUnformatted(midiManager.inputPortName(inputLog[index].port).c_str()); ImGui::NextColumn();
+        ImGui::TextUnformatted(text.time);    ImGui::NextColumn();
+        ImGui::TextUnformatted(text.delay);   ImGui::NextColumn();
+        if (inputLog[index].isSysEx()) {
+            // Only rows on screen pay for the hex preview.
+            char preview[40];
+            midi::formatHexPreview(inputLog.sysEx(index), preview, sizeof(preview));
+            ImGui::PushID(index);
+            if (ImGui::Selectable(text.type)) {
+                selectedSysEx = inputLog.store().sequence(index);
+                showSysExWindow = true;
+            }
+            ImGui::PopID();
+            ImGui::NextColumn();
+            ImGui::TextUnformatted(text.channel); ImGui::NextColumn();
+            ImGui::TextUnformatted(text.data1);   ImGui::NextColumn();
+            ImGui::TextUnformatted(preview);      ImGui::NextColumn();
+            continue;
+        }
+        ImGui::TextUnformatted(text.type);    ImGui::NextColumn();
+        ImGui::TextUnformatted(text.channel); ImGui::NextColumn();
+        ImGui::TextUnformatted(text.data1);   ImGui::NextColumn();
+        ImGui::TextUnformatted(text.data2);   ImGui::NextColumn();
     }
+    ImGui::Columns(1);
+    clipper.End();
     ImGui::EndChild();
 
     ImGui::EndChild();
-    inputMutex.unlock();
+}
+
+// Offset, sixteen hex bytes and their printable characters.
+void formatDumpRow(const midi::SysExMessage& message, size_t offset, char* text, size_t size) {
+    static const char digits[] = "0123456789ABCDEF";
+    auto length = (size_t)std::snprintf(text, size, "%08zX  ", offset);
+    const auto end = std::min(offset + 16, message.size());
+    for (size_t index = offset; index < offset + 16; ++index) {
+        text[length++] = index < end ? digits[message[index] >> 4] : ' ';
+        text[length++] = index < end ? digits[message[index] & 0x0F] : ' ';
+        text[length++] = ' ';
+    }
+    text[length++] = ' ';
+    for (size_t index = offset; index < end; ++index) {
+        text[length++] = (message[index] >= 0x20 && message[index] < 0x7F) ? (char)message[index] : '.';
+    }
+    text[length] = '\0';
+}
+
+// The selection is held by sequence number, so the window notices when the
+// message is evicted instead of showing whatever took its place.
+void showSysEx() {
+    if (!showSysExWindow)
+        return;
+
+    ImGui::Begin("SysEx", &showSysExWindow, {560, 360});
+    const auto& store = inputLog.store();
+    if (selectedSysEx < store.sequence(0) || selectedSysEx >= store.sequence(store.size())) {
+        ImGui::Text("Evicted from the log");
+        ImGui::End();
+        return;
+    }
+
+    const auto message = inputLog.sysEx(selectedSysEx - store.sequence(0));
+    ImGui::Text("%zu bytes", message.size());
+    ImGui::Separator();
+
+    ImGui::BeginChild("dump");
+    const int rows = (int)((message.size() + 15) / 16);
+    ImGuiListClipper clipper(rows, ImGui::GetTextLineHeightWithSpacing());
+    for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+        char text[96];
+        formatDumpRow(message, (size_t)row * 16, text, sizeof(text));
+        ImGui::TextUnformatted(text);
+    }
+    clipper.End();
+    ImGui::EndChild();
+    ImGui::End();
 }
 
 void showOutputLog() {
+    static LogJump jump = LogJump::None;
+
     ImGui::BeginChild("output log", {0, 126});
     ImGui::Text("Output Log");
+    showJumpButtons(jump);
 
     ImGui::BeginChild("header", {0, 26});
     ImGui::Columns(4);
@@ -230,22 +628,107 @@ void showOutputLog() {
     ImGui::EndChild();
 
     ImGui::BeginChild("table");
+    applyJump(jump);
+    const int count = (int)outputLog.size();
+    ImGuiListClipper clipper(count, ImGui::GetTextLineHeightWithSpacing());
     ImGui::Columns(4);
-    for (auto& message : outputLog) {
-        ImGui::Text(message.typeString().c_str());              ImGui::NextColumn();
-        ImGui::Text(std::to_string(message.channel()).c_str()); ImGui::NextColumn();
-        ImGui::Text(std::to_string(message.byte1()).c_str());   ImGui::NextColumn();
-        ImGui::Text(std::to_string(message.byte2()).c_str());   ImGui::NextColumn();
+    for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+        const auto& text = outputLog.text(count - 1 - row);
+        ImGui::TextUnformatted(text.type);    ImGui::NextColumn();
+        ImGui::TextUnformatted(text.channel); ImGui::NextColumn();
+        ImGui::TextUnformatted(text.data1);   ImGui::NextColumn();
+        ImGui::TextUnformatted(text.data2);   ImGui::NextColumn();
     }
+    ImGui::Columns(1);
+    clipper.End();
     ImGui::EndChild();
 
     ImGui::EndChild();
 }
 
+// Channels run down, controller numbers across; shade grows with the log
+// of the count so that sparse controllers stay visible next to busy ones.
+void showControllerHeatmap(const midi::PortTraffic& traffic) {
+    const float cell = 4;
+    uint64_t busiest = 1;
+    for (auto& channel : traffic.controllers) {
+        for (auto count : channel) {
+            busiest = std::max(busiest, count);
+        }
+    }
+
+    const auto origin = ImGui::GetCursorScreenPos();
+    auto drawList = ImGui::GetWindowDrawList();
+    for (int channel = 0; channel < 16; ++channel) {
+        for (int controller = 0; controller < 128; ++controller) {
+            const auto count = traffic.controllers[channel][controller];
+            if (count == 0)
+                continue;
+            const float shade = 1.0f - (float)(std::log(1.0 + count) / std::log(1.0 + busiest));
+            const ImVec2 min = {origin.x + controller * cell, origin.y + channel * cell};
+            const ImVec2 max = {min.x + cell, min.y + cell};
+            drawList->AddRectFilled(min, max, ImGui::ColorConvertFloat4ToU32({shade, shade, shade, 1}));
+        }
+    }
+    ImGui::Dummy({128 * cell, 16 * cell});
+}
+
+void showTraffic() {
+    if (!showTrafficWindow)
+        return;
+
+    ImGui::Begin("Traffic", &showTrafficWindow, {560, 480});
+    static const char* windowNames[] = {"1 s", "10 s", "60 s"};
+    static const char* typeNames[] = {"Note Off", "Note On", "Poly AT", "CC", "Program", "Channel AT", "Pitch", "System"};
+    static midi::PortTraffic traffic;
+    const auto now = midi::monotonicNanoseconds();
+
+    for (auto port : inputRingPorts) {
+        trafficStats.snapshot(port, now, traffic);
+        if (!traffic.active)
+            continue;
+
+        const auto& portName = midiManager.inputPortName(port);
+        if (!ImGui::CollapsingHeader(portName.c_str(), nullptr, true, true))
+            continue;
+
+        ImGui::Text("%llu messages, %llu bytes",
+                    (unsigned long long)traffic.messageCount, (unsigned long long)traffic.byteCount);
+        for (size_t window = 0; window < traffic.windows.size(); ++window) {
+            const auto& rates = traffic.windows[window];
+            ImGui::Text("%-5s %8.0f msg/s %9.0f B/s  peak %8.0f msg/s",
+                        windowNames[window], rates.messagesPerSecond, rates.bytesPerSecond, rates.peakMessagesPerSecond);
+        }
+
+        float channelRates[16];
+        for (size_t channel = 0; channel < 16; ++channel) {
+            channelRates[channel] = (float)traffic.channelRates[channel];
+        }
+        ImGui::PlotHistogram("msg/s by channel", channelRates, 16, 0, nullptr, 0.0f, FLT_MAX, {0, 40});
+
+        for (size_t type = 0; type < 8; ++type) {
+            ImGui::Text("%-10s %8.0f msg/s", typeNames[type], traffic.typeRates[type]);
+            if (type % 2 == 0)
+                ImGui::SameLine(260);
+        }
+
+        float velocities[128];
+        for (size_t velocity = 0; velocity < 128; ++velocity) {
+            velocities[velocity] = (float)traffic.velocities[velocity];
+        }
+        ImGui::PlotHistogram("Note On velocity", velocities, 128, 0, nullptr, 0.0f, FLT_MAX, {0, 60});
+
+        ImGui::Text("Controllers");
+        showControllerHeatmap(traffic);
+    }
+    ImGui::End();
+}
+
 auto start = std::chrono::high_resolution_clock::now();
 
+// Caps the frame rate; MIDI arriving meanwhile is coalesced into the next frame.
 void sleep() {
-    auto frameDuration = std::chrono::milliseconds(1000 / 60);
+    auto frameDuration = std::chrono::microseconds(1000000 / maxFrameRate);
     auto now = std::chrono::high_resolution_clock::now();
     auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(now - start);
     if (elapsed < frameDuration) {
@@ -255,20 +738,47 @@ void sleep() {
     start = std::chrono::high_resolution_clock::now();
 }
 
-int main() {
+// Smoothed CPU time of submitting a frame to GL, for comparing the renderers.
+void render() {
+    const auto renderStart = std::chrono::high_resolution_clock::now();
+    ImGui::Render();
+    const auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - renderStart);
+    renderMilliseconds += (elapsed.count() - renderMilliseconds) / 16.0;
+}
+
+int main(int argc, char** argv) {
+    for (int index = 1; index < argc; ++index) {
+        if (std::strcmp(argv[index], "--legacy-gl") == 0)
+            coreProfile = false;
+    }
+
     if (!glfwInit())
         exit(1);
 
-    GLFWwindow* window = glfwCreateWindow(1000, 600, "Beagle", nullptr, nullptr);
-	if (!window)
-		exit(1);
+    GLFWwindow* window = nullptr;
+    if (coreProfile) {
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 2);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+        window = glfwCreateWindow(1000, 600, "Beagle", nullptr, nullptr);
+        // Fall back to the fixed function renderer without a core context.
+        if (!window) {
+            coreProfile = false;
+            glfwDefaultWindowHints();
+        }
+    }
+    if (!window)
+        window = glfwCreateWindow(1000, 600, "Beagle", nullptr, nullptr);
+    if (!window)
+        exit(1);
 
     glfwMakeContextCurrent(window);
-    ImGui_ImplGlfw_Init(window, true);
+    if (!ImGui_ImplGlfw_Init(window, true, coreProfile))
+        exit(1);
 
     ImGuiIO& io = ImGui::GetIO();
     io.IniFilename = nullptr;
-    io.Fonts->AddFontFromMemoryCompressedTTF(droid_compressed_data, droid_compressed_size, 16);
 
     ImVec4 normal  = {0.90f, 0.90f, 0.90f, 1.0f};
     ImVec4 hovered = {0.80f, 0.80f, 0.80f, 1.0f};
@@ -297,10 +807,32 @@ int main() {
     style.Colors[ImGuiCol_HeaderHovered]        = hovered;
     style.Colors[ImGuiCol_HeaderActive]         = active;
 
+    midiManager.setTrafficStats(&trafficStats);
+    midiManager.setSysExPool(&sysExPool);
+    // Watch before enumerating so a port that appears in between is
+    // reported rather than missed; a duplicate Added is harmless.
+    portWatcher.start(requestRedraw);
     refreshPorts();
 
+    // Keep drawing for a few frames after each wake so ImGui can settle
+    // hover and click state, then block until input or MIDI arrives.
+    const int settleFrameCount = 3;
+    int settleFrames = settleFrameCount;
+
     while (!glfwWindowShouldClose(window)) {
-        glfwPollEvents();
+        if (settleFrames > 0) {
+            glfwPollEvents();
+            --settleFrames;
+        } else {
+            glfwWaitEvents();
+            settleFrames = settleFrameCount - 1;
+        }
+        drainInput();
+        const auto now = midi::monotonicNanoseconds();
+        inputLog.expire(now);
+        outputLog.expire(now);
+        applyPortChanges();
+        applyConnections();
         ImGui_ImplGlfw_NewFrame();
 
         ImGui::SetNextWindowPos(ImVec2(0, 0), ImGuiSetCond_FirstUseEver);
@@ -325,17 +857,26 @@ int main() {
         ImGui::Dummy({0, 10});
         showInputLog();
         ImGui::End();
+        showTraffic();
+        showSysEx();
 
         int display_w, display_h;
         glfwGetFramebufferSize(window, &display_w, &display_h);
         glViewport(0, 0, display_w, display_h);
         glClearColor(1, 1, 1, 1);
         glClear(GL_COLOR_BUFFER_BIT);
-        ImGui::Render();
+        render();
         glfwSwapBuffers(window);
+
+        // The traffic window shows rates that change without new input, and
+        // pending connections are polled until they complete.
+        if (ImGui::IsAnyItemActive() || showTrafficWindow || connectionsPending())
+            settleFrames = settleFrameCount;
         sleep();
     }
 
+    portWatcher.stop();
+    midiManager.closePort();
     ImGui_ImplGlfw_Shutdown();
     glfwTerminate();
     
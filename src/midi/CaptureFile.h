@@ -0,0 +1,92 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#pragma once
+
+#include "Event.h"
+
+#include <cstdint>
+#include <string>
+
+namespace midi {
+
+// Beagle capture file, version 1. All integers are little-endian. Times are
+// nanoseconds on the monotonic clock; input events carry the driver's arrival
+// timestamp where the MIDI API provides one.
+//
+//   CaptureHeader                      32 bytes
+//   Event[recordCount]                 16 bytes each, in time order unless flagged
+//   SysEx payloads                     raw bytes including the F0/F7 framing
+//   CaptureSysExEntry[sysExCount]      payload of each SysEx record (status 0xF0)
+//   uint64_t time[indexCount]          time of record i * indexStride
+//   CapturePortEntry[portCount]        each followed by nameSize bytes of name
+//   CaptureFooter                      72 bytes, at the very end of the file
+//
+// Records are streamed as they arrive; everything after them is written when
+// the capture is closed. A file without a valid footer (e.g. after a crash)
+// is still readable: its record count is derived from the file size.
+//
+// Writers should merge ports by time before appending (see EventMerger), but
+// an event can still arrive after newer ones were written. The writer checks
+// and sets kCaptureUnordered in the footer flags if any record is older than
+// one before it. The time index and binary search by time are only valid
+// without that flag. A file without a footer may be unordered.
+
+const char kCaptureMagic[8] = {'B', 'E', 'A', 'G', 'L', 'C', 'A', 'P'};
+const char kCaptureFooterMagic[8] = {'B', 'E', 'A', 'G', 'L', 'E', 'N', 'D'};
+const uint32_t kCaptureVersion = 1;
+const uint32_t kDefaultIndexStride = 1024;
+
+// CaptureFooter::flags
+const uint32_t kCaptureUnordered = 1;
+
+struct CaptureHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t recordSize;
+    uint32_t indexStride;
+    uint32_t reserved;
+    uint64_t startTime;
+};
+
+struct CaptureSysExEntry {
+    uint64_t record;
+    uint64_t offset;
+    uint64_t size;
+};
+
+struct CapturePortEntry {
+    uint32_t port;
+    uint32_t nameSize;
+    uint64_t eventCount;
+    uint64_t firstTime;
+    uint64_t lastTime;
+};
+
+struct CaptureFooter {
+    uint64_t recordCount;
+    uint64_t sysExOffset;
+    uint64_t sysExTableOffset;
+    uint64_t sysExCount;
+    uint64_t indexOffset;
+    uint64_t indexCount;
+    uint64_t portTableOffset;
+    uint32_t portCount;
+    uint32_t flags;
+    char magic[8];
+};
+
+static_assert(sizeof(CaptureHeader) == 32, "CaptureHeader layout changed");
+static_assert(sizeof(Event) == 16, "Event layout changed");
+static_assert(sizeof(CaptureSysExEntry) == 24, "CaptureSysExEntry layout changed");
+static_assert(sizeof(CapturePortEntry) == 32, "CapturePortEntry layout changed");
+static_assert(sizeof(CaptureFooter) == 72, "CaptureFooter layout changed");
+
+struct CapturePort {
+    uint32_t port;
+    std::string name;
+    uint64_t eventCount;
+    uint64_t firstTime;
+    uint64_t lastTime;
+};
+
+}
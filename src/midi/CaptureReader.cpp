@@ -0,0 +1,192 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#include "CaptureReader.h"
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace midi {
+
+CaptureReader::~CaptureReader() {
+    close();
+}
+
+bool CaptureReader::open(const std::string& path) {
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < (LONGLONG)sizeof(CaptureHeader)) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        CloseHandle(file);
+        return false;
+    }
+    mFileHandle = file;
+    mMappingHandle = mapping;
+    mSize = (size_t)fileSize.QuadPart;
+    mData = static_cast<const unsigned char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+#else
+    const int file = ::open(path.c_str(), O_RDONLY);
+    if (file < 0)
+        return false;
+    struct stat info;
+    if (fstat(file, &info) != 0 || info.st_size < (off_t)sizeof(CaptureHeader)) {
+        ::close(file);
+        return false;
+    }
+    mSize = (size_t)info.st_size;
+    void* data = mmap(nullptr, mSize, PROT_READ, MAP_SHARED, file, 0);
+    ::close(file);
+    mData = data != MAP_FAILED ? static_cast<const unsigned char*>(data) : nullptr;
+#endif
+
+    if (!mData) {
+        close();
+        return false;
+    }
+
+    const auto& captureHeader = header();
+    if (std::memcmp(captureHeader.magic, kCaptureMagic, sizeof(captureHeader.magic)) != 0 ||
+        captureHeader.version != kCaptureVersion ||
+        captureHeader.recordSize != sizeof(Event)) {
+        close();
+        return false;
+    }
+
+    mRecords = reinterpret_cast<const Event*>(mData + sizeof(CaptureHeader));
+    mRecordCount = (mSize - sizeof(CaptureHeader)) / sizeof(Event);
+
+    if (mSize < sizeof(CaptureHeader) + sizeof(CaptureFooter))
+        return true;
+
+    CaptureFooter footer;
+    std::memcpy(&footer, mData + mSize - sizeof(footer), sizeof(footer));
+    if (std::memcmp(footer.magic, kCaptureFooterMagic, sizeof(footer.magic)) != 0 || !validFooter(footer))
+        return true;
+
+    mComplete = true;
+    mOrdered = (footer.flags & kCaptureUnordered) == 0;
+    mRecordCount = footer.recordCount;
+    mSysExData = mData + footer.sysExOffset;
+    mSysExSize = footer.sysExTableOffset - footer.sysExOffset;
+    mSysExTable = reinterpret_cast<const CaptureSysExEntry*>(mData + footer.sysExTableOffset);
+    mSysExCount = footer.sysExCount;
+    mIndex = reinterpret_cast<const uint64_t*>(mData + footer.indexOffset);
+    mIndexCount = footer.indexCount;
+
+    auto position = footer.portTableOffset;
+    for (uint32_t i = 0; i < footer.portCount && position + sizeof(CapturePortEntry) <= mSize; ++i) {
+        CapturePortEntry entry;
+        std::memcpy(&entry, mData + position, sizeof(entry));
+        position += sizeof(entry);
+        const auto nameSize = std::min<uint64_t>(entry.nameSize, mSize - position);
+        const std::string name(reinterpret_cast<const char*>(mData + position), (size_t)nameSize);
+        position += nameSize;
+        mPorts.push_back({entry.port, name, entry.eventCount, entry.firstTime, entry.lastTime});
+    }
+
+    return true;
+}
+
+// Every region the footer names must lie, in order, between the header and
+// the footer. A corrupt footer leaves the file readable as an incomplete one.
+bool CaptureReader::validFooter(const CaptureFooter& footer) const {
+    const uint64_t end = mSize - sizeof(CaptureFooter);
+    // True when count elements of size bytes fit in [offset, end), without overflow.
+    auto fits = [end](uint64_t offset, uint64_t count, uint64_t size) {
+        return offset <= end && count <= (end - offset) / size;
+    };
+
+    return fits(sizeof(CaptureHeader), footer.recordCount, sizeof(Event)) &&
+        footer.sysExOffset == sizeof(CaptureHeader) + footer.recordCount * sizeof(Event) &&
+        footer.sysExTableOffset >= footer.sysExOffset &&
+        fits(footer.sysExTableOffset, footer.sysExCount, sizeof(CaptureSysExEntry)) &&
+        footer.indexOffset >= footer.sysExTableOffset + footer.sysExCount * sizeof(CaptureSysExEntry) &&
+        fits(footer.indexOffset, footer.indexCount, sizeof(uint64_t)) &&
+        (footer.indexCount == 0 || header().indexStride > 0) &&
+        footer.portTableOffset >= footer.indexOffset + footer.indexCount * sizeof(uint64_t) &&
+        footer.portTableOffset <= end;
+}
+
+void CaptureReader::close() {
+#ifdef _WIN32
+    if (mData)
+        UnmapViewOfFile(mData);
+    if (mMappingHandle)
+        CloseHandle(mMappingHandle);
+    if (mFileHandle)
+        CloseHandle(mFileHandle);
+    mMappingHandle = nullptr;
+    mFileHandle = nullptr;
+#else
+    if (mData)
+        munmap(const_cast<unsigned char*>(mData), mSize);
+#endif
+    mData = nullptr;
+    mSize = 0;
+    mComplete = false;
+    mOrdered = false;
+    mRecords = nullptr;
+    mRecordCount = 0;
+    mSysExData = nullptr;
+    mSysExSize = 0;
+    mSysExTable = nullptr;
+    mSysExCount = 0;
+    mIndex = nullptr;
+    mIndexCount = 0;
+    mPorts.clear();
+}
+
+uint64_t CaptureReader::lowerBound(uint64_t time) const {
+    if (!mOrdered) {
+        const auto record = std::find_if(mRecords, mRecords + mRecordCount, [time](const Event& event) {
+            return event.time >= time;
+        });
+        return record - mRecords;
+    }
+
+    uint64_t first = 0;
+    uint64_t last = mRecordCount;
+
+    if (mIndexCount > 0) {
+        const auto stride = header().indexStride;
+        const auto entry = std::lower_bound(mIndex, mIndex + mIndexCount, time) - mIndex;
+        first = entry > 0 ? (entry - 1) * stride : 0;
+        last = std::min<uint64_t>(mRecordCount, entry * (uint64_t)stride + 1);
+    }
+
+    const auto record = std::lower_bound(mRecords + first, mRecords + last, time, [](const Event& event, uint64_t time) {
+        return event.time < time;
+    });
+    return record - mRecords;
+}
+
+SysExMessage CaptureReader::sysEx(uint64_t record) const {
+    const auto entry = std::lower_bound(mSysExTable, mSysExTable + mSysExCount, record, [](const CaptureSysExEntry& entry, uint64_t record) {
+        return entry.record < record;
+    });
+    if (entry == mSysExTable + mSysExCount || entry->record != record)
+        return SysExMessage();
+    // Payloads must lie within the SysEx region; corrupt entries read as empty.
+    if (entry->offset > mSysExSize || entry->size > mSysExSize - entry->offset)
+        return SysExMessage();
+    return SysExMessage(mSysExData + entry->offset, entry->size);
+}
+
+}
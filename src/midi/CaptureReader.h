@@ -0,0 +1,93 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#pragma once
+
+#include "CaptureFile.h"
+#include "Event.h"
+#include "MidiTypes.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace midi {
+
+// Memory-mapped capture reader. open() only touches the header and footer,
+// so it takes the same time for any file size; records are paged in on use.
+class CaptureReader {
+public:
+    CaptureReader() = default;
+    ~CaptureReader();
+
+    CaptureReader(const CaptureReader&) = delete;
+    CaptureReader& operator=(const CaptureReader&) = delete;
+
+    bool open(const std::string& path);
+    void close();
+
+    bool isOpen() const {
+        return mData != nullptr;
+    }
+
+    // True if the footer was found, i.e. the capture was closed cleanly.
+    bool isComplete() const {
+        return mComplete;
+    }
+
+    uint64_t size() const {
+        return mRecordCount;
+    }
+
+    const Event& operator[](uint64_t record) const {
+        return mRecords[record];
+    }
+
+    const CaptureHeader& header() const {
+        return *reinterpret_cast<const CaptureHeader*>(mData);
+    }
+
+    const std::vector<CapturePort>& ports() const {
+        return mPorts;
+    }
+
+    // True if the records are known to be in time order (see CaptureFile.h).
+    bool isOrdered() const {
+        return mOrdered;
+    }
+
+    // First record whose timestamp is not less than time. A binary search
+    // when the records are ordered, a scan otherwise.
+    uint64_t lowerBound(uint64_t time) const;
+
+    bool isSysEx(uint64_t record) const {
+        return mRecords[record].status == 0xF0;
+    }
+
+    SysExMessage sysEx(uint64_t record) const;
+
+private:
+    bool validFooter(const CaptureFooter& footer) const;
+
+private:
+    const unsigned char* mData = nullptr;
+    size_t mSize = 0;
+#ifdef _WIN32
+    void* mFileHandle = nullptr;
+    void* mMappingHandle = nullptr;
+#endif
+
+    bool mComplete = false;
+    bool mOrdered = false;
+    const Event* mRecords = nullptr;
+    uint64_t mRecordCount = 0;
+    const unsigned char* mSysExData = nullptr;
+    uint64_t mSysExSize = 0;
+    const CaptureSysExEntry* mSysExTable = nullptr;
+    uint64_t mSysExCount = 0;
+    const uint64_t* mIndex = nullptr;
+    uint64_t mIndexCount = 0;
+    std::vector<CapturePort> mPorts;
+};
+
+}
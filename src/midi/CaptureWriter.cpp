@@ -0,0 +1,189 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#include "CaptureWriter.h"
+
+#include <chrono>
+#include <cstring>
+
+namespace midi {
+
+CaptureWriter::CaptureWriter() :
+mItems(new SpscRing<Item, 16384>()),
+mPayloads(new PayloadRing()) {
+}
+
+CaptureWriter::~CaptureWriter() {
+    close();
+}
+
+bool CaptureWriter::open(const std::string& path, uint32_t indexStride) {
+    close();
+
+    mFile = std::fopen(path.c_str(), "wb");
+    if (!mFile)
+        return false;
+
+    mSysExFile = std::tmpfile();
+    if (!mSysExFile) {
+        std::fclose(mFile);
+        mFile = nullptr;
+        return false;
+    }
+
+    std::setvbuf(mFile, nullptr, _IOFBF, 1 << 20);
+
+    CaptureHeader header;
+    std::memcpy(header.magic, kCaptureMagic, sizeof(header.magic));
+    header.version = kCaptureVersion;
+    header.recordSize = sizeof(Event);
+    header.indexStride = indexStride > 0 ? indexStride : kDefaultIndexStride;
+    header.reserved = 0;
+    header.startTime = monotonicNanoseconds();
+    std::fwrite(&header, sizeof(header), 1, mFile);
+
+    mIndexStride = header.indexStride;
+    mRecordCount = 0;
+    mLastTime = 0;
+    mOrdered = true;
+    mSysExSize = 0;
+    mSysExTable.clear();
+    mIndex.clear();
+    for (auto& port : mPorts) {
+        port.eventCount = 0;
+        port.firstTime = 0;
+        port.lastTime = 0;
+    }
+
+    mRunning = true;
+    mThread = std::thread(&CaptureWriter::run, this);
+    return true;
+}
+
+bool CaptureWriter::close() {
+    if (!mFile)
+        return false;
+
+    mRunning = false;
+    if (mThread.joinable())
+        mThread.join();
+    drain();
+
+    CaptureFooter footer;
+    std::memset(&footer, 0, sizeof(footer));
+    footer.recordCount = mRecordCount;
+    footer.sysExOffset = sizeof(CaptureHeader) + mRecordCount * sizeof(Event);
+
+    std::rewind(mSysExFile);
+    char buffer[1 << 16];
+    size_t size;
+    while ((size = std::fread(buffer, 1, sizeof(buffer), mSysExFile)) > 0) {
+        std::fwrite(buffer, 1, size, mFile);
+    }
+    std::fclose(mSysExFile);
+    mSysExFile = nullptr;
+
+    footer.sysExTableOffset = footer.sysExOffset + mSysExSize;
+    footer.sysExCount = mSysExTable.size();
+    if (!mSysExTable.empty())
+        std::fwrite(mSysExTable.data(), sizeof(CaptureSysExEntry), mSysExTable.size(), mFile);
+
+    footer.indexOffset = footer.sysExTableOffset + mSysExTable.size() * sizeof(CaptureSysExEntry);
+    footer.indexCount = mIndex.size();
+    if (!mIndex.empty())
+        std::fwrite(mIndex.data(), sizeof(uint64_t), mIndex.size(), mFile);
+
+    footer.portTableOffset = footer.indexOffset + mIndex.size() * sizeof(uint64_t);
+    for (auto& port : mPorts) {
+        CapturePortEntry entry;
+        entry.port = port.port;
+        entry.nameSize = (uint32_t)port.name.size();
+        entry.eventCount = port.eventCount;
+        entry.firstTime = port.firstTime;
+        entry.lastTime = port.lastTime;
+        std::fwrite(&entry, sizeof(entry), 1, mFile);
+        std::fwrite(port.name.data(), 1, port.name.size(), mFile);
+    }
+    footer.portCount = (uint32_t)mPorts.size();
+    footer.flags = mOrdered ? 0 : kCaptureUnordered;
+    std::memcpy(footer.magic, kCaptureFooterMagic, sizeof(footer.magic));
+    std::fwrite(&footer, sizeof(footer), 1, mFile);
+
+    const bool ok = std::ferror(mFile) == 0;
+    std::fclose(mFile);
+    mFile = nullptr;
+    return ok;
+}
+
+void CaptureWriter::setPortName(uint32_t port, const std::string& name) {
+    for (auto& entry : mPorts) {
+        if (entry.port == port) {
+            entry.name = name;
+            return;
+        }
+    }
+    mPorts.push_back({port, name, 0, 0, 0});
+}
+
+bool CaptureWriter::append(const Event& event) {
+    if (!mItems->push({event, 0})) {
+        mDroppedCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+bool CaptureWriter::append(const SysExMessage& message, uint64_t time, byte port, Direction direction) {
+    if (mItems->available() == 0 || !mPayloads->push(message.data(), message.size())) {
+        mDroppedCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    const Event event = {time, 0xF0, 0, 0, port, direction, {0, 0, 0}};
+    return mItems->push({event, (uint32_t)message.size()});
+}
+
+void CaptureWriter::run() {
+    while (mRunning) {
+        if (drain() == 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+}
+
+size_t CaptureWriter::drain() {
+    return mItems->drain([this](const Item& item) {
+        write(item);
+    });
+}
+
+void CaptureWriter::write(const Item& item) {
+    const auto& event = item.event;
+    if (mRecordCount % mIndexStride == 0)
+        mIndex.push_back(event.time);
+    if (event.time < mLastTime)
+        mOrdered = false;
+    else
+        mLastTime = event.time;
+
+    if (item.payloadSize > 0) {
+        mPayload.resize(item.payloadSize);
+        mPayloads->pop(mPayload.data(), mPayload.size());
+        std::fwrite(mPayload.data(), 1, mPayload.size(), mSysExFile);
+        mSysExTable.push_back({mRecordCount, mSysExSize, mPayload.size()});
+        mSysExSize += mPayload.size();
+    }
+
+    std::fwrite(&event, sizeof(event), 1, mFile);
+    ++mRecordCount;
+
+    for (auto& port : mPorts) {
+        if (port.port == event.port) {
+            if (port.eventCount++ == 0)
+                port.firstTime = event.time;
+            port.lastTime = event.time;
+            return;
+        }
+    }
+    mPorts.push_back({event.port, "", 1, event.time, event.time});
+}
+
+}
@@ -0,0 +1,83 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#pragma once
+
+#include "CaptureFile.h"
+#include "Event.h"
+#include "MidiTypes.h"
+#include "SpscRing.h"
+#include "SysExPool.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace midi {
+
+// Append-only capture writer. append() is wait-free and may be called from a
+// single ingest thread; a background thread does all file I/O.
+class CaptureWriter {
+public:
+    CaptureWriter();
+    ~CaptureWriter();
+
+    CaptureWriter(const CaptureWriter&) = delete;
+    CaptureWriter& operator=(const CaptureWriter&) = delete;
+
+    bool open(const std::string& path, uint32_t indexStride = kDefaultIndexStride);
+    bool close();
+
+    bool isOpen() const {
+        return mFile != nullptr;
+    }
+
+    // Must be called before open().
+    void setPortName(uint32_t port, const std::string& name);
+
+    bool append(const Event& event);
+    bool append(const SysExMessage& message, uint64_t time, byte port, Direction direction);
+
+    uint64_t droppedCount() const {
+        return mDroppedCount.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Item {
+        Event event;
+        uint32_t payloadSize;
+    };
+
+    // Room for a largest pooled payload while another drains. Pages are only
+    // touched as payloads pass through.
+    using PayloadRing = SpscRing<byte, 2 * SysExPool::kMaxPayloadSize>;
+
+    void run();
+    size_t drain();
+    void write(const Item& item);
+
+private:
+    std::FILE* mFile = nullptr;
+    std::FILE* mSysExFile = nullptr;
+    std::thread mThread;
+    std::atomic<bool> mRunning{false};
+    std::atomic<uint64_t> mDroppedCount{0};
+
+    std::unique_ptr<SpscRing<Item, 16384>> mItems;
+    std::unique_ptr<PayloadRing> mPayloads;
+    std::vector<byte> mPayload;
+
+    uint32_t mIndexStride = kDefaultIndexStride;
+    uint64_t mRecordCount = 0;
+    uint64_t mLastTime = 0;
+    bool mOrdered = true;
+    uint64_t mSysExSize = 0;
+    std::vector<CaptureSysExEntry> mSysExTable;
+    std::vector<uint64_t> mIndex;
+    std::vector<CapturePort> mPorts;
+};
+
+}
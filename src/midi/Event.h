@@ -0,0 +1,63 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#pragma once
+
+#include "MidiTypes.h"
+
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+
+namespace midi {
+
+enum class Direction : byte {
+    Input = 0,
+    Output = 1
+};
+
+// Packed log record. Timestamps are nanoseconds on the monotonic clock.
+struct Event {
+    uint64_t time;
+    byte status;
+    byte data1;
+    byte data2;
+    byte port;
+    Direction direction;
+    byte reserved[3];
+
+    ChannelMessage message() const {
+        return {status, data1, data2};
+    }
+
+    Message packet() const {
+        return {status, data1, data2};
+    }
+
+    static Event make(const ChannelMessage& message, uint64_t time, byte port, Direction direction) {
+        return {time, message.statusByte(), message.byte1(), message.byte2(), port, direction, {0, 0, 0}};
+    }
+
+    // SysEx events (status 0xF0) carry the id of their SysExPool buffer in
+    // place of the data bytes.
+    bool isSysEx() const {
+        return status == 0xF0;
+    }
+
+    uint32_t payload() const {
+        return (uint32_t)data1 | (uint32_t)data2 << 8 | (uint32_t)reserved[0] << 16 | (uint32_t)reserved[1] << 24;
+    }
+
+    static Event makeSysEx(uint32_t payload, uint64_t time, byte port, Direction direction) {
+        return {time, 0xF0, (byte)payload, (byte)(payload >> 8), port, direction, {(byte)(payload >> 16), (byte)(payload >> 24), 0}};
+    }
+};
+
+static_assert(sizeof(Event) <= 16, "Event must stay within 16 bytes");
+static_assert(std::is_trivially_copyable<Event>::value, "Event must be trivially copyable");
+
+inline uint64_t monotonicNanoseconds() {
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+
+}
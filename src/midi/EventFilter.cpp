@@ -0,0 +1,331 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#include "EventFilter.h"
+#include "EventIndex.h"
+
+#include <algorithm>
+#include <bitset>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BEAGLE_FILTER_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// AVX2 is compiled per function and picked at runtime, so the binary still
+// runs on CPUs without it.
+#if defined(BEAGLE_FILTER_SSE2) && (defined(__GNUC__) || defined(__clang__))
+#define BEAGLE_FILTER_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace midi {
+
+namespace {
+
+const size_t kBlockSize = 64;
+// Ranges smaller than this are not worth starting threads for.
+const size_t kParallelThreshold = 1 << 18;
+const size_t kBlocksPerThread = 1 << 12;
+
+using BlockKernel = uint64_t (*)(const EventStore::Columns& columns, size_t position, const EventQuery& query);
+
+inline bool inRange(byte value, byte min, byte max) {
+    return value >= min && value <= max;
+}
+
+inline bool matches(const EventStore::Columns& columns, size_t position, const EventQuery& query) {
+    const auto status = columns.statuses[position];
+    return (status & query.statusMask) == query.statusValue &&
+        inRange(status, query.statusMin, query.statusMax) &&
+        inRange(columns.data1[position], query.data1Min, query.data1Max) &&
+        inRange(columns.data2[position], query.data2Min, query.data2Max) &&
+        inRange(columns.ports[position], query.portMin, query.portMax);
+}
+
+#if !defined(BEAGLE_FILTER_SSE2)
+
+uint64_t matchBlockScalar(const EventStore::Columns& columns, size_t position, const EventQuery& query) {
+    uint64_t word = 0;
+    for (size_t offset = 0; offset < kBlockSize; ++offset) {
+        if (matches(columns, position + offset, query))
+            word |= (uint64_t)1 << offset;
+    }
+    return word;
+}
+
+#else
+
+// Unsigned byte compares by way of min/max: x >= lo exactly when
+// max(x, lo) == x.
+inline __m128i inRange16(__m128i values, __m128i min, __m128i max) {
+    const auto aboveMin = _mm_cmpeq_epi8(_mm_max_epu8(values, min), values);
+    const auto belowMax = _mm_cmpeq_epi8(_mm_min_epu8(values, max), values);
+    return _mm_and_si128(aboveMin, belowMax);
+}
+
+uint64_t matchBlockSse2(const EventStore::Columns& columns, size_t position, const EventQuery& query) {
+    const auto statusMask = _mm_set1_epi8((char)query.statusMask);
+    const auto statusValue = _mm_set1_epi8((char)query.statusValue);
+    const auto statusMin = _mm_set1_epi8((char)query.statusMin);
+    const auto statusMax = _mm_set1_epi8((char)query.statusMax);
+    const auto data1Min = _mm_set1_epi8((char)query.data1Min);
+    const auto data1Max = _mm_set1_epi8((char)query.data1Max);
+    const auto data2Min = _mm_set1_epi8((char)query.data2Min);
+    const auto data2Max = _mm_set1_epi8((char)query.data2Max);
+    const auto portMin = _mm_set1_epi8((char)query.portMin);
+    const auto portMax = _mm_set1_epi8((char)query.portMax);
+
+    uint64_t word = 0;
+    for (size_t offset = 0; offset < kBlockSize; offset += 16) {
+        const auto at = position + offset;
+        const auto status = _mm_loadu_si128(reinterpret_cast<const __m128i*>(columns.statuses + at));
+        const auto data1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(columns.data1 + at));
+        const auto data2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(columns.data2 + at));
+        const auto port = _mm_loadu_si128(reinterpret_cast<const __m128i*>(columns.ports + at));
+
+        auto match = _mm_cmpeq_epi8(_mm_and_si128(status, statusMask), statusValue);
+        match = _mm_and_si128(match, inRange16(status, statusMin, statusMax));
+        match = _mm_and_si128(match, inRange16(data1, data1Min, data1Max));
+        match = _mm_and_si128(match, inRange16(data2, data2Min, data2Max));
+        match = _mm_and_si128(match, inRange16(port, portMin, portMax));
+        word |= (uint64_t)(uint16_t)_mm_movemask_epi8(match) << offset;
+    }
+    return word;
+}
+
+#endif
+
+#if defined(BEAGLE_FILTER_AVX2)
+
+__attribute__((target("avx2")))
+inline __m256i inRange32(__m256i values, __m256i min, __m256i max) {
+    const auto aboveMin = _mm256_cmpeq_epi8(_mm256_max_epu8(values, min), values);
+    const auto belowMax = _mm256_cmpeq_epi8(_mm256_min_epu8(values, max), values);
+    return _mm256_and_si256(aboveMin, belowMax);
+}
+
+__attribute__((target("avx2")))
+uint64_t matchBlockAvx2(const EventStore::Columns& columns, size_t position, const EventQuery& query) {
+    const auto statusMask = _mm256_set1_epi8((char)query.statusMask);
+    const auto statusValue = _mm256_set1_epi8((char)query.statusValue);
+    const auto statusMin = _mm256_set1_epi8((char)query.statusMin);
+    const auto statusMax = _mm256_set1_epi8((char)query.statusMax);
+    const auto data1Min = _mm256_set1_epi8((char)query.data1Min);
+    const auto data1Max = _mm256_set1_epi8((char)query.data1Max);
+    const auto data2Min = _mm256_set1_epi8((char)query.data2Min);
+    const auto data2Max = _mm256_set1_epi8((char)query.data2Max);
+    const auto portMin = _mm256_set1_epi8((char)query.portMin);
+    const auto portMax = _mm256_set1_epi8((char)query.portMax);
+
+    uint64_t word = 0;
+    for (size_t offset = 0; offset < kBlockSize; offset += 32) {
+        const auto at = position + offset;
+        const auto status = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(columns.statuses + at));
+        const auto data1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(columns.data1 + at));
+        const auto data2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(columns.data2 + at));
+        const auto port = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(columns.ports + at));
+
+        auto match = _mm256_cmpeq_epi8(_mm256_and_si256(status, statusMask), statusValue);
+        match = _mm256_and_si256(match, inRange32(status, statusMin, statusMax));
+        match = _mm256_and_si256(match, inRange32(data1, data1Min, data1Max));
+        match = _mm256_and_si256(match, inRange32(data2, data2Min, data2Max));
+        match = _mm256_and_si256(match, inRange32(port, portMin, portMax));
+        word |= (uint64_t)(uint32_t)_mm256_movemask_epi8(match) << offset;
+    }
+    return word;
+}
+
+#endif
+
+struct Kernel {
+    BlockKernel block;
+    const char* name;
+};
+
+Kernel selectKernel() {
+#if defined(BEAGLE_FILTER_AVX2)
+    if (__builtin_cpu_supports("avx2"))
+        return {&matchBlockAvx2, "AVX2"};
+#endif
+#if defined(BEAGLE_FILTER_SSE2)
+    return {&matchBlockSse2, "SSE2"};
+#else
+    return {&matchBlockScalar, "scalar"};
+#endif
+}
+
+const Kernel& kernel() {
+    static const Kernel selected = selectKernel();
+    return selected;
+}
+
+// Clears the bits of events outside the query's time range.
+uint64_t matchTimes(const EventStore& store, const EventQuery& query, size_t first, uint64_t word) {
+    for (auto bits = word; bits != 0; bits &= bits - 1) {
+        const auto bit = countTrailingZeros(bits);
+        const auto time = store.time(first + bit);
+        if (time < query.timeMin || time > query.timeMax)
+            word &= ~((uint64_t)1 << bit);
+    }
+    return word;
+}
+
+// Fills bitmap[block] for blocks [firstBlock, lastBlock) of the range
+// starting at logical index first, and returns how many bits are set.
+// Times are only checked if checkTimes; otherwise the range was already
+// narrowed to them.
+size_t matchBlocks(const EventStore& store, const EventQuery& query, size_t first, size_t count,
+                   size_t firstBlock, size_t lastBlock, bool checkTimes, uint64_t* bitmap) {
+    const auto columns = store.columns();
+    const auto block = kernel().block;
+    size_t matchCount = 0;
+    for (size_t index = firstBlock; index < lastBlock; ++index) {
+        const auto offset = index * kBlockSize;
+        const auto length = std::min(kBlockSize, count - offset);
+        const auto position = store.position(first + offset);
+
+        uint64_t word = 0;
+        if (length == kBlockSize && position + kBlockSize <= store.capacity()) {
+            word = block(columns, position, query);
+        } else {
+            // The range's tail, or a block that wraps around the ring.
+            for (size_t bit = 0; bit < length; ++bit) {
+                if (matches(columns, store.position(first + offset + bit), query))
+                    word |= (uint64_t)1 << bit;
+            }
+        }
+        if (checkTimes)
+            word = matchTimes(store, query, first + offset, word);
+        bitmap[index] = word;
+        matchCount += std::bitset<64>(word).count();
+    }
+    return matchCount;
+}
+
+void extractMatches(const uint64_t* bitmap, size_t firstBlock, size_t lastBlock, uint64_t firstSequence, uint64_t* out) {
+    for (size_t index = firstBlock; index < lastBlock; ++index) {
+        auto word = bitmap[index];
+        while (word != 0) {
+            *out++ = firstSequence + index * kBlockSize + countTrailingZeros(word);
+            word &= word - 1;
+        }
+    }
+}
+
+}
+
+bool EventQuery::matchesAll() const {
+    return statusMask == 0 && statusMin == 0x00 && statusMax == 0xFF &&
+        data1Min == 0x00 && data1Max == 0xFF && data2Min == 0x00 && data2Max == 0xFF &&
+        portMin == 0x00 && portMax == 0xFF && timeMin == 0 && timeMax == UINT64_MAX;
+}
+
+void filterEvents(const EventStore& store, const EventQuery& query, size_t first, size_t last, std::vector<uint64_t>& matches) {
+    last = std::min(last, store.size());
+    // A late event breaks the binary search, so check each match's time.
+    const bool timed = query.timeMin > 0 || query.timeMax < UINT64_MAX;
+    const bool checkTimes = timed && !store.isOrdered();
+    if (timed && !checkTimes) {
+        if (query.timeMin > 0)
+            first = std::max(first, store.lowerBound(query.timeMin));
+        if (query.timeMax < UINT64_MAX)
+            last = std::min(last, store.lowerBound(query.timeMax + 1));
+    }
+    if (first >= last)
+        return;
+
+    const auto count = last - first;
+    const auto blockCount = (count + kBlockSize - 1) / kBlockSize;
+    std::vector<uint64_t> bitmap(blockCount);
+
+    size_t threadCount = 1;
+    if (count >= kParallelThreshold) {
+        const auto cores = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        threadCount = std::min(cores, (blockCount + kBlocksPerThread - 1) / kBlocksPerThread);
+    }
+    const auto blocksPerThread = (blockCount + threadCount - 1) / threadCount;
+
+    // Each thread owns a run of whole bitmap words, so they never share a
+    // write. The second pass copies each run's matches to its own offset.
+    std::vector<size_t> counts(threadCount);
+    std::vector<std::thread> threads;
+    for (size_t thread = 1; thread < threadCount; ++thread) {
+        const auto firstBlock = std::min(thread * blocksPerThread, blockCount);
+        const auto lastBlock = std::min(firstBlock + blocksPerThread, blockCount);
+        threads.emplace_back([&, thread, firstBlock, lastBlock]() {
+            counts[thread] = matchBlocks(store, query, first, count, firstBlock, lastBlock, checkTimes, bitmap.data());
+        });
+    }
+    counts[0] = matchBlocks(store, query, first, count, 0, std::min(blocksPerThread, blockCount), checkTimes, bitmap.data());
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    threads.clear();
+
+    const auto firstSequence = store.sequence(first);
+    auto offset = matches.size();
+    std::vector<size_t> offsets(threadCount);
+    for (size_t thread = 0; thread < threadCount; ++thread) {
+        offsets[thread] = offset;
+        offset += counts[thread];
+    }
+    matches.resize(offset);
+
+    for (size_t thread = 1; thread < threadCount; ++thread) {
+        const auto firstBlock = std::min(thread * blocksPerThread, blockCount);
+        const auto lastBlock = std::min(firstBlock + blocksPerThread, blockCount);
+        threads.emplace_back([&, thread, firstBlock, lastBlock]() {
+            extractMatches(bitmap.data(), firstBlock, lastBlock, firstSequence, matches.data() + offsets[thread]);
+        });
+    }
+    extractMatches(bitmap.data(), 0, std::min(blocksPerThread, blockCount), firstSequence, matches.data() + offsets[0]);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void filterCandidates(const EventStore& store, const EventQuery& query, const std::vector<uint64_t>& candidates, std::vector<uint64_t>& matches) {
+    const auto columns = store.columns();
+    const auto oldest = store.sequence(0);
+    for (auto sequence : candidates) {
+        const auto position = store.position((size_t)(sequence - oldest));
+        const auto time = columns.times[position];
+        if (time >= query.timeMin && time <= query.timeMax && midi::matches(columns, position, query))
+            matches.push_back(sequence);
+    }
+}
+
+const char* filterKernelName() {
+    return kernel().name;
+}
+
+void FilteredView::setQuery(const EventQuery& query) {
+    mQuery = query;
+    mMatches.clear();
+    mScanned = 0;
+}
+
+void FilteredView::update(const EventStore& store, EventIndex* index) {
+    const auto oldest = store.sequence(0);
+    while (!mMatches.empty() && mMatches.front() < oldest) {
+        mMatches.pop_front();
+    }
+
+    const auto end = store.sequence(store.size());
+    if (mScanned >= end)
+        return;
+
+    mScratch.clear();
+    if (mScanned == 0 && index && index->candidates(mQuery, store, mCandidates)) {
+        filterCandidates(store, mQuery, mCandidates, mScratch);
+        mCandidates.clear();
+    } else {
+        const auto first = mScanned > oldest ? (size_t)(mScanned - oldest) : 0;
+        filterEvents(store, mQuery, first, store.size(), mScratch);
+    }
+    mMatches.insert(mMatches.end(), mScratch.begin(), mScratch.end());
+    mScanned = end;
+}
+
+}
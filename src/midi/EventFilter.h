@@ -0,0 +1,95 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#pragma once
+
+#include "EventStore.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace midi {
+
+class EventIndex;
+
+// Index of the lowest set bit of a nonzero word.
+inline size_t countTrailingZeros(uint64_t word) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return index;
+#else
+    return __builtin_ctzll(word);
+#endif
+}
+
+// An event matches when every field does. Byte fields are inclusive ranges,
+// and the status must also satisfy (status & statusMask) == statusValue.
+// The defaults match everything.
+struct EventQuery {
+    byte statusMask = 0;
+    byte statusValue = 0;
+    byte statusMin = 0x00;
+    byte statusMax = 0xFF;
+    byte data1Min = 0x00;
+    byte data1Max = 0xFF;
+    byte data2Min = 0x00;
+    byte data2Max = 0xFF;
+    byte portMin = 0x00;
+    byte portMax = 0xFF;
+    uint64_t timeMin = 0;
+    uint64_t timeMax = UINT64_MAX;
+
+    bool matchesAll() const;
+};
+
+// Appends the sequence numbers of the events in [first, last) that match
+// query. The time range is found by binary search while the store is in
+// time order, and checked per match otherwise; the byte predicates are
+// evaluated 64 events at a time into match bitmaps by AVX2 or SSE2 kernels
+// where the CPU has them, and large ranges are split across threads.
+void filterEvents(const EventStore& store, const EventQuery& query, size_t first, size_t last, std::vector<uint64_t>& matches);
+
+// Appends the candidates, sequence numbers of retained events in order,
+// that match query.
+void filterCandidates(const EventStore& store, const EventQuery& query, const std::vector<uint64_t>& candidates, std::vector<uint64_t>& matches);
+
+// "AVX2", "SSE2" or "scalar".
+const char* filterKernelName();
+
+// Sequence numbers of the events in a store that match a query, kept up to
+// date incrementally: each update scans only the events pushed since the
+// last one and drops those that have been evicted. A new query is answered
+// from index when it narrows the search, and by a full scan otherwise.
+class FilteredView {
+public:
+    void setQuery(const EventQuery& query);
+    const EventQuery& query() const {
+        return mQuery;
+    }
+
+    void update(const EventStore& store, EventIndex* index = nullptr);
+
+    size_t size() const {
+        return mMatches.size();
+    }
+
+    uint64_t operator[](size_t index) const {
+        return mMatches[index];
+    }
+
+private:
+    EventQuery mQuery;
+    std::deque<uint64_t> mMatches;
+    std::vector<uint64_t> mScratch;
+    std::vector<uint64_t> mCandidates;
+    // Sequence number of the first event not yet scanned.
+    uint64_t mScanned = 0;
+};
+
+}
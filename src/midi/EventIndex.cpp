@@ -0,0 +1,158 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#include "EventIndex.h"
+
+#include <algorithm>
+
+namespace midi {
+
+namespace {
+
+// Offset of an entry from the oldest retained event, negative once evicted.
+inline int32_t entryOffset(uint32_t entry, uint64_t oldest) {
+    return (int32_t)(entry - (uint32_t)oldest);
+}
+
+}
+
+void EventIndex::add(const Event& event, const EventStore& store) {
+    const auto entry = (uint32_t)store.sequence(store.size() - 1);
+    const auto channel = event.status & 0x0F;
+    if (event.status >= 0xF0) {
+        mSystemList.entries.push_back(entry);
+    } else if (event.status >= 0x80) {
+        const auto type = (event.status >> 4) - 8;
+        mChannelLists[type][channel].entries.push_back(entry);
+        if (event.status < 0xC0 && event.status >= 0xB0)
+            mControllerLists[channel][event.data1 & 0x7F].entries.push_back(entry);
+    }
+
+    // Trimming often enough keeps every stale entry within 2^31 of the
+    // oldest event, where entryOffset() still reads it as negative.
+    if (++mAddedSinceTrim == kTrimInterval) {
+        trim(store.sequence(0));
+        mAddedSinceTrim = 0;
+    }
+}
+
+void EventIndex::clear() {
+    auto clearList = [](PostingList& list) {
+        list.entries.clear();
+        list.head = 0;
+    };
+    for (auto& lists : mChannelLists) {
+        for (auto& list : lists) {
+            clearList(list);
+        }
+    }
+    for (auto& lists : mControllerLists) {
+        for (auto& list : lists) {
+            clearList(list);
+        }
+    }
+    clearList(mSystemList);
+    mAddedSinceTrim = 0;
+}
+
+void EventIndex::trim(uint64_t oldest) {
+    auto trimList = [oldest](PostingList& list) {
+        auto& entries = list.entries;
+        while (list.head < entries.size() && entryOffset(entries[list.head], oldest) < 0)
+            ++list.head;
+        if (list.head == entries.size()) {
+            entries.clear();
+            list.head = 0;
+        } else if (list.head * 2 >= entries.size()) {
+            entries.erase(entries.begin(), entries.begin() + list.head);
+            list.head = 0;
+        }
+    };
+    for (auto& lists : mChannelLists) {
+        for (auto& list : lists) {
+            trimList(list);
+        }
+    }
+    for (auto& lists : mControllerLists) {
+        for (auto& list : lists) {
+            trimList(list);
+        }
+    }
+    trimList(mSystemList);
+}
+
+bool EventIndex::candidates(const EventQuery& query, const EventStore& store, std::vector<uint64_t>& out) {
+    if (store.empty())
+        return true;
+    trim(store.sequence(0));
+    mAddedSinceTrim = 0;
+
+    const bool channelOnly = query.statusMin >= 0x80 && query.statusMax <= 0xEF;
+    const byte typeNibble = query.statusValue >> 4;
+    const bool typeKnown = (query.statusMask & 0xF0) == 0xF0 && typeNibble >= 0x8 && typeNibble <= 0xE;
+    const bool channelKnown = (query.statusMask & 0x0F) == 0x0F && (typeKnown || channelOnly);
+    const size_t channel = query.statusValue & 0x0F;
+    const bool controllerKnown = typeKnown && typeNibble == 0xB && query.data1Min == query.data1Max && query.data1Min < 0x80;
+
+    std::vector<const PostingList*> lists;
+    if (controllerKnown) {
+        for (size_t index = 0; index < 16; ++index) {
+            if (!channelKnown || index == channel)
+                lists.push_back(&mControllerLists[index][query.data1Min]);
+        }
+    } else if (typeKnown) {
+        for (size_t index = 0; index < 16; ++index) {
+            if (!channelKnown || index == channel)
+                lists.push_back(&mChannelLists[typeNibble - 8][index]);
+        }
+    } else if (channelKnown) {
+        for (size_t type = 0; type < kChannelTypeCount; ++type) {
+            lists.push_back(&mChannelLists[type][channel]);
+        }
+    } else if (query.statusMin >= 0xF0) {
+        lists.push_back(&mSystemList);
+    } else {
+        return false;
+    }
+
+    // Past 1/32 of the store, gathering candidates costs more than the
+    // sequential SIMD scan of every event.
+    size_t candidateCount = 0;
+    for (auto list : lists) {
+        candidateCount += list->size();
+    }
+    if (candidateCount > store.size() / 32)
+        return false;
+
+    collect(lists, store, out);
+    return true;
+}
+
+void EventIndex::collect(const std::vector<const PostingList*>& lists, const EventStore& store, std::vector<uint64_t>& out) {
+    const auto oldest = store.sequence(0);
+    if (lists.size() == 1) {
+        const auto& list = *lists.front();
+        for (auto entry = list.entries.begin() + list.head; entry != list.entries.end(); ++entry) {
+            out.push_back(oldest + entryOffset(*entry, oldest));
+        }
+        return;
+    }
+
+    // Several lists are merged through a bitmap over the retained events,
+    // which keeps the union linear and in order.
+    mBitmap.assign((store.size() + 63) / 64, 0);
+    for (auto list : lists) {
+        for (auto entry = list->entries.begin() + list->head; entry != list->entries.end(); ++entry) {
+            const auto offset = (uint32_t)entryOffset(*entry, oldest);
+            mBitmap[offset / 64] |= (uint64_t)1 << (offset % 64);
+        }
+    }
+    for (size_t index = 0; index < mBitmap.size(); ++index) {
+        auto word = mBitmap[index];
+        while (word != 0) {
+            out.push_back(oldest + index * 64 + countTrailingZeros(word));
+            word &= word - 1;
+        }
+    }
+}
+
+}
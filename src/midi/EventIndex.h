@@ -0,0 +1,62 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#pragma once
+
+#include "EventFilter.h"
+#include "EventStore.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace midi {
+
+// Posting lists of event sequence numbers by channel message type and
+// channel, by controller number and channel for control changes, and one
+// for system messages. They are appended to at ingest, so a query that
+// names a type, channel or controller reads only the events it could match
+// instead of rescanning history.
+//
+// Entries hold the low 32 bits of the sequence number and are decoded
+// relative to the store's oldest event, so the store must retain fewer
+// than 2^31 events. Evicted entries are trimmed lazily. A list allocates
+// nothing until its first entry, so unused controllers cost no memory.
+class EventIndex {
+public:
+    // Call after pushing event, the store's newest, into store.
+    void add(const Event& event, const EventStore& store);
+    void clear();
+
+    // Appends, in order, the sequence numbers of retained events that can
+    // match query. Returns false when the query names no type, channel or
+    // controller, or matches too much of the store for the index to beat a
+    // scan, in which case the caller should scan instead.
+    bool candidates(const EventQuery& query, const EventStore& store, std::vector<uint64_t>& out);
+
+private:
+    static const size_t kChannelTypeCount = 7;
+    static const size_t kTrimInterval = 1 << 16;
+
+    // Entries before head have been trimmed; they are erased once they make
+    // up half the vector.
+    struct PostingList {
+        std::vector<uint32_t> entries;
+        size_t head = 0;
+
+        size_t size() const {
+            return entries.size() - head;
+        }
+    };
+
+    void trim(uint64_t oldest);
+    void collect(const std::vector<const PostingList*>& lists, const EventStore& store, std::vector<uint64_t>& out);
+
+private:
+    PostingList mChannelLists[kChannelTypeCount][16];
+    PostingList mControllerLists[16][128];
+    PostingList mSystemList;
+    size_t mAddedSinceTrim = 0;
+    std::vector<uint64_t> mBitmap;
+};
+
+}
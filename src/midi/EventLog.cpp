@@ -0,0 +1,76 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#include "EventLog.h"
+
+#include <algorithm>
+
+namespace midi {
+
+EventLog::EventLog(size_t capacity, SysExPool* sysExPool, bool indexed) :
+mStore(capacity),
+mIndex(indexed ? new EventIndex() : nullptr),
+mText(mStore.capacity()),
+mSysExPool(sysExPool) {
+}
+
+EventLog::~EventLog() {
+    clear();
+}
+
+void EventLog::push(const Event& event) {
+    uint64_t delay = 0;
+    if (!mStore.empty()) {
+        const auto previous = mStore.time(mStore.size() - 1);
+        delay = event.time > previous ? event.time - previous : 0;
+    }
+
+    const auto sequence = mStore.sequence(mStore.size());
+    size_t sysExSize = 0;
+    if (event.isSysEx() && mSysExPool) {
+        sysExSize = mSysExPool->message(event.payload()).size();
+        mSysEx.push_back({sequence, event.payload()});
+    }
+
+    formatEvent(event, delay, sysExSize, mText.slot(sequence));
+    mStore.push(event);
+    if (mIndex)
+        mIndex->add(event, mStore);
+    releaseEvicted();
+}
+
+void EventLog::clear() {
+    mStore.clear();
+    if (mIndex)
+        mIndex->clear();
+    releaseEvicted();
+}
+
+void EventLog::expire(uint64_t now) {
+    mStore.expire(now);
+    releaseEvicted();
+}
+
+void EventLog::setRetention(const RetentionPolicy& policy) {
+    mStore.setRetention(policy);
+    releaseEvicted();
+}
+
+SysExMessage EventLog::sysEx(size_t index) const {
+    const auto sequence = mStore.sequence(index);
+    const auto entry = std::lower_bound(mSysEx.begin(), mSysEx.end(), sequence, [](const SysExEntry& entry, uint64_t sequence) {
+        return entry.sequence < sequence;
+    });
+    if (entry == mSysEx.end() || entry->sequence != sequence)
+        return SysExMessage();
+    return mSysExPool->message(entry->payload);
+}
+
+void EventLog::releaseEvicted() {
+    const auto oldest = mStore.sequence(0);
+    while (!mSysEx.empty() && mSysEx.front().sequence < oldest) {
+        mSysExPool->release(mSysEx.front().payload);
+        mSysEx.pop_front();
+    }
+}
+
+}
@@ -0,0 +1,76 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#pragma once
+
+#include "Event.h"
+#include "EventIndex.h"
+#include "EventStore.h"
+#include "EventText.h"
+#include "SysExPool.h"
+
+#include <deque>
+#include <memory>
+
+namespace midi {
+
+// Bounded event history with display text formatted once at ingest. The
+// log takes ownership of the payloads of SysEx events pushed into it and
+// releases them to the pool as they are evicted. Only an indexed log keeps
+// the posting lists that answer filters (see EventIndex).
+class EventLog {
+public:
+    explicit EventLog(size_t capacity, SysExPool* sysExPool = nullptr, bool indexed = false);
+    ~EventLog();
+
+    void push(const Event& event);
+    void clear();
+    void expire(uint64_t now);
+
+    void setRetention(const RetentionPolicy& policy);
+
+    // Index 0 is the oldest retained event, size() - 1 the newest.
+    Event operator[](size_t index) const {
+        return mStore[index];
+    }
+
+    const EventText& text(size_t index) const {
+        return mText[mStore.sequence(index)];
+    }
+
+    // Empty unless the event at index is a SysEx message.
+    SysExMessage sysEx(size_t index) const;
+
+    size_t size() const {
+        return mStore.size();
+    }
+
+    size_t capacity() const {
+        return mStore.capacity();
+    }
+
+    const EventStore& store() const {
+        return mStore;
+    }
+
+    // Null unless the log is indexed.
+    EventIndex* index() {
+        return mIndex.get();
+    }
+
+private:
+    struct SysExEntry {
+        uint64_t sequence;
+        uint32_t payload;
+    };
+
+    void releaseEvicted();
+
+private:
+    EventStore mStore;
+    std::unique_ptr<EventIndex> mIndex;
+    EventTextCache mText;
+    SysExPool* mSysExPool;
+    std::deque<SysExEntry> mSysEx;
+};
+
+}
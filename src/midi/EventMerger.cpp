@@ -0,0 +1,22 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#include "EventMerger.h"
+
+#include <algorithm>
+
+namespace midi {
+
+EventMerger::EventMerger(size_t sourceCount, uint64_t holdBack, size_t capacity) :
+mSources(sourceCount),
+mHoldBack(holdBack),
+mCapacity(capacity),
+mMask(capacity - 1) {
+}
+
+void EventMerger::compact() {
+    mActive.erase(std::remove_if(mActive.begin(), mActive.end(), [this](byte port) {
+        return mSources[port].head == mSources[port].tail;
+    }), mActive.end());
+}
+
+}
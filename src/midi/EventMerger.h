@@ -0,0 +1,102 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#pragma once
+
+#include "Event.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace midi {
+
+// Merges per-port event streams, each already in time order, into a single
+// stream ordered by timestamp. Events are held back until they are older
+// than a short window so a port that publishes late still sorts correctly.
+// Each port has a fixed-capacity ring, allocated on its first event.
+class EventMerger {
+public:
+    // capacity is per port and must be a power of two.
+    explicit EventMerger(size_t sourceCount = 256, uint64_t holdBack = 2000000, size_t capacity = 1 << 15);
+
+    // Returns false, and counts the event, if its port's ring is full.
+    bool add(const Event& event) {
+        auto& source = mSources[event.port];
+        if (source.head == source.tail) {
+            if (!source.events)
+                source.events.reset(new Event[mCapacity]);
+            mActive.push_back(event.port);
+        } else if (source.tail - source.head == mCapacity) {
+            ++mOverflowCount;
+            return false;
+        }
+        source.events[source.tail++ & mMask] = event;
+        return true;
+    }
+
+    // Emits, in time order, every pending event no newer than now - holdBack.
+    template <typename F>
+    size_t merge(uint64_t now, F&& f);
+
+    // Emits every pending event regardless of age.
+    template <typename F>
+    size_t flush(F&& f) {
+        return merge(UINT64_MAX, f);
+    }
+
+    uint64_t overflowCount() const {
+        return mOverflowCount;
+    }
+
+private:
+    struct Source {
+        std::unique_ptr<Event[]> events;
+        size_t head = 0;
+        size_t tail = 0;
+    };
+
+    const Event& front(const Source& source) const {
+        return source.events[source.head & mMask];
+    }
+
+    void compact();
+
+private:
+    std::vector<Source> mSources;
+    std::vector<byte> mActive;
+    uint64_t mHoldBack;
+    size_t mCapacity;
+    size_t mMask;
+    uint64_t mOverflowCount = 0;
+};
+
+template <typename F>
+size_t EventMerger::merge(uint64_t now, F&& f) {
+    const auto until = now == UINT64_MAX ? now : (now > mHoldBack ? now - mHoldBack : 0);
+    size_t count = 0;
+
+    // Few ports are active at once, so a linear scan for the oldest head
+    // beats maintaining a heap.
+    while (true) {
+        Source* oldest = nullptr;
+        for (auto port : mActive) {
+            auto& source = mSources[port];
+            if (source.head == source.tail)
+                continue;
+            if (!oldest || front(source).time < front(*oldest).time)
+                oldest = &source;
+        }
+        if (!oldest || front(*oldest).time > until)
+            break;
+
+        f(front(*oldest));
+        ++oldest->head;
+        ++count;
+    }
+
+    compact();
+    return count;
+}
+
+}
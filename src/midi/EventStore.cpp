@@ -0,0 +1,101 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#include "EventStore.h"
+
+#include <algorithm>
+
+namespace midi {
+
+EventStore::EventStore(size_t capacity, RetentionPolicy policy) :
+mTimes(new uint64_t[std::max<size_t>(capacity, 1)]),
+mStatuses(new byte[std::max<size_t>(capacity, 1)]),
+mData1(new byte[std::max<size_t>(capacity, 1)]),
+mData2(new byte[std::max<size_t>(capacity, 1)]),
+mPorts(new byte[std::max<size_t>(capacity, 1)]),
+mExtras(new Extra[std::max<size_t>(capacity, 1)]),
+mCapacity(std::max<size_t>(capacity, 1)),
+mLimit(mCapacity) {
+    setRetention(policy);
+}
+
+void EventStore::push(const Event& event) {
+    if (mSize == mLimit)
+        popOldest();
+
+    // Events after the last late one are each at least as new as every
+    // event before them, so they are in order.
+    if (event.time < mNewestTime) {
+        mLastLate = mPushedCount;
+        mHasLate = true;
+    } else {
+        mNewestTime = event.time;
+    }
+
+    const auto at = position(mSize);
+    mTimes[at] = event.time;
+    mStatuses[at] = event.status;
+    mData1[at] = event.data1;
+    mData2[at] = event.data2;
+    mPorts[at] = event.port;
+    mExtras[at] = {event.direction, {event.reserved[0], event.reserved[1], event.reserved[2]}};
+    ++mSize;
+    ++mPushedCount;
+
+    if (mPolicy.maxAge > 0)
+        enforce(event.time);
+}
+
+void EventStore::clear() {
+    mFirst = 0;
+    mSize = 0;
+    mNewestTime = 0;
+    mHasLate = false;
+}
+
+void EventStore::expire(uint64_t now) {
+    if (mPolicy.maxAge > 0)
+        enforce(now);
+}
+
+void EventStore::setRetention(const RetentionPolicy& policy) {
+    mPolicy = policy;
+    mLimit = mCapacity;
+    if (mPolicy.maxCount > 0)
+        mLimit = std::min(mLimit, mPolicy.maxCount);
+    if (mPolicy.maxBytes > 0)
+        mLimit = std::min(mLimit, std::max<size_t>(mPolicy.maxBytes / sizeof(Event), 1));
+
+    while (mSize > mLimit)
+        popOldest();
+    if (mSize > 0 && mPolicy.maxAge > 0)
+        enforce(time(mSize - 1));
+}
+
+size_t EventStore::lowerBound(uint64_t time) const {
+    size_t first = 0;
+    size_t count = mSize;
+    while (count > 0) {
+        const auto step = count / 2;
+        if (this->time(first + step) < time) {
+            first += step + 1;
+            count -= step + 1;
+        } else {
+            count = step;
+        }
+    }
+    return first;
+}
+
+void EventStore::popOldest() {
+    if (++mFirst == mCapacity)
+        mFirst = 0;
+    --mSize;
+    ++mEvictedCount;
+}
+
+void EventStore::enforce(uint64_t now) {
+    while (mSize > 0 && now > mTimes[mFirst] && now - mTimes[mFirst] > mPolicy.maxAge)
+        popOldest();
+}
+
+}
@@ -0,0 +1,145 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#pragma once
+
+#include "Event.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace midi {
+
+// Limits applied on every push. A zero field means "no limit"; the store's
+// capacity always applies. On push, age is measured from the pushed event;
+// expire() measures it from the current time so idle stores age out too.
+struct RetentionPolicy {
+    size_t maxCount = 0;
+    size_t maxBytes = 0;
+    uint64_t maxAge = 0;
+};
+
+// Fixed-capacity ring of events. All memory is allocated up front and the
+// oldest events are evicted in O(1) once the retention policy is exceeded.
+// Fields are kept in separate columns so filters can scan one byte per
+// event with vector loads (see EventFilter). Events should be pushed in time
+// order; a late one (older than an event before it) is kept where it was
+// pushed, and isOrdered() is false until it has been evicted.
+class EventStore {
+public:
+    // Indexed by physical position, not by logical index.
+    struct Columns {
+        const uint64_t* times;
+        const byte* statuses;
+        const byte* data1;
+        const byte* data2;
+        const byte* ports;
+    };
+
+public:
+    explicit EventStore(size_t capacity, RetentionPolicy policy = RetentionPolicy());
+
+    EventStore(const EventStore&) = delete;
+    EventStore& operator=(const EventStore&) = delete;
+
+    void push(const Event& event);
+    void clear();
+
+    // Evicts events older than the policy's maxAge at now, a
+    // monotonicNanoseconds() time.
+    void expire(uint64_t now);
+
+    void setRetention(const RetentionPolicy& policy);
+    const RetentionPolicy& retention() const {
+        return mPolicy;
+    }
+
+    // Index 0 is the oldest retained event, size() - 1 the newest.
+    Event operator[](size_t index) const {
+        const auto at = position(index);
+        const auto& extra = mExtras[at];
+        return {mTimes[at], mStatuses[at], mData1[at], mData2[at], mPorts[at], extra.direction,
+                {extra.reserved[0], extra.reserved[1], extra.reserved[2]}};
+    }
+
+    uint64_t time(size_t index) const {
+        return mTimes[position(index)];
+    }
+
+    // Physical position of a logical index. The retained events wrap
+    // around the end of the columns at most once.
+    size_t position(size_t index) const {
+        auto position = mFirst + index;
+        if (position >= mCapacity)
+            position -= mCapacity;
+        return position;
+    }
+
+    Columns columns() const {
+        return {mTimes.get(), mStatuses.get(), mData1.get(), mData2.get(), mPorts.get()};
+    }
+
+    // True when the retained events are in time order.
+    bool isOrdered() const {
+        return !mHasLate || mLastLate < sequence(0);
+    }
+
+    // Index of the first event at or after time. Only valid if isOrdered().
+    size_t lowerBound(uint64_t time) const;
+
+    size_t size() const {
+        return mSize;
+    }
+
+    bool empty() const {
+        return mSize == 0;
+    }
+
+    size_t capacity() const {
+        return mCapacity;
+    }
+
+    size_t limit() const {
+        return mLimit;
+    }
+
+    uint64_t evictedCount() const {
+        return mEvictedCount;
+    }
+
+    // Monotonic number of the event at index, stable across evictions.
+    uint64_t sequence(size_t index) const {
+        return mPushedCount - mSize + index;
+    }
+
+private:
+    void popOldest();
+    void enforce(uint64_t now);
+
+private:
+    struct Extra {
+        Direction direction;
+        byte reserved[3];
+    };
+
+private:
+    std::unique_ptr<uint64_t[]> mTimes;
+    std::unique_ptr<byte[]> mStatuses;
+    std::unique_ptr<byte[]> mData1;
+    std::unique_ptr<byte[]> mData2;
+    std::unique_ptr<byte[]> mPorts;
+    std::unique_ptr<Extra[]> mExtras;
+    size_t mCapacity;
+    size_t mLimit;
+    size_t mFirst = 0;
+    size_t mSize = 0;
+    uint64_t mEvictedCount = 0;
+    uint64_t mPushedCount = 0;
+    // Newest time pushed, and the sequence number of the last late event.
+    uint64_t mNewestTime = 0;
+    uint64_t mLastLate = 0;
+    bool mHasLate = false;
+    RetentionPolicy mPolicy;
+};
+
+}
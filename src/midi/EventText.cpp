@@ -0,0 +1,83 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#include "EventText.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace midi {
+
+namespace {
+
+void formatByte(unsigned value, char* text) {
+    if (value >= 100)
+        *text++ = '0' + value / 100;
+    if (value >= 10)
+        *text++ = '0' + value / 10 % 10;
+    *text++ = '0' + value % 10;
+    *text = '\0';
+}
+
+}
+
+void formatEvent(const Event& event, uint64_t delay, size_t sysExSize, EventText& text) {
+    text.type = typeName(event.status);
+    std::snprintf(text.time, sizeof(text.time), "%llu.%09llu",
+                  (unsigned long long)(event.time / 1000000000), (unsigned long long)(event.time % 1000000000));
+    std::snprintf(text.delay, sizeof(text.delay), "%f", delay * 1e-9);
+    if (event.isSysEx()) {
+        text.channel[0] = '\0';
+        std::snprintf(text.data1, sizeof(text.data1), "%zu", sysExSize);
+        text.data2[0] = '\0';
+        return;
+    }
+    // System messages have no channel and some have no data bytes.
+    const auto size = Message::wireSize(event.status);
+    text.channel[0] = '\0';
+    text.data1[0] = '\0';
+    text.data2[0] = '\0';
+    if (event.status < 0xF0)
+        formatByte((event.status & 0x0F) + 1, text.channel);
+    if (size > 1)
+        formatByte(event.data1, text.data1);
+    if (size > 2)
+        formatByte(event.data2, text.data2);
+}
+
+void formatHexPreview(const SysExMessage& message, char* text, size_t size) {
+    static const char digits[] = "0123456789ABCDEF";
+    if (size == 0)
+        return;
+
+    size_t length = 0;
+    for (size_t index = 0; index < message.size(); ++index) {
+        // Each byte takes three characters; keep room for "..." and the terminator.
+        const bool last = index + 1 == message.size();
+        if (length + (last ? 3 : 6) + 1 > size) {
+            if (length + 4 <= size) {
+                std::memcpy(text + length, "...", 3);
+                length += 3;
+            }
+            break;
+        }
+        text[length++] = digits[message[index] >> 4];
+        text[length++] = digits[message[index] & 0x0F];
+        text[length++] = ' ';
+    }
+    text[length] = '\0';
+}
+
+EventTextCache::EventTextCache(size_t capacity) :
+mChunks((capacity + kChunkRows - 1) / kChunkRows),
+mCapacity(capacity) {
+}
+
+EventText& EventTextCache::slot(uint64_t sequence) {
+    const auto index = sequence % mCapacity;
+    auto& chunk = mChunks[index / kChunkRows];
+    if (!chunk)
+        chunk.reset(new EventText[kChunkRows]);
+    return chunk[index % kChunkRows];
+}
+
+}
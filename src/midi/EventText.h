@@ -0,0 +1,54 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#pragma once
+
+#include "Event.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace midi {
+
+// Display strings for one log row, formatted once when the event is logged.
+struct EventText {
+    const char* type;
+    char time[24];
+    char delay[16];
+    char channel[4];
+    // Holds the byte count for SysEx.
+    char data1[12];
+    char data2[4];
+};
+
+void formatEvent(const Event& event, uint64_t delay, size_t sysExSize, EventText& text);
+
+// Writes the leading bytes of message as hex, ending in "..." when it does
+// not fit in size characters.
+void formatHexPreview(const SysExMessage& message, char* text, size_t size);
+
+// Chunked arena of formatted rows keyed by event sequence number. Chunks are
+// allocated on first use and recycled once the sequence wraps past capacity.
+class EventTextCache {
+public:
+    explicit EventTextCache(size_t capacity);
+
+    EventTextCache(const EventTextCache&) = delete;
+    EventTextCache& operator=(const EventTextCache&) = delete;
+
+    EventText& slot(uint64_t sequence);
+
+    const EventText& operator[](uint64_t sequence) const {
+        const auto index = sequence % mCapacity;
+        return mChunks[index / kChunkRows][index % kChunkRows];
+    }
+
+private:
+    static const size_t kChunkRows = 4096;
+
+    std::vector<std::unique_ptr<EventText[]>> mChunks;
+    size_t mCapacity;
+};
+
+}
@@ -0,0 +1,103 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#include "LatencyBenchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+namespace midi {
+
+namespace {
+
+uint64_t percentile(const std::vector<uint64_t>& sorted, double fraction) {
+    auto rank = (size_t)std::ceil(fraction * sorted.size());
+    if (rank > 0)
+        --rank;
+    return sorted[std::min(rank, sorted.size() - 1)];
+}
+
+}
+
+LatencyBenchmark::LatencyBenchmark(MidiManager& manager) :
+mManager(manager),
+mSendTimes(new std::atomic<uint64_t>[kSequenceCount]) {
+}
+
+bool LatencyBenchmark::run(const std::string& input, const std::string& output, const LatencyOptions& options, LatencyReport& report) {
+    report = LatencyReport();
+    mStatus = 0xE0 | ((std::max<byte>(options.channel, 1) - 1) & 0x0F);
+    for (size_t sequence = 0; sequence < kSequenceCount; ++sequence) {
+        mSendTimes[sequence].store(0, std::memory_order_relaxed);
+    }
+    mRoundTrips.assign(options.count, 0);
+    mRecievedCount.store(0, std::memory_order_relaxed);
+
+    if (!mManager.openInputPort(input, [this](const Event& event) { recieved(event); }))
+        return false;
+    if (!mManager.openOutputPort(output)) {
+        mManager.closeInputPort(input);
+        return false;
+    }
+
+    const auto period = std::chrono::nanoseconds((uint64_t)(1e9 / std::max(options.rate, 1.0)));
+    auto deadline = std::chrono::steady_clock::now();
+    for (uint32_t probe = 0; probe < options.count; ++probe) {
+        std::this_thread::sleep_until(deadline);
+        deadline += period;
+
+        const auto sequence = probe % kSequenceCount;
+        mSendTimes[sequence].store(monotonicNanoseconds(), std::memory_order_release);
+        mManager.sendMessage(ChannelMessage(mStatus, sequence & 0x7F, sequence >> 7));
+        ++report.sent;
+    }
+
+    const auto giveUp = monotonicNanoseconds() + options.timeout;
+    while (mRecievedCount.load(std::memory_order_acquire) < report.sent && monotonicNanoseconds() < giveUp) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // Closing the input joins its thread, so the round trips are stable after this.
+    mManager.closeInputPort(input);
+    mManager.closeOutputPort();
+
+    report.received = mRecievedCount.load(std::memory_order_acquire);
+    if (report.received == 0)
+        return true;
+
+    std::vector<uint64_t> roundTrips(mRoundTrips.begin(), mRoundTrips.begin() + report.received);
+    double total = 0.0;
+    double variation = 0.0;
+    for (size_t index = 0; index < roundTrips.size(); ++index) {
+        total += roundTrips[index];
+        if (index > 0)
+            variation += std::fabs((double)roundTrips[index] - (double)roundTrips[index - 1]);
+    }
+    report.mean = total / roundTrips.size();
+    report.jitter = roundTrips.size() > 1 ? variation / (roundTrips.size() - 1) : 0.0;
+
+    std::sort(roundTrips.begin(), roundTrips.end());
+    report.min = roundTrips.front();
+    report.median = percentile(roundTrips, 0.5);
+    report.p99 = percentile(roundTrips, 0.99);
+    report.p999 = percentile(roundTrips, 0.999);
+    report.max = roundTrips.back();
+    return true;
+}
+
+void LatencyBenchmark::recieved(const Event& event) {
+    if (event.status != mStatus)
+        return;
+
+    const auto sequence = (size_t)event.data1 | ((size_t)event.data2 << 7);
+    const auto sent = mSendTimes[sequence].exchange(0, std::memory_order_acq_rel);
+    const auto count = mRecievedCount.load(std::memory_order_relaxed);
+    if (sent == 0 || count == mRoundTrips.size())
+        return;
+
+    mRoundTrips[count] = event.time > sent ? event.time - sent : 0;
+    mRecievedCount.store(count + 1, std::memory_order_release);
+}
+
+}
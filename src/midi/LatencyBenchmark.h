@@ -0,0 +1,65 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#pragma once
+
+#include "MidiManager.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace midi {
+
+struct LatencyOptions {
+    uint32_t count = 10000;
+    // Probes sent per second.
+    double rate = 1000.0;
+    // Probes are pitch bends on this channel (1-16) carrying a 14-bit
+    // sequence number, so it should be otherwise quiet on the loopback.
+    byte channel = 16;
+    // How long to wait for stragglers after the last probe.
+    uint64_t timeout = 1000000000;
+};
+
+// Round-trip times in nanoseconds. Jitter is the mean absolute difference
+// between consecutive round trips, in arrival order.
+struct LatencyReport {
+    uint64_t sent = 0;
+    uint64_t received = 0;
+    uint64_t min = 0;
+    uint64_t median = 0;
+    uint64_t p99 = 0;
+    uint64_t p999 = 0;
+    uint64_t max = 0;
+    double mean = 0.0;
+    double jitter = 0.0;
+};
+
+// Measures round-trip latency by sending probes through an output port and
+// matching them on an input port that is looped back to it, either through
+// the driver (e.g. ALSA's "Midi Through") or kLoopbackPortName.
+class LatencyBenchmark {
+public:
+    explicit LatencyBenchmark(MidiManager& manager);
+
+    LatencyBenchmark(const LatencyBenchmark&) = delete;
+    LatencyBenchmark& operator=(const LatencyBenchmark&) = delete;
+
+    bool run(const std::string& input, const std::string& output, const LatencyOptions& options, LatencyReport& report);
+
+private:
+    static const size_t kSequenceCount = 1 << 14;
+
+    void recieved(const Event& event);
+
+private:
+    MidiManager& mManager;
+    byte mStatus = 0;
+    std::unique_ptr<std::atomic<uint64_t>[]> mSendTimes;
+    std::vector<uint64_t> mRoundTrips;
+    std::atomic<size_t> mRecievedCount{0};
+};
+
+}
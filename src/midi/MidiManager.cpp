@@ -16,91 +16,364 @@ MidiManager::~MidiManager() {
 }
 
 std::vector<std::string> MidiManager::getInputPortNames() const {
-    return getPortNames(mRtMidiIn.get());
+    return getPortNames(*mRtMidiIn, mInputDirectory);
 }
 
 std::vector<std::string> MidiManager::getOutputPortNames() const {
-    return getPortNames(mRtMidiOut.get());
+    return getPortNames(*mRtMidiOut, mOutputDirectory);
 }
 
-std::vector<std::string> MidiManager::getPortNames(RtMidi* rtMidi) const {
-    std::vector<std::string> portNames;
-
-    auto portCount = rtMidi->getPortCount();
-    for (auto portNumber = 0; portNumber < portCount; ++portNumber) {
-        auto portName = rtMidi->getPortName(portNumber);
-        portNames.push_back(portName);
-    }
-
+std::vector<std::string> MidiManager::getPortNames(RtMidi& rtMidi, PortDirectory& directory) const {
+    std::lock_guard<std::mutex> lock(mDirectoryMutex);
+    auto portNames = directory.names(rtMidi);
+    portNames.push_back(kLoopbackPortName);
     return portNames;
 }
 
 bool MidiManager::openPort(std::string input, std::string output, MidiRecievedFunction f) {
     closePort();
 
-    try {
-        const auto inputNumber = inputPortNumber(input);
-        mRtMidiIn->openPort(inputNumber);
-        mRtMidiIn->setCallback(&RtMidiCallback, this);
-        mMidiRecievedFunction = f;
-    } catch (RtMidiError e) {
+    const auto port = inputPortId(input);
+    if (port == kNoPortId || !openInput(input, (byte)port, f, nullptr, nullptr))
         return false;
+
+    // Don't care if output fails right now
+    openOutputPort(output);
+
+    return true;
+}
+
+bool MidiManager::openInputPort(std::string input, MidiEventFunction f) {
+    closeInputPort(input);
+    const auto port = inputPortId(input);
+    return port != kNoPortId && openInput(input, (byte)port, nullptr, f, nullptr);
+}
+
+bool MidiManager::openBatchedInputPort(std::string input, MidiEventBatchFunction f) {
+    closeInputPort(input);
+    const auto port = inputPortId(input);
+    return port != kNoPortId && openInput(input, (byte)port, nullptr, nullptr, f);
+}
+
+bool MidiManager::openInput(std::string name, byte port, MidiRecievedFunction recievedFunction, MidiEventFunction eventFunction, MidiEventBatchFunction batchFunction) {
+    std::unique_ptr<Input> input(new Input());
+    input->port = port;
+    input->name = name;
+    input->deliver = &deliverToFunctions;
+    input->midiRecievedFunction = recievedFunction;
+    input->midiEventFunction = eventFunction;
+    input->midiEventBatchFunction = batchFunction;
+    if (batchFunction)
+        input->batch.resize(256);
+    return openInput(std::move(input), batchFunction ? &RtMidiBatchCallback : nullptr, &RtMidiCallback);
+}
+
+bool MidiManager::openInput(std::unique_ptr<Input> input, RtMidiIn::RtMidiBatchCallback batchCallback, RtMidiIn::RtMidiTimedCallback callback) {
+    input->manager = this;
+    if (mTrafficStats)
+        mTrafficStats->addPort(input->port);
+
+    if (input->name != kLoopbackPortName) {
+        try {
+            input->rtMidiIn.reset(new RtMidiIn(RtMidi::UNSPECIFIED, kConnectionClientName));
+            if (!openNamedPort(*input->rtMidiIn, *mRtMidiIn, mInputDirectory, input->name))
+                return false;
+            input->rtMidiIn->ignoreTypes(false, true, true);
+            if (batchCallback)
+                input->rtMidiIn->setCallback(batchCallback, callback, input.get());
+            else
+                input->rtMidiIn->setCallback(callback, input.get());
+        } catch (RtMidiError e) {
+            return false;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    mInputs.push_back(std::move(input));
+    return true;
+}
+
+void MidiManager::closeInputPort(std::string input) {
+    std::unique_ptr<Input> closing;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        for (auto it = mInputs.begin(); it != mInputs.end(); ++it) {
+            if ((*it)->name == input) {
+                closing = std::move(*it);
+                mInputs.erase(it);
+                break;
+            }
+        }
+    }
+
+    // Closing joins the driver thread, so do it outside the lock.
+    if (closing && closing->rtMidiIn) {
+        closing->rtMidiIn->cancelCallback();
+        closing->rtMidiIn->closePort();
+    }
+}
+
+bool MidiManager::isInputPortOpen(const std::string& input) const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    for (auto& entry : mInputs) {
+        if (entry->name == input)
+            return true;
+    }
+    return false;
+}
+
+int MidiManager::inputPortId(const std::string& input) {
+    const auto found = mInputPortIds.find(input);
+    if (found != mInputPortIds.end())
+        return found->second;
+    // Ids are a byte wide. A shared id would put two driver threads on one
+    // single-producer ring, so there is no fallback.
+    if (mInputPortNames.size() > 255)
+        return kNoPortId;
+    mInputPortNames.push_back(input);
+    const auto port = (byte)(mInputPortNames.size() - 1);
+    mInputPortIds.emplace(input, port);
+    return port;
+}
+
+PortTiming MidiManager::inputPortTiming(byte port) const {
+    PortTiming timing = {0, 0, 0};
+    std::lock_guard<std::mutex> lock(mMutex);
+    for (auto& input : mInputs) {
+        if (input->port == port) {
+            timing.eventCount = input->eventCount.load(std::memory_order_relaxed);
+            timing.lastTime = input->lastTime.load(std::memory_order_relaxed);
+            timing.jitter = input->publishedJitter.load(std::memory_order_relaxed);
+        }
+    }
+    return timing;
+}
+
+std::future<bool> MidiManager::openBatchedInputPortAsync(std::string input, MidiEventBatchFunction f) {
+    // The id is assigned here, so the control thread never touches the id map.
+    const auto port = inputPortId(input);
+    if (port == kNoPortId)
+        return post<bool>([]() { return false; });
+    return post<bool>([this, input, port, f]() {
+        closeInputPort(input);
+        return openInput(input, (byte)port, nullptr, nullptr, f);
+    });
+}
+
+std::future<void> MidiManager::closeInputPortAsync(std::string input) {
+    return post<void>([this, input]() {
+        closeInputPort(input);
+    });
+}
+
+std::future<bool> MidiManager::openOutputPortAsync(std::string output) {
+    return post<bool>([this, output]() {
+        return openOutputPort(output);
+    });
+}
+
+std::future<void> MidiManager::closeOutputPortAsync() {
+    return post<void>([this]() {
+        closeOutputPort();
+    });
+}
+
+void MidiManager::runCommands() {
+    std::unique_lock<std::mutex> lock(mCommandMutex);
+    while (true) {
+        mCommandReady.wait(lock, [this]() { return mStopping || !mCommands.empty(); });
+        // Pending commands still run on stop, so no future is left unready.
+        if (mCommands.empty())
+            return;
+        auto command = std::move(mCommands.front());
+        mCommands.pop_front();
+        lock.unlock();
+        command();
+        lock.lock();
+    }
+}
+
+void MidiManager::stopCommands() {
+    {
+        std::lock_guard<std::mutex> lock(mCommandMutex);
+        if (!mControlThread.joinable())
+            return;
+        mStopping = true;
+    }
+    mCommandReady.notify_one();
+    mControlThread.join();
+    mStopping = false;
+}
+
+bool MidiManager::openOutputPort(std::string output) {
+    closeOutputPort();
+
+    if (output == kLoopbackPortName) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mLoopbackOpen = true;
+        return true;
     }
 
+    std::unique_ptr<RtMidiOut> rtMidiOut;
     try {
-        const auto outputNumber = outputPortNumber(output);
-        mRtMidiOut->openPort(outputNumber);
+        rtMidiOut.reset(new RtMidiOut(RtMidi::UNSPECIFIED, kConnectionClientName));
+        if (!openNamedPort(*rtMidiOut, *mRtMidiOut, mOutputDirectory, output))
+            return false;
     } catch (RtMidiError e) {
-        // Don't care if output fails right now
+        return false;
     }
 
+    std::lock_guard<std::mutex> lock(mMutex);
+    mOutput = std::move(rtMidiOut);
     return true;
 }
 
+void MidiManager::closeOutputPort() {
+    std::unique_ptr<RtMidiOut> closing;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        flushLocked();
+        closing = std::move(mOutput);
+        mLoopbackOpen = false;
+    }
+
+    if (closing)
+        closing->closePort();
+}
+
 void MidiManager::closePort() {
-    mRtMidiIn->cancelCallback();
-    mRtMidiIn->closePort();
-    mRtMidiOut->closePort();
-    mMidiRecievedFunction = nullptr;
+    stopCommands();
+
+    std::vector<std::unique_ptr<Input>> closing;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        closing.swap(mInputs);
+    }
+    for (auto& input : closing) {
+        if (input->rtMidiIn) {
+            input->rtMidiIn->cancelCallback();
+            input->rtMidiIn->closePort();
+        }
+    }
+    closeOutputPort();
 }
 
-void MidiManager::sendMessage(const ChannelMessage& channelMessage) const {
-    auto message = channelMessage.message();
-    mRtMidiOut->sendMessage(&message);
+void MidiManager::sendMessage(const Message& message) const {
+    const unsigned char bytes[3] = {
+        message.statusByte(),
+        message.byte1(),
+        message.byte2()
+    };
+    if (!message.empty()) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        send(bytes, message.size());
+    }
 }
 
 void MidiManager::sendMessage(const SysExMessage& sysExMessage) const {
-    auto message = sysExMessage.message();
-    mRtMidiOut->sendMessage(&message);
+    std::lock_guard<std::mutex> lock(mMutex);
+    send(sysExMessage.data(), sysExMessage.size());
 }
 
-int MidiManager::inputPortNumber(std::string name) const {
-    auto portCount = mRtMidiIn->getPortCount();
-    for (auto portNumber = 0; portNumber < portCount; ++portNumber) {
-        auto portName = mRtMidiIn->getPortName(portNumber);
-        if (portName == name)
-            return portNumber;
+void MidiManager::queueMessage(const Message& message) {
+    const unsigned char bytes[3] = {
+        message.statusByte(),
+        message.byte1(),
+        message.byte2()
+    };
+    if (message.empty())
+        return;
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mLoopbackOpen) {
+        send(bytes, message.size());
+        return;
     }
+    if (!mOutput)
+        return;
+
+    mOutput->queueMessage(bytes, message.size());
+    if (++mQueuedCount >= mFlushThreshold)
+        flushLocked();
+}
+
+void MidiManager::flushOutput() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    flushLocked();
+}
 
-    return -1;
+void MidiManager::flushLocked() const {
+    if (mQueuedCount == 0)
+        return;
+    if (mOutput)
+        mOutput->flush();
+    mQueuedCount = 0;
 }
 
-int MidiManager::outputPortNumber(std::string name) const {
-    auto portCount = mRtMidiOut->getPortCount();
-    for (auto portNumber = 0; portNumber < portCount; ++portNumber) {
-        auto portName = mRtMidiOut->getPortName(portNumber);
-        if (portName == name)
-            return portNumber;
+// Called with mMutex held. Loopback receivers run under it and must not
+// call back into the manager.
+void MidiManager::send(const unsigned char* message, size_t size) const {
+    if (!mLoopbackOpen) {
+        // Queued messages go first, and the count restarts with them.
+        flushLocked();
+        if (mOutput)
+            mOutput->sendMessage(message, size);
+        return;
+    }
+    for (auto& input : mInputs) {
+        if (!input->rtMidiIn)
+            input->deliver(*input, 0, message, size);
     }
-    
-    return -1;
 }
 
-void MidiManager::recievedMessage(const double& delay, std::vector<unsigned char>* message) const {
-    const uint8_t statusByte = message->at(0);
-    const uint8_t dataByte1 = message->at(1);
-    const uint8_t dataByte2 = (message->size() > 2) ? message->at(2) : 0;
-    mMidiRecievedFunction({statusByte, dataByte1, dataByte2}, delay);
+// ALSA opens by the address in the name without enumerating, if the client
+// there still has the name's client name. Otherwise the directory's number
+// for a name goes stale when ports come or go before the watcher invalidates
+// it, so check what was opened and re-enumerate once.
+bool MidiManager::openNamedPort(RtMidi& connection, RtMidi& lister, PortDirectory& directory, const std::string& name) const {
+    int client, port;
+    if (PortDirectory::address(name, client, port) &&
+        connection.openPortAt(client, port, name.substr(0, name.rfind(' '))))
+        return true;
+
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        int number;
+        {
+            std::lock_guard<std::mutex> lock(mDirectoryMutex);
+            if (attempt > 0)
+                directory.invalidate();
+            number = directory.portNumber(lister, name);
+        }
+        if (number == PortDirectory::kNoPort)
+            return false;
+
+        connection.openPort((unsigned int)number);
+        if (connection.getPortName((unsigned int)number) == name)
+            return true;
+        connection.closePort();
+    }
+    return false;
+}
+
+void MidiManager::recievedMessage(Input& input, uint64_t time, const double& delay, const unsigned char* message, size_t size) const {
+    const auto event = makeEvent(input, time, message, size);
+    if (input.midiEventBatchFunction)
+        input.midiEventBatchFunction(&event, 1);
+    if (input.midiEventFunction)
+        input.midiEventFunction(event);
+    if (input.midiRecievedFunction)
+        input.midiRecievedFunction(event.message(), delay);
+    // ChannelMessage receivers never see the payload, so nobody else can release it.
+    if (event.isSysEx() && mSysExPool && !input.midiEventBatchFunction && !input.midiEventFunction)
+        mSysExPool->release(event.payload());
+}
+
+void MidiManager::recievedBatch(Input& input, const RtMidiIn::PackedMessage* messages, size_t count) const {
+    if (input.batch.size() < count)
+        input.batch.resize(count);
+    for (size_t index = 0; index < count; ++index) {
+        input.batch[index] = makeEvent(input, messages[index].time, messages[index].bytes, messages[index].size);
+    }
+    input.midiEventBatchFunction(input.batch.data(), count);
 }
 
 }
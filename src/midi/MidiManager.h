@@ -2,46 +2,282 @@
 
 #pragma once
 
+#include "Event.h"
 #include "MidiTypes.h"
+#include "PortDirectory.h"
+#include "SysExPool.h"
+#include "TrafficStats.h"
 
 #include <RtMidi.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 #include <string>
+#include <unordered_map>
 
 namespace midi {
 
+using MidiEventFunction = std::function<void (const Event& event)>;
+using MidiEventBatchFunction = std::function<void (const Event* events, size_t count)>;
+
+// In-process port listed among both inputs and outputs: messages sent to it
+// are delivered to it as input, on the sending thread.
+const char kLoopbackPortName[] = "Beagle Loopback";
+
+// Arrival statistics of one input port. Jitter is the smoothed variation
+// between consecutive inter-arrival intervals (J += (|D| - J) / 16, as in
+// RFC 3550), in nanoseconds.
+struct PortTiming {
+    uint64_t eventCount;
+    uint64_t lastTime;
+    uint64_t jitter;
+};
+
 class MidiManager {
 public:
+    static const int kNoPortId = -1;
+
     MidiManager();
     ~MidiManager();
 
+    // Port lists are cached, and opening a port by name looks it up in the
+    // cache. Invalidate whenever ports may have come or gone.
     std::vector<std::string> getInputPortNames() const;
     std::vector<std::string> getOutputPortNames() const;
+    void invalidatePorts() {
+        std::lock_guard<std::mutex> lock(mDirectoryMutex);
+        mInputDirectory.invalidate();
+        mOutputDirectory.invalidate();
+    }
 
     bool openPort(std::string input, std::string output, MidiRecievedFunction f);
+    bool openOutputPort(std::string output);
+    void closeOutputPort();
     void closePort();
+
+    // Inputs can be opened side by side. Every event is stamped with the
+    // driver's arrival time, in monotonicNanoseconds(), and the compact id
+    // of the port it came from; ids are stable for the lifetime of the manager.
+    bool openInputPort(std::string input, MidiEventFunction f);
+    // Delivers every event that is pending when the driver wakes up in one
+    // call, in arrival order, instead of one call per event.
+    bool openBatchedInputPort(std::string input, MidiEventBatchFunction f);
+    // Sink is any callable taking const Event&. It is stored by value and
+    // called straight from the driver thread, without type erasure, so the
+    // whole path from the driver's bytes to the sink can be inlined.
+    template <typename Sink>
+    bool bindInputPort(std::string input, Sink sink);
+    void closeInputPort(std::string input);
+    bool isInputPortOpen(const std::string& input) const;
+    // Ids are assigned on the calling thread; call from one thread only.
+    // They are never reused, so once 256 names have been seen this returns
+    // kNoPortId for new ones and opening them fails.
+    int inputPortId(const std::string& input);
+    const std::string& inputPortName(byte port) const {
+        return mInputPortNames[port];
+    }
+    PortTiming inputPortTiming(byte port) const;
+
+    // Opening and closing run in order on a control thread, so that creating
+    // connections and joining driver threads never blocks the caller. The
+    // futures become ready when the command has completed.
+    std::future<bool> openBatchedInputPortAsync(std::string input, MidiEventBatchFunction f);
+    std::future<void> closeInputPortAsync(std::string input);
+    std::future<bool> openOutputPortAsync(std::string output);
+    std::future<void> closeOutputPortAsync();
+
+    // Counts every input event into stats. Set before opening inputs.
+    void setTrafficStats(TrafficStats* stats) {
+        mTrafficStats = stats;
+    }
+
+    // Stores incoming SysEx in pool and delivers it as Event::makeSysEx.
+    // Receivers own the payloads and must release them. Without a pool,
+    // SysEx arrives as a bare 0xF0 event. Set before opening inputs.
+    void setSysExPool(SysExPool* pool) {
+        mSysExPool = pool;
+    }
     
-    void sendMessage(const ChannelMessage& channelMessage) const;
+    // Empty messages are dropped.
+    void sendMessage(const Message& message) const;
     void sendMessage(const SysExMessage& sysExMessage) const;
-    
+
+    // Batched output. Queued messages are written to the driver together
+    // by flushOutput(), or automatically once flushThreshold are pending.
+    void queueMessage(const Message& message);
+    void flushOutput();
+    void setFlushThreshold(size_t threshold) {
+        mFlushThreshold = threshold > 0 ? threshold : 1;
+    }
+
 private:
-    int inputPortNumber(std::string name) const;
-    int outputPortNumber(std::string name) const;
-    void recievedMessage(const double& delay, std::vector<unsigned char>* message) const;
-    std::vector<std::string> getPortNames(RtMidi* rtMidi) const;
+    struct Input {
+        virtual ~Input() = default;
+
+        MidiManager* manager;
+        byte port;
+        std::string name;
+        std::unique_ptr<RtMidiIn> rtMidiIn;
+        // Used by the loopback port, which has no driver callback.
+        void (*deliver)(Input& input, uint64_t time, const unsigned char* message, size_t size) = nullptr;
+        MidiRecievedFunction midiRecievedFunction;
+        MidiEventFunction midiEventFunction;
+        MidiEventBatchFunction midiEventBatchFunction;
+
+        // Written by the input thread only.
+        std::vector<Event> batch;
+        uint64_t previousTime = 0;
+        uint64_t previousInterval = 0;
+        double jitter = 0.0;
+
+        std::atomic<uint64_t> eventCount{0};
+        std::atomic<uint64_t> lastTime{0};
+        std::atomic<uint64_t> publishedJitter{0};
+    };
+
+    template <typename Sink>
+    struct SinkInput : Input {
+        explicit SinkInput(Sink sink) : sink(std::move(sink)) {}
+
+        static void deliverToSink(Input& input, uint64_t time, const unsigned char* message, size_t size) {
+            auto& self = static_cast<SinkInput&>(input);
+            self.sink(self.manager->makeEvent(self, time, message, size));
+        }
+
+        static void callback(unsigned long long time, double, std::vector<unsigned char>* message, void* userData) {
+            deliverToSink(*static_cast<SinkInput*>(userData), time, message->data(), message->size());
+        }
+
+        static void batchCallback(const RtMidiIn::PackedMessage* messages, unsigned int count, void* userData) {
+            auto& self = *static_cast<SinkInput*>(userData);
+            for (unsigned int index = 0; index < count; ++index) {
+                deliverToSink(self, messages[index].time, messages[index].bytes, messages[index].size);
+            }
+        }
+
+        Sink sink;
+    };
+
+    bool openNamedPort(RtMidi& connection, RtMidi& lister, PortDirectory& directory, const std::string& name) const;
+    bool openInput(std::string name, byte port, MidiRecievedFunction recievedFunction, MidiEventFunction eventFunction, MidiEventBatchFunction batchFunction);
+    bool openInput(std::unique_ptr<Input> input, RtMidiIn::RtMidiBatchCallback batchCallback, RtMidiIn::RtMidiTimedCallback callback);
+    Event makeEvent(Input& input, uint64_t time, const unsigned char* message, size_t size) const;
+    void recievedMessage(Input& input, uint64_t time, const double& delay, const unsigned char* message, size_t size) const;
+    void recievedBatch(Input& input, const RtMidiIn::PackedMessage* messages, size_t count) const;
+    std::vector<std::string> getPortNames(RtMidi& rtMidi, PortDirectory& directory) const;
+    void send(const unsigned char* message, size_t size) const;
+    void flushLocked() const;
+
+    template <typename Result>
+    std::future<Result> post(std::function<Result ()> command);
+    void runCommands();
+    void stopCommands();
 
 private:
+    // Used to list ports; each open port has its own connection.
     std::unique_ptr<RtMidiIn> mRtMidiIn = nullptr;
     std::unique_ptr<RtMidiOut> mRtMidiOut = nullptr;
-    MidiRecievedFunction mMidiRecievedFunction;
+    std::unique_ptr<RtMidiOut> mOutput = nullptr;
+    // Guards the open connections, held only briefly so the caller and the
+    // control thread can swap connections in and out while the other sends.
+    mutable std::mutex mMutex;
+    mutable std::mutex mDirectoryMutex;
+    std::vector<std::unique_ptr<Input>> mInputs;
+    std::vector<std::string> mInputPortNames;
+    std::unordered_map<std::string, byte> mInputPortIds;
+    mutable PortDirectory mInputDirectory;
+    mutable PortDirectory mOutputDirectory;
+    bool mLoopbackOpen = false;
+    size_t mFlushThreshold = 256;
+    mutable size_t mQueuedCount = 0;
+    TrafficStats* mTrafficStats = nullptr;
+    SysExPool* mSysExPool = nullptr;
+
+    std::thread mControlThread;
+    std::mutex mCommandMutex;
+    std::condition_variable mCommandReady;
+    std::deque<std::function<void ()>> mCommands;
+    bool mStopping = false;
 
 private:
-    static void RtMidiCallback(double delay, std::vector<unsigned char>* message, void* userData) {
-        MidiManager* midiManager = static_cast<MidiManager*>(userData);
-        midiManager->recievedMessage(delay, message);
+    static void RtMidiCallback(unsigned long long time, double delay, std::vector<unsigned char>* message, void* userData) {
+        Input* input = static_cast<Input*>(userData);
+        input->manager->recievedMessage(*input, time, delay, message->data(), message->size());
+    }
+
+    static void RtMidiBatchCallback(const RtMidiIn::PackedMessage* messages, unsigned int count, void* userData) {
+        Input* input = static_cast<Input*>(userData);
+        input->manager->recievedBatch(*input, messages, count);
+    }
+
+    static void deliverToFunctions(Input& input, uint64_t time, const unsigned char* message, size_t size) {
+        input.manager->recievedMessage(input, time, 0.0, message, size);
     }
 };
 
+template <typename Sink>
+bool MidiManager::bindInputPort(std::string input, Sink sink) {
+    closeInputPort(input);
+    const auto port = inputPortId(input);
+    if (port == kNoPortId)
+        return false;
+    std::unique_ptr<SinkInput<Sink>> sinkInput(new SinkInput<Sink>(std::move(sink)));
+    sinkInput->deliver = &SinkInput<Sink>::deliverToSink;
+    sinkInput->port = (byte)port;
+    sinkInput->name = input;
+    return openInput(std::move(sinkInput), &SinkInput<Sink>::batchCallback, &SinkInput<Sink>::callback);
+}
+
+template <typename Result>
+std::future<Result> MidiManager::post(std::function<Result ()> command) {
+    auto task = std::make_shared<std::packaged_task<Result ()>>(command);
+    auto future = task->get_future();
+    {
+        std::lock_guard<std::mutex> lock(mCommandMutex);
+        if (!mControlThread.joinable())
+            mControlThread = std::thread(&MidiManager::runCommands, this);
+        mCommands.push_back([task]() { (*task)(); });
+    }
+    mCommandReady.notify_one();
+    return future;
+}
+
+inline Event MidiManager::makeEvent(Input& input, uint64_t time, const unsigned char* message, size_t size) const {
+    // APIs without driver timestamps report zero; stamp those on arrival.
+    if (time == 0)
+        time = monotonicNanoseconds();
+
+    if (input.previousTime != 0 && time >= input.previousTime) {
+        const auto interval = time - input.previousTime;
+        if (input.previousInterval != 0) {
+            const auto difference = (interval > input.previousInterval) ? interval - input.previousInterval : input.previousInterval - interval;
+            input.jitter += ((double)difference - input.jitter) / 16.0;
+            input.publishedJitter.store((uint64_t)input.jitter, std::memory_order_relaxed);
+        }
+        input.previousInterval = interval;
+    }
+    input.previousTime = time;
+    input.lastTime.store(time, std::memory_order_relaxed);
+    input.eventCount.store(input.eventCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    Event event;
+    if (message[0] == 0xF0 && mSysExPool) {
+        event = Event::makeSysEx(mSysExPool->store(message, size), time, input.port, Direction::Input);
+    } else {
+        const byte dataByte1 = (size > 1) ? message[1] : 0;
+        const byte dataByte2 = (size > 2) ? message[2] : 0;
+        event = {time, message[0], dataByte1, dataByte2, input.port, Direction::Input, {0, 0, 0}};
+    }
+    if (mTrafficStats)
+        mTrafficStats->record(event, size);
+    return event;
+}
+
 }
@@ -2,15 +2,53 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 namespace midi {
 
 typedef unsigned char byte;
 
+// Channel voice message names, indexed by the high nibble of the status byte.
+constexpr const char* kTypeNames[16] = {
+    "", "", "", "", "", "", "", "",
+    "Note Off",
+    "Note On",
+    "Polyphonic Aftertouch",
+    "Control Change",
+    "Program Change",
+    "Channel Aftertouch",
+    "Pitch Wheel",
+    ""
+};
+
+// System message names, indexed by the low nibble of the status byte.
+constexpr const char* kSystemTypeNames[16] = {
+    "SysEx",
+    "Quarter Frame",
+    "Song Position",
+    "Song Select",
+    "", "",
+    "Tune Request",
+    "End of SysEx",
+    "Clock",
+    "",
+    "Start",
+    "Continue",
+    "Stop",
+    "",
+    "Active Sensing",
+    "Reset"
+};
+
+constexpr const char* typeName(byte statusByte) {
+    return (statusByte & 0xF0) == 0xF0 ? kSystemTypeNames[statusByte & 0x0F] : kTypeNames[statusByte >> 4];
+}
+
 class ChannelMessage {
 public:
     enum class Type : byte {
@@ -31,24 +69,8 @@ public:
         return static_cast<Type>(mStatusByte & 0xF0);
     }
 
-    std::string typeString() const {
-        switch (type()) {
-            case Type::NoteOff:
-                return "Note Off";
-            case Type::NoteOn:
-                return "Note On";
-            case Type::PolyphonicAftertouch:
-                return "Polyphonic Aftertouch";
-            case Type::ControlChange:
-                return "Control Change";
-            case Type::ProgramChange:
-                return "Program Change";
-            case Type::ChannelAftertouch:
-                return "Channel Aftertouch";
-            case Type::PitchWheel:
-                return "Pitch Wheel";
-        }
-        return "";
+    const char* typeString() const {
+        return typeName(mStatusByte);
     }
 
     std::vector<unsigned char> message() const {
@@ -60,6 +82,12 @@ public:
         return message;
     }
 
+    // Length on the wire; program change and channel aftertouch carry a
+    // single data byte.
+    size_t size() const {
+        return (type() == Type::ProgramChange || type() == Type::ChannelAftertouch) ? 2 : 3;
+    }
+
     byte channel() const {
         return (mStatusByte & 0x0F) + 1;
     }
@@ -77,28 +105,197 @@ public:
     }
 
 protected:
-    const byte mStatusByte;
-    const byte mDataByte1;
-    const byte mDataByte2;
+    byte mStatusByte;
+    byte mDataByte1;
+    byte mDataByte2;
 };
 
+// Wire lengths, indexed by the high nibble of a channel status byte or the
+// low nibble of a system one. Zero marks SysEx and undefined statuses.
+constexpr byte kChannelSizes[16] = {0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 2, 2, 3, 0};
+constexpr byte kSystemSizes[16] = {0, 2, 3, 2, 0, 0, 1, 0, 1, 0, 1, 1, 1, 0, 1, 1};
+
+// Any MIDI 1.0 message other than SysEx, packed into one 32-bit word laid
+// out like a Universal MIDI Packet: message type and group in the top byte,
+// then status and the two data bytes. It is trivially copyable and four
+// bytes wide, so arrays, rings and columns of them can be scanned directly.
+class Message {
+public:
+    // The UMP message type nibble.
+    enum class Kind : byte {
+        Utility = 0x0,
+        System = 0x1,
+        ChannelVoice = 0x2
+    };
+
+    enum class SystemType : byte {
+        QuarterFrame = 0xF1,
+        SongPosition = 0xF2,
+        SongSelect = 0xF3,
+        TuneRequest = 0xF6,
+        Clock = 0xF8,
+        Start = 0xFA,
+        Continue = 0xFB,
+        Stop = 0xFC,
+        ActiveSensing = 0xFE,
+        Reset = 0xFF
+    };
+
+public:
+    Message() = default;
+
+    constexpr explicit Message(uint32_t word) :
+    mWord(word) {}
+
+    // Statuses below 0x80 pack as an empty utility word.
+    constexpr Message(byte statusByte, byte dataByte1, byte dataByte2, byte group = 0) :
+    mWord(statusByte < 0x80 ? 0 :
+          (uint32_t)(statusByte >= 0xF0 ? Kind::System : Kind::ChannelVoice) << 28 |
+          (uint32_t)(group & 0x0F) << 24 |
+          (uint32_t)statusByte << 16 |
+          (uint32_t)(dataByte1 & 0x7F) << 8 |
+          (uint32_t)(dataByte2 & 0x7F)) {}
+
+    Message(const ChannelMessage& channelMessage) :
+    Message(channelMessage.statusByte(), channelMessage.byte1(), channelMessage.byte2()) {}
+
+    static constexpr Message system(SystemType type, byte dataByte1 = 0, byte dataByte2 = 0) {
+        return Message((byte)type, dataByte1, dataByte2);
+    }
+
+    // Reads one message from the wire, or an empty one if the bytes do not
+    // hold a complete message.
+    static constexpr Message fromBytes(const byte* bytes, size_t size) {
+        return size == 0 || wireSize(bytes[0]) == 0 || size < wireSize(bytes[0]) ? Message(0u) :
+            Message(bytes[0], wireSize(bytes[0]) > 1 ? bytes[1] : 0, wireSize(bytes[0]) > 2 ? bytes[2] : 0);
+    }
+
+    static constexpr size_t wireSize(byte statusByte) {
+        return statusByte < 0x80 ? 0 :
+            statusByte >= 0xF0 ? kSystemSizes[statusByte & 0x0F] : kChannelSizes[statusByte >> 4];
+    }
+
+    constexpr uint32_t word() const {
+        return mWord;
+    }
+
+    constexpr Kind kind() const {
+        return static_cast<Kind>(mWord >> 28);
+    }
+
+    constexpr byte group() const {
+        return (mWord >> 24) & 0x0F;
+    }
+
+    constexpr byte statusByte() const {
+        return (mWord >> 16) & 0xFF;
+    }
+
+    constexpr byte byte1() const {
+        return (mWord >> 8) & 0x7F;
+    }
+
+    constexpr byte byte2() const {
+        return mWord & 0x7F;
+    }
+
+    constexpr size_t size() const {
+        return wireSize(statusByte());
+    }
+
+    constexpr bool empty() const {
+        return size() == 0;
+    }
+
+    constexpr bool isChannelVoice() const {
+        return kind() == Kind::ChannelVoice;
+    }
+
+    // Quarter frame, song position, song select and tune request.
+    constexpr bool isSystemCommon() const {
+        return kind() == Kind::System && statusByte() < 0xF8;
+    }
+
+    constexpr bool isRealtime() const {
+        return kind() == Kind::System && statusByte() >= 0xF8;
+    }
+
+    // 1-16, as ChannelMessage counts them. Zero for system messages.
+    constexpr byte channel() const {
+        return isChannelVoice() ? (statusByte() & 0x0F) + 1 : 0;
+    }
+
+    // Pitch wheel position or song position in sixteenths.
+    constexpr uint16_t value14() const {
+        return (uint16_t)(byte1() | byte2() << 7);
+    }
+
+    // MTC quarter frames carry a piece number (0-7) and a nibble of time.
+    constexpr byte quarterFramePiece() const {
+        return byte1() >> 4;
+    }
+
+    constexpr byte quarterFrameValue() const {
+        return byte1() & 0x0F;
+    }
+
+    constexpr const char* typeString() const {
+        return typeName(statusByte());
+    }
+
+    ChannelMessage channelMessage() const {
+        return {statusByte(), byte1(), byte2()};
+    }
+
+private:
+    uint32_t mWord;
+};
+
+static_assert(sizeof(Message) == 4, "Message must stay one 32-bit word");
+static_assert(std::is_trivially_copyable<Message>::value, "Message must be trivially copyable");
+static_assert(Message(0x90, 60, 100).size() == 3, "note on is three bytes");
+static_assert(Message::system(Message::SystemType::Clock).isRealtime(), "clock is realtime");
+
+// Read-only view of one complete SysEx message, F0 through F7. The bytes
+// belong to a SysExPool buffer, a capture file mapping or the caller, and
+// must outlive the view.
 class SysExMessage {
 public:
-    void addByte(const unsigned char& byte) {
-        mBytes.push_back(byte);
+    SysExMessage() = default;
+    SysExMessage(const byte* data, size_t size) :
+    mData(data), mSize(size) {}
+
+    const byte* data() const {
+        return mData;
+    }
+
+    size_t size() const {
+        return mSize;
+    }
+
+    bool empty() const {
+        return mSize == 0;
+    }
+
+    const byte* begin() const {
+        return mData;
+    }
+
+    const byte* end() const {
+        return mData + mSize;
+    }
+
+    byte operator[](size_t index) const {
+        return mData[index];
     }
 
     std::vector<unsigned char> message() const {
-        std::vector<unsigned char> message;
-        message.push_back(0xf0);
-        for (auto& byte : mBytes)
-            message.push_back(byte);
-        message.push_back(0xf7);
-        return message;
-    };
+        return std::vector<unsigned char>(begin(), end());
+    }
 
 private:
-    std::vector<unsigned char> mBytes;
+    const byte* mData = nullptr;
+    size_t mSize = 0;
 };
 
 using MidiRecievedFunction = std::function<void (const ChannelMessage& channelMessage, const double& delay)>;
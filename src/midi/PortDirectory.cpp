@@ -0,0 +1,49 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#include "PortDirectory.h"
+
+#include <cstdio>
+
+namespace midi {
+
+const std::vector<std::string>& PortDirectory::names(RtMidi& rtMidi) {
+    if (!mValid)
+        refresh(rtMidi);
+    return mNames;
+}
+
+int PortDirectory::portNumber(RtMidi& rtMidi, const std::string& name) {
+    if (!mValid)
+        refresh(rtMidi);
+    const auto found = mNumbers.find(name);
+    return found != mNumbers.end() ? found->second : kNoPort;
+}
+
+bool PortDirectory::address(const std::string& name, int& client, int& port) {
+    const auto space = name.rfind(' ');
+    if (space == std::string::npos)
+        return false;
+
+    char end = 0;
+    return std::sscanf(name.c_str() + space + 1, "%d:%d%c", &client, &port, &end) == 2;
+}
+
+bool PortDirectory::isOwnPort(const std::string& name) {
+    int client, port;
+    return address(name, client, port) && name.compare(0, name.rfind(' '), kConnectionClientName) == 0;
+}
+
+void PortDirectory::refresh(RtMidi& rtMidi) {
+    const auto names = rtMidi.getPortNames();
+    mNames.clear();
+    mNumbers.clear();
+    for (size_t number = 0; number < names.size(); ++number) {
+        if (isOwnPort(names[number]))
+            continue;
+        mNames.push_back(names[number]);
+        mNumbers.emplace(names[number], (int)number);
+    }
+    mValid = true;
+}
+
+}
@@ -0,0 +1,49 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#pragma once
+
+#include <RtMidi.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace midi {
+
+// Client name of the connections MidiManager opens. On ALSA each connection
+// is a sequencer client whose own port would otherwise be listed as a device.
+const char kConnectionClientName[] = "Beagle Connection";
+
+// Cached port list of one RtMidi direction, indexed by name. Filling it is
+// a single pass over the driver; lookups are hash probes. Call invalidate()
+// when ports come or go (see PortWatcher) and the next lookup re-enumerates.
+class PortDirectory {
+public:
+    static const int kNoPort = -1;
+
+    void invalidate() {
+        mValid = false;
+    }
+
+    const std::vector<std::string>& names(RtMidi& rtMidi);
+
+    // RtMidi port number, or kNoPort.
+    int portNumber(RtMidi& rtMidi, const std::string& name);
+
+    // The client:port address that ends ALSA port names, for
+    // RtMidi::openPortAt(). Other APIs' names have none.
+    static bool address(const std::string& name, int& client, int& port);
+
+    // True for the port of one of our own connections, which is not listed.
+    static bool isOwnPort(const std::string& name);
+
+private:
+    void refresh(RtMidi& rtMidi);
+
+private:
+    bool mValid = false;
+    std::vector<std::string> mNames;
+    std::unordered_map<std::string, int> mNumbers;
+};
+
+}
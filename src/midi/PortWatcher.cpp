@@ -0,0 +1,299 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#include "PortWatcher.h"
+
+#include "PortDirectory.h"
+
+#include <cerrno>
+#include <chrono>
+#include <map>
+#include <set>
+
+#if defined(__LINUX_ALSA__)
+#include <alsa/asoundlib.h>
+#include <poll.h>
+#endif
+
+namespace midi {
+
+#if defined(__LINUX_ALSA__)
+
+struct PortWatcher::Backend {
+    struct Port {
+        std::string name;
+        bool input;
+        bool output;
+    };
+
+    snd_seq_t* seq = nullptr;
+    int self = -1;
+    std::vector<pollfd> descriptors;
+    // Keyed by client << 8 | port.
+    std::map<int, Port> ports;
+
+    ~Backend() {
+        if (seq)
+            snd_seq_close(seq);
+    }
+
+    bool open() {
+        if (snd_seq_open(&seq, "default", SND_SEQ_OPEN_INPUT, SND_SEQ_NONBLOCK) < 0) {
+            seq = nullptr;
+            return false;
+        }
+        snd_seq_set_client_name(seq, "Beagle Port Watcher");
+        self = snd_seq_client_id(seq);
+
+        const auto port = snd_seq_create_simple_port(seq, "announce", SND_SEQ_PORT_CAP_WRITE | SND_SEQ_PORT_CAP_NO_EXPORT, SND_SEQ_PORT_TYPE_APPLICATION);
+        if (port < 0 || snd_seq_connect_from(seq, port, SND_SEQ_CLIENT_SYSTEM, SND_SEQ_PORT_SYSTEM_ANNOUNCE) < 0)
+            return false;
+
+        descriptors.resize(snd_seq_poll_descriptors_count(seq, POLLIN));
+        snd_seq_poll_descriptors(seq, descriptors.data(), descriptors.size(), POLLIN);
+
+        std::vector<PortChange> initial;
+        refresh(-1, initial);
+        return true;
+    }
+
+    void wait(std::vector<PortChange>& changes) {
+        if (poll(descriptors.data(), descriptors.size(), 100) <= 0)
+            return;
+
+        std::set<int> clients;
+        bool overrun = false;
+        snd_seq_event_t* event;
+        int result;
+        while ((result = snd_seq_event_input(seq, &event)) >= 0 || result == -ENOSPC) {
+            if (result == -ENOSPC) {
+                overrun = true;
+                continue;
+            }
+            switch (event->type) {
+                case SND_SEQ_EVENT_CLIENT_START:
+                case SND_SEQ_EVENT_CLIENT_EXIT:
+                case SND_SEQ_EVENT_CLIENT_CHANGE:
+                case SND_SEQ_EVENT_PORT_START:
+                case SND_SEQ_EVENT_PORT_EXIT:
+                case SND_SEQ_EVENT_PORT_CHANGE:
+                    clients.insert(event->data.addr.client);
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        // Announcements only name a client or port, so rescan what they
+        // name and report the difference. Lost announcements mean a full
+        // rescan.
+        if (overrun) {
+            refresh(-1, changes);
+        } else {
+            for (auto client : clients) {
+                refresh(client, changes);
+            }
+        }
+    }
+
+    // Rescans one client, or every client for -1, and reports the ports
+    // that came or went. A renamed port is reported as removed and added.
+    void refresh(int client, std::vector<PortChange>& changes) {
+        std::map<int, Port> current;
+        if (client >= 0) {
+            scanClient(client, current);
+        } else {
+            snd_seq_client_info_t* clientInfo;
+            snd_seq_client_info_alloca(&clientInfo);
+            snd_seq_client_info_set_client(clientInfo, -1);
+            while (snd_seq_query_next_client(seq, clientInfo) >= 0) {
+                scanClient(snd_seq_client_info_get_client(clientInfo), current);
+            }
+        }
+
+        auto first = client >= 0 ? ports.lower_bound(client << 8) : ports.begin();
+        auto last = client >= 0 ? ports.lower_bound((client + 1) << 8) : ports.end();
+        for (auto it = first; it != last; ++it) {
+            const auto found = current.find(it->first);
+            if (found == current.end() || !samePort(found->second, it->second))
+                report(PortChange::Kind::Removed, it->first, it->second, changes);
+        }
+        for (auto& entry : current) {
+            const auto found = ports.find(entry.first);
+            if (found == ports.end() || !samePort(found->second, entry.second))
+                report(PortChange::Kind::Added, entry.first, entry.second, changes);
+        }
+        ports.erase(first, last);
+        ports.insert(current.begin(), current.end());
+    }
+
+    // Applies the same filter and naming as RtMidi's ALSA backend, so the
+    // names match what MidiManager lists. Our own connections are skipped.
+    void scanClient(int client, std::map<int, Port>& current) {
+        if (client == 0 || client == self)
+            return;
+
+        snd_seq_client_info_t* clientInfo;
+        snd_seq_client_info_alloca(&clientInfo);
+        if (snd_seq_get_any_client_info(seq, client, clientInfo) < 0)
+            return;
+        const std::string clientName = snd_seq_client_info_get_name(clientInfo);
+        if (clientName == kConnectionClientName)
+            return;
+
+        snd_seq_port_info_t* portInfo;
+        snd_seq_port_info_alloca(&portInfo);
+        snd_seq_port_info_set_client(portInfo, client);
+        snd_seq_port_info_set_port(portInfo, -1);
+        while (snd_seq_query_next_port(seq, portInfo) >= 0) {
+            const auto type = snd_seq_port_info_get_type(portInfo);
+            if ((type & SND_SEQ_PORT_TYPE_MIDI_GENERIC) == 0 && (type & SND_SEQ_PORT_TYPE_SYNTH) == 0)
+                continue;
+
+            const auto caps = snd_seq_port_info_get_capability(portInfo);
+            const unsigned readable = SND_SEQ_PORT_CAP_READ | SND_SEQ_PORT_CAP_SUBS_READ;
+            const unsigned writable = SND_SEQ_PORT_CAP_WRITE | SND_SEQ_PORT_CAP_SUBS_WRITE;
+            Port port;
+            port.input = (caps & readable) == readable;
+            port.output = (caps & writable) == writable;
+            if (!port.input && !port.output)
+                continue;
+
+            const auto number = snd_seq_port_info_get_port(portInfo);
+            port.name = clientName + " " + std::to_string(client) + ":" + std::to_string(number);
+            current[client << 8 | number] = port;
+        }
+    }
+
+    static bool samePort(const Port& a, const Port& b) {
+        return a.name == b.name && a.input == b.input && a.output == b.output;
+    }
+
+    static void report(PortChange::Kind kind, int address, const Port& port, std::vector<PortChange>& changes) {
+        if (port.input)
+            changes.push_back({kind, Direction::Input, port.name, address >> 8, address & 0xFF});
+        if (port.output)
+            changes.push_back({kind, Direction::Output, port.name, address >> 8, address & 0xFF});
+    }
+};
+
+#else
+
+struct PortWatcher::Backend {
+    std::unique_ptr<RtMidiIn> rtMidiIn;
+    std::unique_ptr<RtMidiOut> rtMidiOut;
+    std::set<std::string> inputs;
+    std::set<std::string> outputs;
+    std::chrono::steady_clock::time_point nextPoll;
+
+    bool open() {
+        try {
+            rtMidiIn.reset(new RtMidiIn());
+            rtMidiOut.reset(new RtMidiOut());
+        } catch (RtMidiError&) {
+            return false;
+        }
+        inputs = portNames(rtMidiIn.get());
+        outputs = portNames(rtMidiOut.get());
+        nextPoll = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+        return true;
+    }
+
+    void wait(std::vector<PortChange>& changes) {
+        // Short sleeps keep stop() responsive.
+        if (std::chrono::steady_clock::now() < nextPoll) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            return;
+        }
+        nextPoll = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+
+        auto currentInputs = portNames(rtMidiIn.get());
+        auto currentOutputs = portNames(rtMidiOut.get());
+        report(inputs, currentInputs, Direction::Input, changes);
+        report(outputs, currentOutputs, Direction::Output, changes);
+        inputs.swap(currentInputs);
+        outputs.swap(currentOutputs);
+    }
+
+    static std::set<std::string> portNames(RtMidi* rtMidi) {
+        std::set<std::string> names;
+        const auto portCount = rtMidi->getPortCount();
+        for (unsigned int portNumber = 0; portNumber < portCount; ++portNumber) {
+            const auto name = rtMidi->getPortName(portNumber);
+            if (!PortDirectory::isOwnPort(name))
+                names.insert(name);
+        }
+        return names;
+    }
+
+    static void report(const std::set<std::string>& before, const std::set<std::string>& after, Direction direction, std::vector<PortChange>& changes) {
+        for (auto& name : before) {
+            if (!after.count(name))
+                changes.push_back({PortChange::Kind::Removed, direction, name, -1, -1});
+        }
+        for (auto& name : after) {
+            if (!before.count(name))
+                changes.push_back({PortChange::Kind::Added, direction, name, -1, -1});
+        }
+    }
+};
+
+#endif
+
+PortWatcher::PortWatcher() {
+}
+
+PortWatcher::~PortWatcher() {
+    stop();
+}
+
+bool PortWatcher::start(std::function<void()> notify) {
+    if (mRunning)
+        return true;
+
+    mBackend.reset(new Backend());
+    if (!mBackend->open()) {
+        mBackend.reset();
+        return false;
+    }
+
+    mNotify = notify;
+    mRunning = true;
+    mThread = std::thread(&PortWatcher::run, this);
+    return true;
+}
+
+void PortWatcher::stop() {
+    if (!mRunning)
+        return;
+
+    mRunning = false;
+    mThread.join();
+    mBackend.reset();
+}
+
+void PortWatcher::takeChanges(std::vector<PortChange>& changes) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    changes.insert(changes.end(), mPending.begin(), mPending.end());
+    mPending.clear();
+}
+
+void PortWatcher::run() {
+    std::vector<PortChange> changes;
+    while (mRunning) {
+        mBackend->wait(changes);
+        if (!changes.empty())
+            publish(changes);
+    }
+}
+
+void PortWatcher::publish(std::vector<PortChange>& changes) {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mPending.insert(mPending.end(), changes.begin(), changes.end());
+    }
+    changes.clear();
+    if (mNotify)
+        mNotify();
+}
+
+}
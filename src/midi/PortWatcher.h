@@ -0,0 +1,68 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#pragma once
+
+#include "Event.h"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace midi {
+
+struct PortChange {
+    enum class Kind : byte {
+        Added,
+        Removed
+    };
+
+    Kind kind;
+    Direction direction;
+    // Matches the names MidiManager lists, so ids from inputPortId() stay
+    // stable across a port going away and coming back.
+    std::string name;
+    // ALSA sequencer address, or -1 where the API has none.
+    int client;
+    int port;
+};
+
+// Watches for MIDI ports appearing and disappearing on a background thread.
+// On ALSA it subscribes to the sequencer's announce port; elsewhere it polls
+// the port lists once a second. Changes are queued for the UI thread, which
+// collects them with takeChanges() and applies them without touching open
+// connections.
+class PortWatcher {
+public:
+    PortWatcher();
+    ~PortWatcher();
+
+    PortWatcher(const PortWatcher&) = delete;
+    PortWatcher& operator=(const PortWatcher&) = delete;
+
+    // Ports present at start are not reported. notify is called from the
+    // watcher thread after each batch of changes is queued.
+    bool start(std::function<void()> notify);
+    void stop();
+
+    void takeChanges(std::vector<PortChange>& changes);
+
+private:
+    struct Backend;
+
+    void run();
+    void publish(std::vector<PortChange>& changes);
+
+private:
+    std::unique_ptr<Backend> mBackend;
+    std::thread mThread;
+    std::atomic<bool> mRunning{false};
+    std::function<void()> mNotify;
+    std::mutex mMutex;
+    std::vector<PortChange> mPending;
+};
+
+}
@@ -0,0 +1,159 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#include "Replayer.h"
+
+#include <algorithm>
+#include <chrono>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <cerrno>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#endif
+
+namespace midi {
+
+namespace {
+
+// Sleep until shortly before the deadline, then spin the rest of the way.
+const uint64_t kSpinWindow = 200000;
+
+void raiseThreadPriority() {
+#ifdef _WIN32
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL);
+#else
+    sched_param param;
+    param.sched_priority = sched_get_priority_max(SCHED_FIFO);
+    pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+#endif
+}
+
+// Long sleeps are cut into slices so that a stop request is seen promptly.
+const uint64_t kSleepSlice = 50000000;
+
+// Returns false if stop was requested before the deadline.
+bool sleepUntil(uint64_t deadline, const std::atomic<bool>& stopRequested) {
+    while (deadline > kSpinWindow) {
+        if (stopRequested.load(std::memory_order_relaxed))
+            return false;
+        const auto now = monotonicNanoseconds();
+        const auto wake = deadline - kSpinWindow;
+        if (now >= wake)
+            break;
+        const auto sliceEnd = std::min(wake, now + kSleepSlice);
+#ifdef __linux__
+        timespec time;
+        time.tv_sec = sliceEnd / 1000000000;
+        time.tv_nsec = sliceEnd % 1000000000;
+        // Any error other than an interruption is treated as the slice ending.
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &time, nullptr) == EINTR) {
+        }
+#else
+        std::this_thread::sleep_until(std::chrono::steady_clock::time_point(std::chrono::nanoseconds(sliceEnd)));
+#endif
+    }
+
+    while (monotonicNanoseconds() < deadline) {
+    }
+    return !stopRequested.load(std::memory_order_relaxed);
+}
+
+}
+
+Replayer::Replayer(const CaptureReader& reader, const MidiManager& manager) :
+mReader(reader),
+mManager(manager) {
+}
+
+Replayer::~Replayer() {
+    stop();
+}
+
+bool Replayer::start(const ReplayOptions& options) {
+    stop();
+    if (!mReader.isOpen() || options.firstRecord >= mReader.size())
+        return false;
+
+    mStats = ReplayStats();
+    mStopRequested = false;
+    mRunning = true;
+    mThread = std::thread(&Replayer::run, this, options);
+    return true;
+}
+
+void Replayer::stop() {
+    mStopRequested = true;
+    wait();
+}
+
+void Replayer::wait() {
+    if (mThread.joinable())
+        mThread.join();
+}
+
+void Replayer::run(ReplayOptions options) {
+    raiseThreadPriority();
+
+    const auto speed = options.speed > 0.0 ? std::min(std::max(options.speed, 0.25), 100.0) : 0.0;
+    const auto first = options.firstRecord;
+    const auto last = std::min(options.lastRecord, mReader.size() - 1);
+    const auto recordedStart = mReader[first].time;
+    const auto start = monotonicNanoseconds();
+
+    double errorSum = 0.0;
+    for (auto record = first; record <= last && !mStopRequested.load(std::memory_order_relaxed); ++record) {
+        const auto& event = mReader[record];
+
+        uint64_t deadline = 0;
+        if (speed > 0.0) {
+            const auto offset = event.time > recordedStart ? event.time - recordedStart : 0;
+            deadline = start + (uint64_t)(offset / speed);
+            if (!sleepUntil(deadline, mStopRequested))
+                break;
+        }
+
+        const auto now = monotonicNanoseconds();
+        if (mReader.isSysEx(record))
+            mManager.sendMessage(mReader.sysEx(record));
+        else
+            mManager.sendMessage(event.packet());
+
+        if (speed > 0.0) {
+            const auto error = (int64_t)(now - deadline);
+            recordError(error);
+            errorSum += error;
+        }
+        ++mStats.sent;
+        mPosition.store(record, std::memory_order_relaxed);
+    }
+
+    if (speed > 0.0 && mStats.sent > 0)
+        mStats.meanError = errorSum / mStats.sent;
+    mRunning.store(false, std::memory_order_release);
+}
+
+void Replayer::recordError(int64_t error) {
+    if (mStats.sent == 0) {
+        mStats.minError = error;
+        mStats.maxError = error;
+    } else {
+        mStats.minError = std::min(mStats.minError, error);
+        mStats.maxError = std::max(mStats.maxError, error);
+    }
+
+    if (error < 0) {
+        ++mStats.early;
+        return;
+    }
+
+    size_t bucket = 0;
+    for (auto micros = error / 1000; micros > 0 && bucket + 1 < ReplayStats::kBucketCount; micros >>= 1) {
+        ++bucket;
+    }
+    ++mStats.histogram[bucket];
+}
+
+}
@@ -0,0 +1,77 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#pragma once
+
+#include "CaptureReader.h"
+#include "MidiManager.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+namespace midi {
+
+struct ReplayOptions {
+    // Playback rate relative to the recording, clamped to [0.25, 100].
+    // Zero sends every event as fast as the port accepts it.
+    double speed = 1.0;
+    uint64_t firstRecord = 0;
+    uint64_t lastRecord = UINT64_MAX;
+};
+
+// Achieved-minus-scheduled send time. Bucket i counts late errors below
+// 2^i microseconds; the last bucket also holds everything slower.
+struct ReplayStats {
+    static const size_t kBucketCount = 21;
+
+    uint64_t sent = 0;
+    uint64_t early = 0;
+    int64_t minError = 0;
+    int64_t maxError = 0;
+    double meanError = 0.0;
+    std::array<uint64_t, kBucketCount> histogram{};
+};
+
+// Replays a capture to the open output port of a MidiManager from a
+// dedicated high-priority thread that waits on absolute deadlines.
+class Replayer {
+public:
+    Replayer(const CaptureReader& reader, const MidiManager& manager);
+    ~Replayer();
+
+    Replayer(const Replayer&) = delete;
+    Replayer& operator=(const Replayer&) = delete;
+
+    bool start(const ReplayOptions& options);
+    void stop();
+    void wait();
+
+    bool isRunning() const {
+        return mRunning.load(std::memory_order_acquire);
+    }
+
+    uint64_t position() const {
+        return mPosition.load(std::memory_order_relaxed);
+    }
+
+    // Only consistent once the replay has finished.
+    const ReplayStats& stats() const {
+        return mStats;
+    }
+
+private:
+    void run(ReplayOptions options);
+    void recordError(int64_t error);
+
+private:
+    const CaptureReader& mReader;
+    const MidiManager& mManager;
+    std::thread mThread;
+    std::atomic<bool> mRunning{false};
+    std::atomic<bool> mStopRequested{false};
+    std::atomic<uint64_t> mPosition{0};
+    ReplayStats mStats;
+};
+
+}
@@ -0,0 +1,140 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace midi {
+
+// Wait-free single-producer/single-consumer ring buffer.
+// The producer never blocks: when the ring is full the value is dropped and
+// counted, so callers can surface overflowCount() instead of losing it silently.
+template <typename T, size_t Capacity>
+class SpscRing {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    SpscRing() = default;
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    // Rings are large, so they live on the heap, and before C++17 a plain new
+    // only guarantees alignment to max_align_t.
+    static void* operator new(size_t size) {
+#ifdef _WIN32
+        void* memory = _aligned_malloc(size, kCacheLine);
+#else
+        void* memory = nullptr;
+        if (posix_memalign(&memory, kCacheLine, size) != 0)
+            memory = nullptr;
+#endif
+        if (!memory)
+            throw std::bad_alloc();
+        return memory;
+    }
+
+    static void operator delete(void* memory) {
+#ifdef _WIN32
+        _aligned_free(memory);
+#else
+        std::free(memory);
+#endif
+    }
+
+    // Producer side.
+    bool push(const T& value) {
+        const auto head = mHead.load(std::memory_order_relaxed);
+        if (head - mCachedTail == Capacity) {
+            mCachedTail = mTail.load(std::memory_order_acquire);
+            if (head - mCachedTail == Capacity) {
+                mOverflowCount.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        }
+        mBuffer[head & kMask] = value;
+        mHead.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Producer side. Publishes all values or, if they do not fit, none.
+    bool push(const T* values, size_t count) {
+        const auto head = mHead.load(std::memory_order_relaxed);
+        if (Capacity - (head - mCachedTail) < count) {
+            mCachedTail = mTail.load(std::memory_order_acquire);
+            if (Capacity - (head - mCachedTail) < count) {
+                mOverflowCount.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        }
+        for (size_t i = 0; i < count; ++i) {
+            mBuffer[(head + i) & kMask] = values[i];
+        }
+        mHead.store(head + count, std::memory_order_release);
+        return true;
+    }
+
+    // Producer side. Space that is guaranteed to be free for the next push.
+    size_t available() const {
+        return Capacity - (mHead.load(std::memory_order_relaxed) - mTail.load(std::memory_order_acquire));
+    }
+
+    // Consumer side. Copies out up to count values.
+    size_t pop(T* values, size_t count) {
+        const auto tail = mTail.load(std::memory_order_relaxed);
+        const auto head = mHead.load(std::memory_order_acquire);
+        if (count > head - tail)
+            count = head - tail;
+        for (size_t i = 0; i < count; ++i) {
+            values[i] = mBuffer[(tail + i) & kMask];
+        }
+        mTail.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    // Consumer side. Calls f for every value published so far and releases
+    // the whole batch to the producer at once.
+    template <typename F>
+    size_t drain(F&& f) {
+        const auto tail = mTail.load(std::memory_order_relaxed);
+        const auto head = mHead.load(std::memory_order_acquire);
+        for (auto index = tail; index != head; ++index) {
+            f(mBuffer[index & kMask]);
+        }
+        mTail.store(head, std::memory_order_release);
+        return head - tail;
+    }
+
+    size_t size() const {
+        return mHead.load(std::memory_order_acquire) - mTail.load(std::memory_order_acquire);
+    }
+
+    static constexpr size_t capacity() {
+        return Capacity;
+    }
+
+    uint64_t overflowCount() const {
+        return mOverflowCount.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr size_t kMask = Capacity - 1;
+    static constexpr size_t kCacheLine = 64;
+
+    // Producer and consumer state sit on separate cache lines.
+    alignas(kCacheLine) std::atomic<size_t> mHead{0};
+    size_t mCachedTail = 0;
+    alignas(kCacheLine) std::atomic<size_t> mTail{0};
+    alignas(kCacheLine) std::atomic<uint64_t> mOverflowCount{0};
+    alignas(kCacheLine) std::array<T, Capacity> mBuffer;
+};
+
+}
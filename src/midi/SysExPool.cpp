@@ -0,0 +1,68 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#include "SysExPool.h"
+
+#include <cstring>
+
+namespace midi {
+
+SysExPool::SysExPool() :
+mChunks(new std::unique_ptr<Slot[]>[kMaxChunks]) {
+}
+
+SysExPool::~SysExPool() {
+}
+
+uint32_t SysExPool::store(const byte* data, size_t size) {
+    size_t sizeClass = 0;
+    while (sizeClass < kClassCount && classSize(sizeClass) < size) {
+        ++sizeClass;
+    }
+    if (sizeClass == kClassCount)
+        return kNoPayload;
+
+    uint32_t id;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto& free = mFree[sizeClass];
+        if (!free.empty()) {
+            id = free.back();
+            free.pop_back();
+        } else {
+            if (mSlotCount == kMaxChunks * kChunkSlots)
+                return kNoPayload;
+            id = mSlotCount++;
+            auto& chunk = mChunks[id / kChunkSlots];
+            if (!chunk)
+                chunk.reset(new Slot[kChunkSlots]);
+            auto& slot = chunk[id % kChunkSlots];
+            slot.data.reset(new byte[classSize(sizeClass)]);
+            slot.sizeClass = (byte)sizeClass;
+        }
+        mBytesInUse += size;
+    }
+
+    // The slot is ours until released, so the copy needs no lock.
+    auto& slot = mChunks[id / kChunkSlots][id % kChunkSlots];
+    std::memcpy(slot.data.get(), data, size);
+    slot.size = (uint32_t)size;
+    return id;
+}
+
+void SysExPool::release(uint32_t id) {
+    if (id == kNoPayload)
+        return;
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto& slot = mChunks[id / kChunkSlots][id % kChunkSlots];
+    mBytesInUse -= slot.size;
+    slot.size = 0;
+    mFree[slot.sizeClass].push_back(id);
+}
+
+size_t SysExPool::bytesInUse() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mBytesInUse;
+}
+
+}
@@ -0,0 +1,71 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#pragma once
+
+#include "MidiTypes.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace midi {
+
+// Pooled storage for SysEx payloads. Buffers come in power-of-four size
+// classes from 64 bytes to 16 MB and go back on a per-class free list when
+// released, so steady-state traffic allocates nothing. Payloads are named by
+// a 32-bit id that fits in an Event (see Event::makeSysEx).
+class SysExPool {
+public:
+    static const uint32_t kNoPayload = UINT32_MAX;
+    // Size of the largest class, and so of the largest payload.
+    static const size_t kMaxPayloadSize = (size_t)64 << (2 * 9);
+
+    SysExPool();
+    ~SysExPool();
+
+    SysExPool(const SysExPool&) = delete;
+    SysExPool& operator=(const SysExPool&) = delete;
+
+    // Copies the message into a pooled buffer. Returns kNoPayload if it is
+    // larger than the largest size class or the pool is out of ids.
+    uint32_t store(const byte* data, size_t size);
+    void release(uint32_t id);
+
+    // Valid until the id is released. Any thread that received the id may
+    // read it.
+    SysExMessage message(uint32_t id) const {
+        if (id == kNoPayload)
+            return SysExMessage();
+        const auto& slot = mChunks[id / kChunkSlots][id % kChunkSlots];
+        return SysExMessage(slot.data.get(), slot.size);
+    }
+
+    size_t bytesInUse() const;
+
+private:
+    static const size_t kClassCount = 10;
+    static_assert(kMaxPayloadSize == (size_t)64 << (2 * (kClassCount - 1)), "kMaxPayloadSize is the largest class");
+    static const size_t kChunkSlots = 1024;
+    static const size_t kMaxChunks = 4096;
+
+    struct Slot {
+        std::unique_ptr<byte[]> data;
+        uint32_t size = 0;
+        byte sizeClass = 0;
+    };
+
+    static size_t classSize(size_t sizeClass) {
+        return (size_t)64 << (2 * sizeClass);
+    }
+
+private:
+    mutable std::mutex mMutex;
+    std::unique_ptr<std::unique_ptr<Slot[]>[]> mChunks;
+    uint32_t mSlotCount = 0;
+    std::vector<uint32_t> mFree[kClassCount];
+    size_t mBytesInUse = 0;
+};
+
+}
@@ -0,0 +1,129 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#include "TrafficStats.h"
+
+#include <algorithm>
+
+namespace midi {
+
+namespace {
+
+const size_t kWindowSlices[PortTraffic::kWindowCount] = {100, 1000, 6000};
+
+}
+
+TrafficStats::TrafficStats() :
+mPrevious(new Previous[256]) {
+    for (auto& port : mPorts) {
+        port.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+TrafficStats::~TrafficStats() {
+    for (auto& port : mPorts) {
+        delete port.load(std::memory_order_relaxed);
+    }
+}
+
+void TrafficStats::addPort(byte port) {
+    if (!mPorts[port].load(std::memory_order_relaxed))
+        mPorts[port].store(new PortCounters(), std::memory_order_release);
+}
+
+void TrafficStats::PortCounters::record(const Event& event, size_t size) {
+    const auto type = (event.status >> 4) & 0x07;
+    const auto channel = event.status & 0x0F;
+
+    messageCount.add(1);
+    byteCount.add(size);
+    counts[channel][type].add(1);
+    if (type == 1 && event.data2 > 0)
+        velocities[event.data2 & 0x7F].add(1);
+    else if (type == 3)
+        controllers[channel][event.data1 & 0x7F].add(1);
+
+    const auto index = event.time / kSliceDuration;
+    auto& slice = slices[index % kSliceCount];
+    if (slice.index.load(std::memory_order_relaxed) != index) {
+        slice.messageCount.store(1, std::memory_order_relaxed);
+        slice.byteCount.store((uint32_t)size, std::memory_order_relaxed);
+        slice.index.store(index, std::memory_order_release);
+    } else {
+        slice.messageCount.store(slice.messageCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        slice.byteCount.store(slice.byteCount.load(std::memory_order_relaxed) + (uint32_t)size, std::memory_order_relaxed);
+    }
+}
+
+void TrafficStats::snapshot(byte port, uint64_t now, PortTraffic& traffic) {
+    const auto counters = mPorts[port].load(std::memory_order_acquire);
+    traffic = PortTraffic();
+    if (!counters)
+        return;
+
+    traffic.active = true;
+    traffic.messageCount = counters->messageCount.load();
+    traffic.byteCount = counters->byteCount.load();
+    for (size_t channel = 0; channel < 16; ++channel) {
+        for (size_t type = 0; type < 8; ++type) {
+            traffic.counts[channel][type] = counters->counts[channel][type].load();
+        }
+        for (size_t controller = 0; controller < 128; ++controller) {
+            traffic.controllers[channel][controller] = counters->controllers[channel][controller].load();
+        }
+    }
+    for (size_t velocity = 0; velocity < 128; ++velocity) {
+        traffic.velocities[velocity] = counters->velocities[velocity].load();
+    }
+
+    const auto current = now / kSliceDuration;
+    uint64_t messages[PortTraffic::kWindowCount] = {};
+    uint64_t bytes[PortTraffic::kWindowCount] = {};
+    uint32_t peaks[PortTraffic::kWindowCount] = {};
+    for (auto& slice : counters->slices) {
+        const auto index = slice.index.load(std::memory_order_acquire);
+        if (index > current || current - index >= kSliceCount)
+            continue;
+
+        const auto age = current - index;
+        const auto sliceMessages = slice.messageCount.load(std::memory_order_relaxed);
+        const auto sliceBytes = slice.byteCount.load(std::memory_order_relaxed);
+        for (size_t window = 0; window < PortTraffic::kWindowCount; ++window) {
+            if (age < kWindowSlices[window]) {
+                messages[window] += sliceMessages;
+                bytes[window] += sliceBytes;
+                peaks[window] = std::max(peaks[window], sliceMessages);
+            }
+        }
+    }
+    for (size_t window = 0; window < PortTraffic::kWindowCount; ++window) {
+        const double seconds = kWindowSlices[window] * kSliceDuration * 1e-9;
+        traffic.windows[window].messagesPerSecond = messages[window] / seconds;
+        traffic.windows[window].bytesPerSecond = bytes[window] / seconds;
+        traffic.windows[window].peakMessagesPerSecond = peaks[window] / (kSliceDuration * 1e-9);
+    }
+
+    auto& previous = mPrevious[port];
+    std::array<uint64_t, 16> channelCounts{};
+    std::array<uint64_t, 8> typeCounts{};
+    for (size_t channel = 0; channel < 16; ++channel) {
+        for (size_t type = 0; type < 8; ++type) {
+            if (type < 7)
+                channelCounts[channel] += traffic.counts[channel][type];
+            typeCounts[type] += traffic.counts[channel][type];
+        }
+    }
+    if (previous.time != 0 && now > previous.time) {
+        const double seconds = (now - previous.time) * 1e-9;
+        for (size_t channel = 0; channel < 16; ++channel) {
+            traffic.channelRates[channel] = (channelCounts[channel] - previous.channelCounts[channel]) / seconds;
+        }
+        for (size_t type = 0; type < 8; ++type) {
+            traffic.typeRates[type] = (typeCounts[type] - previous.typeCounts[type]) / seconds;
+        }
+    }
+    previous.time = now;
+    previous.channelCounts = channelCounts;
+    previous.typeCounts = typeCounts;
+}
+
+}
@@ -0,0 +1,107 @@
+//  Copyright (c) 2015 hoseking. All rights reserved.
+
+#pragma once
+
+#include "Event.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace midi {
+
+// Rates over one sliding window. The peak is the busiest 10 ms slice in the
+// window, scaled to messages per second.
+struct TrafficWindow {
+    double messagesPerSecond = 0.0;
+    double bytesPerSecond = 0.0;
+    double peakMessagesPerSecond = 0.0;
+};
+
+struct PortTraffic {
+    static const size_t kWindowCount = 3;
+
+    bool active = false;
+    uint64_t messageCount = 0;
+    uint64_t byteCount = 0;
+    // Over the last 1, 10 and 60 seconds.
+    std::array<TrafficWindow, kWindowCount> windows;
+    // Since the previous snapshot. Types are indexed by (status >> 4) - 8,
+    // so the last one counts system messages.
+    std::array<double, 16> channelRates{};
+    std::array<double, 8> typeRates{};
+    // Indexed by the low and high nibble of the status byte.
+    std::array<std::array<uint64_t, 8>, 16> counts{};
+    std::array<uint64_t, 128> velocities{};
+    std::array<std::array<uint64_t, 128>, 16> controllers{};
+};
+
+// Traffic counters updated on the ingest path. Each port's counters have a
+// single writer, its input thread, so recording is a handful of relaxed
+// loads and stores with no read-modify-write. Readers only take snapshots.
+class TrafficStats {
+public:
+    TrafficStats();
+    ~TrafficStats();
+
+    TrafficStats(const TrafficStats&) = delete;
+    TrafficStats& operator=(const TrafficStats&) = delete;
+
+    // Allocates the port's counters. Call before the port delivers events.
+    void addPort(byte port);
+
+    void record(const Event& event, size_t size) {
+        auto counters = mPorts[event.port].load(std::memory_order_acquire);
+        if (counters)
+            counters->record(event, size);
+    }
+
+    // Rates are measured against the previous snapshot of the same port, so
+    // keep to one reader.
+    void snapshot(byte port, uint64_t now, PortTraffic& traffic);
+
+private:
+    static const uint64_t kSliceDuration = 10000000;
+    static const size_t kSliceCount = 6000;
+
+    struct Counter {
+        std::atomic<uint64_t> value{0};
+
+        void add(uint64_t amount) {
+            value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+        }
+        uint64_t load() const {
+            return value.load(std::memory_order_relaxed);
+        }
+    };
+
+    struct Slice {
+        std::atomic<uint64_t> index{UINT64_MAX};
+        std::atomic<uint32_t> messageCount{0};
+        std::atomic<uint32_t> byteCount{0};
+    };
+
+    struct PortCounters {
+        Counter messageCount;
+        Counter byteCount;
+        Counter counts[16][8];
+        Counter velocities[128];
+        Counter controllers[16][128];
+        Slice slices[kSliceCount];
+
+        void record(const Event& event, size_t size);
+    };
+
+    struct Previous {
+        uint64_t time = 0;
+        std::array<uint64_t, 16> channelCounts{};
+        std::array<uint64_t, 8> typeCounts{};
+    };
+
+    std::atomic<PortCounters*> mPorts[256];
+    std::unique_ptr<Previous[]> mPrevious;
+};
+
+}
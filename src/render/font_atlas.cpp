@@ -0,0 +1,57 @@
+#include "font_atlas.h"
+
+#include <imgui.h>
+#include <new>
+#include <string.h>
+
+// Generated by beagle-font-baker
+#include "font_atlas_data.h"
+
+bool LoadBakedFont(ImFontAtlas* atlas)
+{
+    if (!atlas->Fonts.empty() || atlas->TexPixelsAlpha8)
+        return false;
+
+    const int pixel_count = baked_atlas_width * baked_atlas_height;
+    unsigned char* pixels = (unsigned char*)ImGui::MemAlloc((size_t)pixel_count);
+    int pixel = 0;
+    for (size_t i = 0; i < sizeof(baked_atlas_pixels) && pixel < pixel_count; i++)
+    {
+        if (baked_atlas_pixels[i] != 0)
+        {
+            pixels[pixel++] = baked_atlas_pixels[i];
+            continue;
+        }
+        int run = (i + 1 < sizeof(baked_atlas_pixels)) ? baked_atlas_pixels[++i] + 1 : 1;
+        if (run > pixel_count - pixel)
+            run = pixel_count - pixel;
+        memset(pixels + pixel, 0, (size_t)run);
+        pixel += run;
+    }
+    memset(pixels + pixel, 0, (size_t)(pixel_count - pixel));
+
+    atlas->TexPixelsAlpha8 = pixels;
+    atlas->TexWidth = baked_atlas_width;
+    atlas->TexHeight = baked_atlas_height;
+    atlas->TexUvWhitePixel = ImVec2(baked_white_pixel_u, baked_white_pixel_v);
+
+    // The atlas frees fonts with ~ImFont() and MemFree()
+    ImFont* font = new (ImGui::MemAlloc(sizeof(ImFont))) ImFont();
+    font->ContainerAtlas = atlas;
+    font->FontSize = baked_font_size;
+    font->Ascent = baked_font_ascent;
+    font->Descent = baked_font_descent;
+    font->Glyphs.resize(sizeof(baked_glyphs) / sizeof(baked_glyphs[0]));
+    for (int i = 0; i < font->Glyphs.Size; i++)
+    {
+        const BakedGlyph& src = baked_glyphs[i];
+        ImFont::Glyph& glyph = font->Glyphs[i];
+        glyph.Codepoint = src.codepoint;
+        glyph.XAdvance = src.x_advance;
+        glyph.X0 = src.x0; glyph.Y0 = src.y0; glyph.X1 = src.x1; glyph.Y1 = src.y1;
+        glyph.U0 = src.u0; glyph.V0 = src.v0; glyph.U1 = src.u1; glyph.V1 = src.v1;
+    }
+    font->BuildLookupTable();
+    atlas->Fonts.push_back(font);
+    return true;
+}
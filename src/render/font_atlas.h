@@ -0,0 +1,23 @@
+// Font atlas baked at build time by beagle-font-baker (src/fontbaker), so startup doesn't decompress or rasterize a TTF.
+// The atlas is an alpha texture, run-length encoded: a nonzero byte is one pixel, a zero byte is followed by a count
+// byte and stands for count + 1 transparent pixels.
+
+#pragma once
+
+struct ImFontAtlas;
+
+// The font and size the GUI draws with; the baker rasterizes exactly this.
+#define BAKED_FONT_NAME     "DroidSans.ttf"
+#define BAKED_FONT_SIZE     16.0f
+
+struct BakedGlyph
+{
+    unsigned short  codepoint;
+    float           x_advance;
+    float           x0, y0, x1, y1;
+    float           u0, v0, u1, v1;
+};
+
+// Adds the baked font to an empty atlas and fills in its texture data, so that GetTexDataAsAlpha8() doesn't build.
+// ImGui's software mouse cursors are not set up, so leave io.MouseDrawCursor off.
+bool LoadBakedFont(ImFontAtlas* atlas);
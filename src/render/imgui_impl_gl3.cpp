@@ -0,0 +1,310 @@
+// ImGui renderer for OpenGL 3.2 core profile
+// All command lists are copied into one vertex and one index buffer per frame, and commands that share a
+// texture and clip rectangle are drawn together, so a frame is one upload and a handful of draws.
+
+#include <imgui.h>
+#include "imgui_impl_gl3.h"
+
+// glad must come before GLFW so that GLFW doesn't include the system GL header
+#include <glad/glad.h>
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#include <stdio.h>
+#include <string.h>
+
+// Data
+static GLuint       g_ShaderHandle = 0, g_VertHandle = 0, g_FragHandle = 0;
+static GLint        g_UniformLocationTex = 0, g_UniformLocationProjMtx = 0;
+static GLuint       g_VboHandle = 0, g_VaoHandle = 0, g_ElementsHandle = 0;
+static GLsizeiptr   g_VboSize = 0, g_ElementsSize = 0;
+static int          g_DrawCallCount = 0;
+
+static const GLchar* g_VertexShader =
+    "#version 150\n"
+    "uniform mat4 ProjMtx;\n"
+    "in vec2 Position;\n"
+    "in vec2 UV;\n"
+    "in vec4 Color;\n"
+    "out vec2 Frag_UV;\n"
+    "out vec4 Frag_Color;\n"
+    "void main()\n"
+    "{\n"
+    "    Frag_UV = UV;\n"
+    "    Frag_Color = Color;\n"
+    "    gl_Position = ProjMtx * vec4(Position.xy, 0, 1);\n"
+    "}\n";
+
+// The font atlas is a single red channel holding coverage
+static const GLchar* g_FragmentShader =
+    "#version 150\n"
+    "uniform sampler2D Texture;\n"
+    "in vec2 Frag_UV;\n"
+    "in vec4 Frag_Color;\n"
+    "out vec4 Out_Color;\n"
+    "void main()\n"
+    "{\n"
+    "    Out_Color = vec4(Frag_Color.rgb, Frag_Color.a * texture(Texture, Frag_UV.st).r);\n"
+    "}\n";
+
+// Grows a buffer to fit size bytes and maps it for writing. Mapping with GL_MAP_INVALIDATE_BUFFER_BIT orphans
+// the previous contents, so the driver hands back fresh storage instead of waiting on last frame's draws.
+static void* ImGui_ImplGL3_MapBuffer(GLenum target, GLuint buffer, GLsizeiptr* capacity, GLsizeiptr size)
+{
+    glBindBuffer(target, buffer);
+    if (size > *capacity)
+    {
+        *capacity = size + size / 2;
+        glBufferData(target, *capacity, NULL, GL_STREAM_DRAW);
+    }
+    return glMapBufferRange(target, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+}
+
+void ImGui_ImplGL3_RenderDrawLists(ImDrawData* draw_data)
+{
+    g_DrawCallCount = 0;
+    if (draw_data->TotalIdxCount == 0)
+        return;
+
+    // Upload everything at once. Indices are widened to 32 bits and rebased onto the shared vertex buffer, so
+    // commands from different lists can be merged into one draw.
+    const GLsizeiptr vtx_size = (GLsizeiptr)draw_data->TotalVtxCount * sizeof(ImDrawVert);
+    const GLsizeiptr idx_size = (GLsizeiptr)draw_data->TotalIdxCount * sizeof(GLuint);
+    glBindVertexArray(g_VaoHandle);
+    ImDrawVert* vtx_dst = (ImDrawVert*)ImGui_ImplGL3_MapBuffer(GL_ARRAY_BUFFER, g_VboHandle, &g_VboSize, vtx_size);
+    GLuint* idx_dst = (GLuint*)ImGui_ImplGL3_MapBuffer(GL_ELEMENT_ARRAY_BUFFER, g_ElementsHandle, &g_ElementsSize, idx_size);
+    if (!vtx_dst || !idx_dst)
+    {
+        // Unmapping a buffer that isn't mapped is an error
+        if (vtx_dst) glUnmapBuffer(GL_ARRAY_BUFFER);
+        if (idx_dst) glUnmapBuffer(GL_ELEMENT_ARRAY_BUFFER);
+        glBindVertexArray(0);
+        return;
+    }
+    GLuint vtx_offset = 0;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        memcpy(vtx_dst, &cmd_list->VtxBuffer.front(), cmd_list->VtxBuffer.size() * sizeof(ImDrawVert));
+        vtx_dst += cmd_list->VtxBuffer.size();
+        for (int i = 0; i < cmd_list->IdxBuffer.size(); i++)
+            *idx_dst++ = vtx_offset + cmd_list->IdxBuffer[i];
+        vtx_offset += cmd_list->VtxBuffer.size();
+    }
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+    glUnmapBuffer(GL_ELEMENT_ARRAY_BUFFER);
+
+    // Setup render state: alpha-blending enabled, no face culling, no depth testing, scissor enabled
+    GLint last_program, last_texture, viewport[4];
+    glGetIntegerv(GL_CURRENT_PROGRAM, &last_program);
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture);
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    glEnable(GL_BLEND);
+    glBlendEquation(GL_FUNC_ADD);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glDisable(GL_CULL_FACE);
+    glDisable(GL_DEPTH_TEST);
+    glEnable(GL_SCISSOR_TEST);
+    glActiveTexture(GL_TEXTURE0);
+
+    // Setup orthographic projection matrix
+    const float width = ImGui::GetIO().DisplaySize.x;
+    const float height = ImGui::GetIO().DisplaySize.y;
+    const float ortho_projection[4][4] =
+    {
+        { 2.0f/width,   0.0f,           0.0f,   0.0f },
+        { 0.0f,         2.0f/-height,   0.0f,   0.0f },
+        { 0.0f,         0.0f,           -1.0f,  0.0f },
+        { -1.0f,        1.0f,           0.0f,   1.0f },
+    };
+    glUseProgram(g_ShaderHandle);
+    glUniform1i(g_UniformLocationTex, 0);
+    glUniformMatrix4fv(g_UniformLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
+
+    // glScissor is in framebuffer pixels, so scale clip rectangles from screen coordinates
+    const float scale_x = viewport[2] / width;
+    const float scale_y = viewport[3] / height;
+
+    // Runs of commands with the same texture and clip rectangle are contiguous in the index buffer
+    const ImDrawCmd* batch = NULL;
+    size_t batch_offset = 0, batch_count = 0, idx_offset = 0;
+    GLuint bound_texture = 0;
+    for (int n = 0; n <= draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = n < draw_data->CmdListsCount ? draw_data->CmdLists[n] : NULL;
+        const int cmd_count = cmd_list ? cmd_list->CmdBuffer.size() : 1;
+        for (int cmd_i = 0; cmd_i < cmd_count; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = cmd_list ? &cmd_list->CmdBuffer[cmd_i] : NULL;
+            const bool same = batch && pcmd && !pcmd->UserCallback && pcmd->TextureId == batch->TextureId &&
+                memcmp(&pcmd->ClipRect, &batch->ClipRect, sizeof(ImVec4)) == 0;
+            if (batch && !same)
+            {
+                const GLuint texture = (GLuint)(intptr_t)batch->TextureId;
+                if (texture != bound_texture)
+                {
+                    glBindTexture(GL_TEXTURE_2D, texture);
+                    bound_texture = texture;
+                }
+                glScissor((int)(batch->ClipRect.x * scale_x),
+                          (int)((height - batch->ClipRect.w) * scale_y),
+                          (int)((batch->ClipRect.z - batch->ClipRect.x) * scale_x),
+                          (int)((batch->ClipRect.w - batch->ClipRect.y) * scale_y));
+                glDrawElements(GL_TRIANGLES, (GLsizei)batch_count, GL_UNSIGNED_INT, (const GLvoid*)(batch_offset * sizeof(GLuint)));
+                g_DrawCallCount++;
+                batch = NULL;
+            }
+            if (!pcmd)
+                break;
+
+            if (pcmd->UserCallback)
+            {
+                pcmd->UserCallback(cmd_list, pcmd);
+            }
+            else if (same)
+            {
+                batch_count += pcmd->ElemCount;
+            }
+            else
+            {
+                batch = pcmd;
+                batch_offset = idx_offset;
+                batch_count = pcmd->ElemCount;
+            }
+            idx_offset += pcmd->ElemCount;
+        }
+    }
+
+    // Restore modified state
+    glBindVertexArray(0);
+    glUseProgram(last_program);
+    glDisable(GL_SCISSOR_TEST);
+    glBindTexture(GL_TEXTURE_2D, last_texture);
+}
+
+int ImGui_ImplGL3_DrawCallCount()
+{
+    return g_DrawCallCount;
+}
+
+// Prints the info log of a shader or program that failed to compile or link.
+static bool ImGui_ImplGL3_CheckStatus(GLuint handle, bool program, const char* desc)
+{
+    GLint status = GL_FALSE, log_length = 0;
+    if (program)
+    {
+        glGetProgramiv(handle, GL_LINK_STATUS, &status);
+        glGetProgramiv(handle, GL_INFO_LOG_LENGTH, &log_length);
+    }
+    else
+    {
+        glGetShaderiv(handle, GL_COMPILE_STATUS, &status);
+        glGetShaderiv(handle, GL_INFO_LOG_LENGTH, &log_length);
+    }
+    if (status == GL_TRUE)
+        return true;
+
+    fprintf(stderr, "ImGui_ImplGL3_CreateDeviceObjects: failed to %s %s\n", program ? "link" : "compile", desc);
+    if (log_length > 1)
+    {
+        ImVector<char> log;
+        log.resize(log_length);
+        if (program)
+            glGetProgramInfoLog(handle, log_length, NULL, log.begin());
+        else
+            glGetShaderInfoLog(handle, log_length, NULL, log.begin());
+        fprintf(stderr, "%s\n", log.begin());
+    }
+    return false;
+}
+
+bool ImGui_ImplGL3_Init()
+{
+    return gladLoadGLLoader((GLADloadproc)glfwGetProcAddress) != 0;
+}
+
+bool ImGui_ImplGL3_CreateDeviceObjects(const unsigned char* font_pixels, int font_width, int font_height, unsigned int* font_texture)
+{
+    g_VertHandle = glCreateShader(GL_VERTEX_SHADER);
+    g_FragHandle = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(g_VertHandle, 1, &g_VertexShader, 0);
+    glShaderSource(g_FragHandle, 1, &g_FragmentShader, 0);
+    glCompileShader(g_VertHandle);
+    glCompileShader(g_FragHandle);
+    if (!ImGui_ImplGL3_CheckStatus(g_VertHandle, false, "vertex shader") ||
+        !ImGui_ImplGL3_CheckStatus(g_FragHandle, false, "fragment shader"))
+    {
+        ImGui_ImplGL3_InvalidateDeviceObjects();
+        return false;
+    }
+
+    g_ShaderHandle = glCreateProgram();
+    glAttachShader(g_ShaderHandle, g_VertHandle);
+    glAttachShader(g_ShaderHandle, g_FragHandle);
+    glBindFragDataLocation(g_ShaderHandle, 0, "Out_Color");
+    glLinkProgram(g_ShaderHandle);
+    if (!ImGui_ImplGL3_CheckStatus(g_ShaderHandle, true, "shader program"))
+    {
+        ImGui_ImplGL3_InvalidateDeviceObjects();
+        return false;
+    }
+
+    g_UniformLocationTex = glGetUniformLocation(g_ShaderHandle, "Texture");
+    g_UniformLocationProjMtx = glGetUniformLocation(g_ShaderHandle, "ProjMtx");
+    const GLuint position = glGetAttribLocation(g_ShaderHandle, "Position");
+    const GLuint uv = glGetAttribLocation(g_ShaderHandle, "UV");
+    const GLuint color = glGetAttribLocation(g_ShaderHandle, "Color");
+
+    glGenBuffers(1, &g_VboHandle);
+    glGenBuffers(1, &g_ElementsHandle);
+    g_VboSize = 0;
+    g_ElementsSize = 0;
+
+    // The element buffer binding is part of the vertex array state
+    glGenVertexArrays(1, &g_VaoHandle);
+    glBindVertexArray(g_VaoHandle);
+    glBindBuffer(GL_ARRAY_BUFFER, g_VboHandle);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, g_ElementsHandle);
+    glEnableVertexAttribArray(position);
+    glEnableVertexAttribArray(uv);
+    glEnableVertexAttribArray(color);
+
+    #define OFFSETOF(TYPE, ELEMENT) ((size_t)&(((TYPE *)0)->ELEMENT))
+    glVertexAttribPointer(position, 2, GL_FLOAT, GL_FALSE, sizeof(ImDrawVert), (GLvoid*)OFFSETOF(ImDrawVert, pos));
+    glVertexAttribPointer(uv, 2, GL_FLOAT, GL_FALSE, sizeof(ImDrawVert), (GLvoid*)OFFSETOF(ImDrawVert, uv));
+    glVertexAttribPointer(color, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)OFFSETOF(ImDrawVert, col));
+    #undef OFFSETOF
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // Core profile has no GL_ALPHA textures, so the atlas goes in the red channel
+    glGenTextures(1, font_texture);
+    glBindTexture(GL_TEXTURE_2D, *font_texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    // Prefer fonts and cursors to be pixelated but sharp on high DPI displays
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, font_width, font_height, 0, GL_RED, GL_UNSIGNED_BYTE, font_pixels);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    return true;
+}
+
+void ImGui_ImplGL3_InvalidateDeviceObjects()
+{
+    if (g_VaoHandle) glDeleteVertexArrays(1, &g_VaoHandle);
+    if (g_VboHandle) glDeleteBuffers(1, &g_VboHandle);
+    if (g_ElementsHandle) glDeleteBuffers(1, &g_ElementsHandle);
+    g_VaoHandle = g_VboHandle = g_ElementsHandle = 0;
+
+    if (g_ShaderHandle && g_VertHandle) glDetachShader(g_ShaderHandle, g_VertHandle);
+    if (g_VertHandle) glDeleteShader(g_VertHandle);
+    g_VertHandle = 0;
+
+    if (g_ShaderHandle && g_FragHandle) glDetachShader(g_ShaderHandle, g_FragHandle);
+    if (g_FragHandle) glDeleteShader(g_FragHandle);
+    g_FragHandle = 0;
+
+    if (g_ShaderHandle) glDeleteProgram(g_ShaderHandle);
+    g_ShaderHandle = 0;
+}
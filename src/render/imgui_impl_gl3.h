@@ -0,0 +1,14 @@
+// ImGui renderer for OpenGL 3.2 core profile
+// Shares input handling with imgui_impl_glfw; select it with ImGui_ImplGlfw_Init(window, install_callbacks, true).
+
+struct ImDrawData;
+
+// Loads the GL entry points through GLFW. Call with the context current.
+bool        ImGui_ImplGL3_Init();
+void        ImGui_ImplGL3_RenderDrawLists(ImDrawData* draw_data);
+
+bool        ImGui_ImplGL3_CreateDeviceObjects(const unsigned char* font_pixels, int font_width, int font_height, unsigned int* font_texture);
+void        ImGui_ImplGL3_InvalidateDeviceObjects();
+
+// Number of draw calls issued by the last frame.
+int         ImGui_ImplGL3_DrawCallCount();
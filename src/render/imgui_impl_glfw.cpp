@@ -3,6 +3,8 @@
 
 #include <imgui.h>
 #include "imgui_impl_glfw.h"
+#include "imgui_impl_gl3.h"
+#include "font_atlas.h"
 
 // GLFW
 #include <GLFW/glfw3.h>
@@ -20,6 +22,7 @@ static bool         g_MousePressed[3] = { false, false, false };
 static float        g_MouseWheel = 0.0f;
 static GLuint       g_FontTexture = 0;
 static float        g_FramebufferScale[2] = { 1.0f, 1.0f };
+static bool         g_CoreProfile = false;
 
 // This is the main rendering function that you have to implement and provide to ImGui (via setting up 'RenderDrawListsFn' in the ImGuiIO structure)
 // If text or lines are blurry when integrating ImGui in your engine:
@@ -143,11 +146,25 @@ bool ImGui_ImplGlfw_CreateDeviceObjects()
 {
     ImGuiIO& io = ImGui::GetIO();
 
+    // Without fonts of its own the atlas gets the baked one, and GetTexDataAsAlpha8() has nothing to build
+    if (io.Fonts->Fonts.empty())
+        LoadBakedFont(io.Fonts);
+
     // Build texture
     unsigned char* pixels;
     int width, height;
     io.Fonts->GetTexDataAsAlpha8(&pixels, &width, &height);
 
+    if (g_CoreProfile)
+    {
+        if (!ImGui_ImplGL3_CreateDeviceObjects(pixels, width, height, &g_FontTexture))
+            return false;
+        io.Fonts->TexID = (void *)(intptr_t)g_FontTexture;
+        io.Fonts->ClearInputData();
+        io.Fonts->ClearTexData();
+        return true;
+    }
+
     // Create texture
     glGenTextures(1, &g_FontTexture);
     glBindTexture(GL_TEXTURE_2D, g_FontTexture);
@@ -168,6 +185,8 @@ bool ImGui_ImplGlfw_CreateDeviceObjects()
 
 void    ImGui_ImplGlfw_InvalidateDeviceObjects()
 {
+    if (g_CoreProfile)
+        ImGui_ImplGL3_InvalidateDeviceObjects();
     if (g_FontTexture)
     {
         glDeleteTextures(1, &g_FontTexture);
@@ -176,9 +195,12 @@ void    ImGui_ImplGlfw_InvalidateDeviceObjects()
     }
 }
 
-bool    ImGui_ImplGlfw_Init(GLFWwindow* window, bool install_callbacks)
+bool    ImGui_ImplGlfw_Init(GLFWwindow* window, bool install_callbacks, bool core_profile)
 {
     g_Window = window;
+    g_CoreProfile = core_profile;
+    if (g_CoreProfile && !ImGui_ImplGL3_Init())
+        return false;
 
     ImGuiIO& io = ImGui::GetIO();
     io.KeyMap[ImGuiKey_Tab] = GLFW_KEY_TAB;                 // Keyboard mapping. ImGui will use those indices to peek into the io.KeyDown[] array.
@@ -201,7 +223,7 @@ bool    ImGui_ImplGlfw_Init(GLFWwindow* window, bool install_callbacks)
     io.KeyMap[ImGuiKey_Y] = GLFW_KEY_Y;
     io.KeyMap[ImGuiKey_Z] = GLFW_KEY_Z;
 
-    io.RenderDrawListsFn = ImGui_ImplGlfw_RenderDrawLists;
+    io.RenderDrawListsFn = g_CoreProfile ? ImGui_ImplGL3_RenderDrawLists : ImGui_ImplGlfw_RenderDrawLists;
     io.SetClipboardTextFn = ImGui_ImplGlfw_SetClipboardText;
     io.GetClipboardTextFn = ImGui_ImplGlfw_GetClipboardText;
 #ifdef _MSC_VER
@@ -3,7 +3,9 @@
 
 struct GLFWwindow;
 
-bool        ImGui_ImplGlfw_Init(GLFWwindow* window, bool install_callbacks);
+// With core_profile, the window must have an OpenGL 3.2+ core context and drawing goes through imgui_impl_gl3;
+// otherwise the fixed function pipeline is used.
+bool        ImGui_ImplGlfw_Init(GLFWwindow* window, bool install_callbacks, bool core_profile = false);
 void        ImGui_ImplGlfw_Shutdown();
 void        ImGui_ImplGlfw_NewFrame();
 
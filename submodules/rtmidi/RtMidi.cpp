@@ -37,6 +37,7 @@
 /**********************************************************************/
 
 #include "RtMidi.h"
+#include <cstring>
 #include <sstream>
 
 //*********************************************************************//
@@ -232,6 +233,21 @@ MidiApi :: ~MidiApi( void )
 {
 }
 
+std::vector<std::string> MidiApi :: getPortNames( void )
+{
+  std::vector<std::string> names;
+  unsigned int nPorts = getPortCount();
+  for ( unsigned int i=0; i<nPorts; i++ )
+    names.push_back( getPortName( i ) );
+  return names;
+}
+
+bool MidiApi :: openPortAt( int /*client*/, int /*port*/, const std::string &/*clientName*/, const std::string /*portName*/ )
+{
+  // Only ALSA names its ports by address.
+  return false;
+}
+
 void MidiApi :: setErrorCallback( RtMidiErrorCallback errorCallback, void *userData = 0 )
 {
     errorCallback_ = errorCallback;
@@ -305,6 +321,68 @@ void MidiInApi :: setCallback( RtMidiIn::RtMidiCallback callback, void *userData
   inputData_.usingCallback = true;
 }
 
+void MidiInApi :: setCallback( RtMidiIn::RtMidiTimedCallback callback, void *userData )
+{
+  if ( inputData_.usingCallback ) {
+    errorString_ = "MidiInApi::setCallback: a callback function is already set!";
+    error( RtMidiError::WARNING, errorString_ );
+    return;
+  }
+
+  if ( !callback ) {
+    errorString_ = "RtMidiIn::setCallback: callback function value is invalid!";
+    error( RtMidiError::WARNING, errorString_ );
+    return;
+  }
+
+  inputData_.userTimedCallback = callback;
+  inputData_.userData = userData;
+  inputData_.usingCallback = true;
+}
+
+void MidiInApi :: setCallback( RtMidiIn::RtMidiBatchCallback batchCallback, RtMidiIn::RtMidiTimedCallback callback, void *userData )
+{
+  if ( inputData_.usingCallback ) {
+    errorString_ = "MidiInApi::setCallback: a callback function is already set!";
+    error( RtMidiError::WARNING, errorString_ );
+    return;
+  }
+
+  if ( !batchCallback || !callback ) {
+    errorString_ = "RtMidiIn::setCallback: callback function value is invalid!";
+    error( RtMidiError::WARNING, errorString_ );
+    return;
+  }
+
+  inputData_.userBatchCallback = batchCallback;
+  inputData_.userTimedCallback = callback;
+  inputData_.userData = userData;
+  inputData_.usingCallback = true;
+}
+
+bool MidiInApi :: packMessage( const MidiMessage &message, RtMidiIn::PackedMessage &packed )
+{
+  size_t nBytes = message.bytes.size();
+  if ( nBytes > sizeof( packed.bytes ) ) return false;
+
+  packed.time = message.time;
+  packed.size = (unsigned char) nBytes;
+  packed.bytes[0] = packed.bytes[1] = packed.bytes[2] = 0;
+  for ( size_t i=0; i<nBytes; ++i ) packed.bytes[i] = message.bytes[i];
+  return true;
+}
+
+void MidiInApi :: invokeCallback( RtMidiInData *data, MidiMessage &message )
+{
+  RtMidiIn::PackedMessage packed;
+  if ( data->userBatchCallback && packMessage( message, packed ) )
+    data->userBatchCallback( &packed, 1, data->userData );
+  else if ( data->userTimedCallback )
+    data->userTimedCallback( message.time, message.timeStamp, &message.bytes, data->userData );
+  else
+    data->userCallback( message.timeStamp, &message.bytes, data->userData );
+}
+
 void MidiInApi :: cancelCallback()
 {
   if ( !inputData_.usingCallback ) {
@@ -314,6 +392,8 @@ void MidiInApi :: cancelCallback()
   }
 
   inputData_.userCallback = 0;
+  inputData_.userTimedCallback = 0;
+  inputData_.userBatchCallback = 0;
   inputData_.userData = 0;
   inputData_.usingCallback = false;
 }
@@ -425,6 +505,12 @@ static void midiInputCallback( const MIDIPacketList *list, void *procRef, void *
 
     // Calculate time stamp.
 
+    if ( !continueSysex ) {
+      time = packet->timeStamp;
+      if ( time == 0 ) time = AudioGetCurrentHostTime();
+      message.time = AudioConvertHostTimeToNanos( time );
+    }
+
     if ( data->firstMessage ) {
       message.timeStamp = 0.0;
       data->firstMessage = false;
@@ -458,8 +544,7 @@ static void midiInputCallback( const MIDIPacketList *list, void *procRef, void *
       if ( !( data->ignoreFlags & 0x01 ) && !continueSysex ) {
         // If not a continuing sysex message, invoke the user callback function or queue the message.
         if ( data->usingCallback ) {
-          RtMidiIn::RtMidiCallback callback = (RtMidiIn::RtMidiCallback) data->userCallback;
-          callback( message.timeStamp, &message.bytes, data->userData );
+          MidiInApi::invokeCallback( data, message );
         }
         else {
           // As long as we haven't reached our queue size limit, push the message.
@@ -522,8 +607,7 @@ static void midiInputCallback( const MIDIPacketList *list, void *procRef, void *
           if ( !continueSysex ) {
             // If not a continuing sysex message, invoke the user callback function or queue the message.
             if ( data->usingCallback ) {
-              RtMidiIn::RtMidiCallback callback = (RtMidiIn::RtMidiCallback) data->userCallback;
-              callback( message.timeStamp, &message.bytes, data->userData );
+              MidiInApi::invokeCallback( data, message );
             }
             else {
               // As long as we haven't reached our queue size limit, push the message.
@@ -988,11 +1072,11 @@ void MidiOutCore :: openVirtualPort( std::string portName )
   data->endpoint = endpoint;
 }
 
-void MidiOutCore :: sendMessage( std::vector<unsigned char> *message )
+void MidiOutCore :: sendMessage( const unsigned char *message, size_t size )
 {
   // We use the MIDISendSysex() function to asynchronously send sysex
   // messages.  Otherwise, we use a single CoreMidi MIDIPacket.
-  unsigned int nBytes = message->size();
+  unsigned int nBytes = size;
   if ( nBytes == 0 ) {
     errorString_ = "MidiOutCore::sendMessage: no data in message argument!";      
     error( RtMidiError::WARNING, errorString_ );
@@ -1003,7 +1087,7 @@ void MidiOutCore :: sendMessage( std::vector<unsigned char> *message )
   CoreMidiData *data = static_cast<CoreMidiData *> (apiData_);
   OSStatus result;
 
-  if ( message->at(0) != 0xF0 && nBytes > 3 ) {
+  if ( message[0] != 0xF0 && nBytes > 3 ) {
     errorString_ = "MidiOutCore::sendMessage: message format problem ... not sysex but > 3 bytes?";
     error( RtMidiError::WARNING, errorString_ );
     return;
@@ -1017,7 +1101,7 @@ void MidiOutCore :: sendMessage( std::vector<unsigned char> *message )
   ByteCount remainingBytes = nBytes;
   while (remainingBytes && packet) {
     ByteCount bytesForPacket = remainingBytes > 65535 ? 65535 : remainingBytes; // 65535 = maximum size of a MIDIPacket
-    const Byte* dataStartPtr = (const Byte *) &message->at( nBytes - remainingBytes );
+    const Byte* dataStartPtr = (const Byte *) &message[nBytes - remainingBytes];
     packet = MIDIPacketListAdd( packetList, listSize, packet, timeStamp, bytesForPacket, dataStartPtr);
     remainingBytes -= bytesForPacket; 
   }
@@ -1071,6 +1155,7 @@ void MidiOutCore :: sendMessage( std::vector<unsigned char> *message )
 
 #include <pthread.h>
 #include <sys/time.h>
+#include <time.h>
 
 // ALSA header file.
 #include <alsa/asoundlib.h>
@@ -1088,10 +1173,36 @@ struct AlsaMidiData {
   pthread_t thread;
   pthread_t dummy_thread_id;
   unsigned long long lastTime;
+  unsigned long long queueOrigin; // monotonic time (ns) at which the input queue read zero
   int queue_id; // an input queue is needed to get timestamped events
   int trigger_fds[2];
 };
 
+static unsigned long long alsaMonotonicTime( void )
+{
+  struct timespec ts;
+  clock_gettime( CLOCK_MONOTONIC, &ts );
+  return (unsigned long long) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// Samples the queue clock against the monotonic clock so that queue
+// timestamps can be turned into absolute arrival times.
+static unsigned long long alsaQueueOrigin( AlsaMidiData *data )
+{
+  unsigned long long now = alsaMonotonicTime();
+#ifndef AVOID_TIMESTAMPING
+  snd_seq_queue_status_t *status;
+  snd_seq_queue_status_alloca( &status );
+  if ( snd_seq_get_queue_status( data->seq, data->queue_id, status ) == 0 ) {
+    const snd_seq_real_time_t *queueTime = snd_seq_queue_status_get_real_time( status );
+    now -= (unsigned long long) queueTime->tv_sec * 1000000000ULL + queueTime->tv_nsec;
+  }
+#else
+  (void) data;
+#endif
+  return now;
+}
+
 #define PORT_TYPE( pinfo, bits ) ((snd_seq_port_info_get_capability(pinfo) & (bits)) == (bits))
 
 //*********************************************************************//
@@ -1099,6 +1210,9 @@ struct AlsaMidiData {
 //  Class Definitions: MidiInAlsa
 //*********************************************************************//
 
+// Largest number of messages handed to a batch callback at once.
+#define ALSA_BATCH_SIZE 256
+
 static void *alsaMidiHandler( void *ptr )
 {
   MidiInApi::RtMidiInData *data = static_cast<MidiInApi::RtMidiInData *> (ptr);
@@ -1114,6 +1228,8 @@ static void *alsaMidiHandler( void *ptr )
 
   snd_seq_event_t *ev;
   int result;
+  RtMidiIn::PackedMessage batch[ALSA_BATCH_SIZE];
+  unsigned int batchCount = 0;
   apiData->bufferSize = 32;
   result = snd_midi_event_new( 0, &apiData->coder );
   if ( result < 0 ) {
@@ -1141,7 +1257,12 @@ static void *alsaMidiHandler( void *ptr )
   while ( data->doInput ) {
 
     if ( snd_seq_event_input_pending( apiData->seq, 1 ) == 0 ) {
-      // No data pending
+      // No data pending: deliver what this wakeup produced before sleeping.
+      if ( batchCount > 0 ) {
+        if ( data->userBatchCallback )
+          data->userBatchCallback( batch, batchCount, data->userData );
+        batchCount = 0;
+      }
       if ( poll( poll_fds, poll_fd_count, -1) >= 0 ) {
         if ( poll_fds[0].revents & POLLIN ) {
           bool dummy;
@@ -1247,6 +1368,11 @@ static void *alsaMidiHandler( void *ptr )
 
           // Method 2: Use the ALSA sequencer event time data.
           // (thanks to Pedro Lopez-Cabanillas!).
+#ifndef AVOID_TIMESTAMPING
+          message.time = apiData->queueOrigin + (unsigned long long) ev->time.time.tv_sec * 1000000000ULL + ev->time.time.tv_nsec;
+#else
+          message.time = alsaMonotonicTime();
+#endif
           time = ( ev->time.time.tv_sec * 1000000 ) + ( ev->time.time.tv_nsec/1000 );
           lastTime = time;
           time -= apiData->lastTime;
@@ -1267,9 +1393,24 @@ static void *alsaMidiHandler( void *ptr )
     snd_seq_free_event( ev );
     if ( message.bytes.size() == 0 || continueSysex ) continue;
 
-    if ( data->usingCallback ) {
-      RtMidiIn::RtMidiCallback callback = (RtMidiIn::RtMidiCallback) data->userCallback;
-      callback( message.timeStamp, &message.bytes, data->userData );
+    if ( data->usingCallback && data->userBatchCallback ) {
+      if ( MidiInApi::packMessage( message, batch[batchCount] ) ) {
+        if ( ++batchCount == ALSA_BATCH_SIZE ) {
+          data->userBatchCallback( batch, batchCount, data->userData );
+          batchCount = 0;
+        }
+      }
+      else {
+        // Keep arrival order: earlier short messages go out first.
+        if ( batchCount > 0 ) {
+          data->userBatchCallback( batch, batchCount, data->userData );
+          batchCount = 0;
+        }
+        MidiInApi::invokeCallback( data, message );
+      }
+    }
+    else if ( data->usingCallback ) {
+      MidiInApi::invokeCallback( data, message );
     }
     else {
       // As long as we haven't reached our queue size limit, push the message.
@@ -1344,6 +1485,7 @@ void MidiInAlsa :: initialize( const std::string& clientName )
   data->subscription = 0;
   data->dummy_thread_id = pthread_self();
   data->thread = data->dummy_thread_id;
+  data->queueOrigin = 0;
   data->trigger_fds[0] = -1;
   data->trigger_fds[1] = -1;
   apiData_ = (void *) data;
@@ -1399,6 +1541,57 @@ unsigned int portInfo( snd_seq_t *seq, snd_seq_port_info_t *pinfo, unsigned int
   return 0;
 }
 
+// Gets the pinfo structure for the port at client:port, if the client there is
+// still called clientName and portInfo() would count the port.
+bool addressInfo( snd_seq_t *seq, snd_seq_port_info_t *pinfo, unsigned int type, int client, int port, const std::string &clientName )
+{
+  if ( client <= 0 || port < 0 ) return false;
+  snd_seq_client_info_t *cinfo;
+  snd_seq_client_info_alloca( &cinfo );
+  if ( snd_seq_get_any_client_info( seq, client, cinfo ) < 0 ) return false;
+  if ( clientName != snd_seq_client_info_get_name( cinfo ) ) return false;
+  if ( snd_seq_get_any_port_info( seq, client, port, pinfo ) < 0 ) return false;
+  unsigned int atyp = snd_seq_port_info_get_type( pinfo );
+  if ( ( ( atyp & SND_SEQ_PORT_TYPE_MIDI_GENERIC ) == 0 ) &&
+    ( ( atyp & SND_SEQ_PORT_TYPE_SYNTH ) == 0 ) ) return false;
+  unsigned int caps = snd_seq_port_info_get_capability( pinfo );
+  return ( caps & type ) == type;
+}
+
+// Lists the ports portInfo() would count, in the same order and named as
+// getPortName() names them, in one walk over the sequencer.
+std::vector<std::string> portNames( snd_seq_t *seq, unsigned int type )
+{
+  snd_seq_client_info_t *cinfo;
+  snd_seq_port_info_t *pinfo;
+  snd_seq_client_info_alloca( &cinfo );
+  snd_seq_port_info_alloca( &pinfo );
+
+  std::vector<std::string> names;
+  snd_seq_client_info_set_client( cinfo, -1 );
+  while ( snd_seq_query_next_client( seq, cinfo ) >= 0 ) {
+    int client = snd_seq_client_info_get_client( cinfo );
+    if ( client == 0 ) continue;
+    snd_seq_port_info_set_client( pinfo, client );
+    snd_seq_port_info_set_port( pinfo, -1 );
+    while ( snd_seq_query_next_port( seq, pinfo ) >= 0 ) {
+      unsigned int atyp = snd_seq_port_info_get_type( pinfo );
+      if ( ( ( atyp & SND_SEQ_PORT_TYPE_MIDI_GENERIC ) == 0 ) &&
+        ( ( atyp & SND_SEQ_PORT_TYPE_SYNTH ) == 0 ) ) continue;
+      unsigned int caps = snd_seq_port_info_get_capability( pinfo );
+      if ( ( caps & type ) != type ) continue;
+      std::ostringstream os;
+      os << snd_seq_client_info_get_name( cinfo );
+      os << " ";
+      os << client;
+      os << ":";
+      os << snd_seq_port_info_get_port( pinfo );
+      names.push_back( os.str() );
+    }
+  }
+  return names;
+}
+
 unsigned int MidiInAlsa :: getPortCount()
 {
   snd_seq_port_info_t *pinfo;
@@ -1408,6 +1601,12 @@ unsigned int MidiInAlsa :: getPortCount()
   return portInfo( data->seq, pinfo, SND_SEQ_PORT_CAP_READ|SND_SEQ_PORT_CAP_SUBS_READ, -1 );
 }
 
+std::vector<std::string> MidiInAlsa :: getPortNames( void )
+{
+  AlsaMidiData *data = static_cast<AlsaMidiData *> (apiData_);
+  return portNames( data->seq, SND_SEQ_PORT_CAP_READ|SND_SEQ_PORT_CAP_SUBS_READ );
+}
+
 std::string MidiInAlsa :: getPortName( unsigned int portNumber )
 {
   snd_seq_client_info_t *cinfo;
@@ -1462,9 +1661,33 @@ void MidiInAlsa :: openPort( unsigned int portNumber, const std::string portName
     return;
   }
 
+  connect( snd_seq_port_info_get_client( src_pinfo ), snd_seq_port_info_get_port( src_pinfo ), portName );
+}
+
+bool MidiInAlsa :: openPortAt( int client, int port, const std::string &clientName, const std::string portName )
+{
+  if ( connected_ ) {
+    errorString_ = "MidiInAlsa::openPortAt: a valid connection already exists!";
+    error( RtMidiError::WARNING, errorString_ );
+    return false;
+  }
+
+  snd_seq_port_info_t *src_pinfo;
+  snd_seq_port_info_alloca( &src_pinfo );
+  AlsaMidiData *data = static_cast<AlsaMidiData *> (apiData_);
+  if ( !addressInfo( data->seq, src_pinfo, SND_SEQ_PORT_CAP_READ|SND_SEQ_PORT_CAP_SUBS_READ, client, port, clientName ) )
+    return false;
+
+  connect( client, port, portName );
+  return connected_;
+}
+
+void MidiInAlsa :: connect( int client, int port, const std::string& portName )
+{
+  AlsaMidiData *data = static_cast<AlsaMidiData *> (apiData_);
   snd_seq_addr_t sender, receiver;
-  sender.client = snd_seq_port_info_get_client( src_pinfo );
-  sender.port = snd_seq_port_info_get_port( src_pinfo );
+  sender.client = client;
+  sender.port = port;
   receiver.client = snd_seq_client_id( data->seq );
 
   snd_seq_port_info_t *pinfo;
@@ -1521,6 +1744,7 @@ void MidiInAlsa :: openPort( unsigned int portNumber, const std::string portName
     snd_seq_start_queue( data->seq, data->queue_id, NULL );
     snd_seq_drain_output( data->seq );
 #endif
+    data->queueOrigin = alsaQueueOrigin( data );
     // Start our MIDI input thread.
     pthread_attr_t attr;
     pthread_attr_init(&attr);
@@ -1583,6 +1807,7 @@ void MidiInAlsa :: openVirtualPort( std::string portName )
     snd_seq_start_queue( data->seq, data->queue_id, NULL );
     snd_seq_drain_output( data->seq );
 #endif
+    data->queueOrigin = alsaQueueOrigin( data );
     // Start our MIDI input thread.
     pthread_attr_t attr;
     pthread_attr_init(&attr);
@@ -1687,13 +1912,6 @@ void MidiOutAlsa :: initialize( const std::string& clientName )
     error( RtMidiError::DRIVER_ERROR, errorString_ );
     return;
   }
-  data->buffer = (unsigned char *) malloc( data->bufferSize );
-  if ( data->buffer == NULL ) {
-    delete data;
-    errorString_ = "MidiOutAlsa::initialize: error allocating buffer memory!\n\n";
-    error( RtMidiError::MEMORY_ERROR, errorString_ );
-    return;
-  }
   snd_midi_event_init( data->coder );
   apiData_ = (void *) data;
 }
@@ -1707,6 +1925,12 @@ unsigned int MidiOutAlsa :: getPortCount()
   return portInfo( data->seq, pinfo, SND_SEQ_PORT_CAP_WRITE|SND_SEQ_PORT_CAP_SUBS_WRITE, -1 );
 }
 
+std::vector<std::string> MidiOutAlsa :: getPortNames( void )
+{
+  AlsaMidiData *data = static_cast<AlsaMidiData *> (apiData_);
+  return portNames( data->seq, SND_SEQ_PORT_CAP_WRITE|SND_SEQ_PORT_CAP_SUBS_WRITE );
+}
+
 std::string MidiOutAlsa :: getPortName( unsigned int portNumber )
 {
   snd_seq_client_info_t *cinfo;
@@ -1761,9 +1985,33 @@ void MidiOutAlsa :: openPort( unsigned int portNumber, const std::string portNam
     return;
   }
 
+  connect( snd_seq_port_info_get_client( pinfo ), snd_seq_port_info_get_port( pinfo ), portName );
+}
+
+bool MidiOutAlsa :: openPortAt( int client, int port, const std::string &clientName, const std::string portName )
+{
+  if ( connected_ ) {
+    errorString_ = "MidiOutAlsa::openPortAt: a valid connection already exists!";
+    error( RtMidiError::WARNING, errorString_ );
+    return false;
+  }
+
+  snd_seq_port_info_t *pinfo;
+  snd_seq_port_info_alloca( &pinfo );
+  AlsaMidiData *data = static_cast<AlsaMidiData *> (apiData_);
+  if ( !addressInfo( data->seq, pinfo, SND_SEQ_PORT_CAP_WRITE|SND_SEQ_PORT_CAP_SUBS_WRITE, client, port, clientName ) )
+    return false;
+
+  connect( client, port, portName );
+  return connected_;
+}
+
+void MidiOutAlsa :: connect( int client, int port, const std::string& portName )
+{
+  AlsaMidiData *data = static_cast<AlsaMidiData *> (apiData_);
   snd_seq_addr_t sender, receiver;
-  receiver.client = snd_seq_port_info_get_client( pinfo );
-  receiver.port = snd_seq_port_info_get_port( pinfo );
+  receiver.client = client;
+  receiver.port = port;
   sender.client = snd_seq_client_id( data->seq );
 
   if ( data->vport < 0 ) {
@@ -1825,25 +2073,20 @@ void MidiOutAlsa :: openVirtualPort( std::string portName )
   }
 }
 
-void MidiOutAlsa :: sendMessage( std::vector<unsigned char> *message )
+// Encodes the message into the sequencer's output buffer without draining
+// it. The buffer is written to the kernel when it fills up or on a drain.
+bool MidiOutAlsa :: encodeMessage( const unsigned char *message, size_t size )
 {
   int result;
   AlsaMidiData *data = static_cast<AlsaMidiData *> (apiData_);
-  unsigned int nBytes = message->size();
+  unsigned int nBytes = size;
   if ( nBytes > data->bufferSize ) {
     data->bufferSize = nBytes;
     result = snd_midi_event_resize_buffer ( data->coder, nBytes);
     if ( result != 0 ) {
       errorString_ = "MidiOutAlsa::sendMessage: ALSA error resizing MIDI event buffer.";
       error( RtMidiError::DRIVER_ERROR, errorString_ );
-      return;
-    }
-    free (data->buffer);
-    data->buffer = (unsigned char *) malloc( data->bufferSize );
-    if ( data->buffer == NULL ) {
-    errorString_ = "MidiOutAlsa::initialize: error allocating buffer memory!\n\n";
-    error( RtMidiError::MEMORY_ERROR, errorString_ );
-    return;
+      return false;
     }
   }
 
@@ -1852,22 +2095,39 @@ void MidiOutAlsa :: sendMessage( std::vector<unsigned char> *message )
   snd_seq_ev_set_source(&ev, data->vport);
   snd_seq_ev_set_subs(&ev);
   snd_seq_ev_set_direct(&ev);
-  for ( unsigned int i=0; i<nBytes; ++i ) data->buffer[i] = message->at(i);
-  result = snd_midi_event_encode( data->coder, data->buffer, (long)nBytes, &ev );
+  // The coder reads the caller's bytes directly, so nothing is copied here.
+  result = snd_midi_event_encode( data->coder, message, (long)nBytes, &ev );
   if ( result < (int)nBytes ) {
     errorString_ = "MidiOutAlsa::sendMessage: event parsing error!";
     error( RtMidiError::WARNING, errorString_ );
-    return;
+    return false;
   }
 
-  // Send the event.
+  // Queue the event.
   result = snd_seq_event_output(data->seq, &ev);
   if ( result < 0 ) {
     errorString_ = "MidiOutAlsa::sendMessage: error sending MIDI message to port.";
     error( RtMidiError::WARNING, errorString_ );
-    return;
+    return false;
   }
-  snd_seq_drain_output(data->seq);
+  return true;
+}
+
+void MidiOutAlsa :: sendMessage( const unsigned char *message, size_t size )
+{
+  if ( encodeMessage( message, size ) )
+    flush();
+}
+
+void MidiOutAlsa :: queueMessage( const unsigned char *message, size_t size )
+{
+  encodeMessage( message, size );
+}
+
+void MidiOutAlsa :: flush( void )
+{
+  AlsaMidiData *data = static_cast<AlsaMidiData *> (apiData_);
+  snd_seq_drain_output( data->seq );
 }
 
 #endif // __LINUX_ALSA__
@@ -1901,11 +2161,21 @@ struct WinMidiData {
   HMIDIIN inHandle;    // Handle to Midi Input Device
   HMIDIOUT outHandle;  // Handle to Midi Output Device
   DWORD lastTime;
+  unsigned long long startTime; // performance counter time (ns) of midiInStart
   MidiInApi::MidiMessage message;
   LPMIDIHDR sysexBuffer[RT_SYSEX_BUFFER_COUNT];
   CRITICAL_SECTION _mutex; // [Patrice] see https://groups.google.com/forum/#!topic/mididev/6OUjHutMpEo
 };
 
+static unsigned long long winPerformanceTime( void )
+{
+  LARGE_INTEGER counter, frequency;
+  QueryPerformanceCounter( &counter );
+  QueryPerformanceFrequency( &frequency );
+  unsigned long long ticks = counter.QuadPart, rate = frequency.QuadPart;
+  return ticks / rate * 1000000000ULL + ticks % rate * 1000000000ULL / rate;
+}
+
 //*********************************************************************//
 //  API: Windows MM
 //  Class Definitions: MidiInWinMM
@@ -1930,6 +2200,7 @@ static void CALLBACK midiInputCallback( HMIDIIN /*hmin*/,
   }
   else apiData->message.timeStamp = (double) ( timestamp - apiData->lastTime ) * 0.001;
   apiData->lastTime = timestamp;
+  apiData->message.time = apiData->startTime + (unsigned long long) timestamp * 1000000ULL;
 
   if ( inputStatus == MIM_DATA ) { // Channel or system message
 
@@ -1991,8 +2262,7 @@ static void CALLBACK midiInputCallback( HMIDIIN /*hmin*/,
   }
 
   if ( data->usingCallback ) {
-    RtMidiIn::RtMidiCallback callback = (RtMidiIn::RtMidiCallback) data->userCallback;
-    callback( apiData->message.timeStamp, &apiData->message.bytes, data->userData );
+    MidiInApi::invokeCallback( data, apiData->message );
   }
   else {
     // As long as we haven't reached our queue size limit, push the message.
@@ -2110,6 +2380,7 @@ void MidiInWinMM :: openPort( unsigned int portNumber, const std::string /*portN
     }
   }
 
+  data->startTime = winPerformanceTime();
   result = midiInStart( data->inHandle );
   if ( result != MMSYSERR_NOERROR ) {
     midiInClose( data->inHandle );
@@ -2322,11 +2593,11 @@ void MidiOutWinMM :: openVirtualPort( std::string /*portName*/ )
   error( RtMidiError::WARNING, errorString_ );
 }
 
-void MidiOutWinMM :: sendMessage( std::vector<unsigned char> *message )
+void MidiOutWinMM :: sendMessage( const unsigned char *message, size_t size )
 {
   if ( !connected_ ) return;
 
-  unsigned int nBytes = static_cast<unsigned int>(message->size());
+  unsigned int nBytes = static_cast<unsigned int>(size);
   if ( nBytes == 0 ) {
     errorString_ = "MidiOutWinMM::sendMessage: message argument is empty!";
     error( RtMidiError::WARNING, errorString_ );
@@ -2335,7 +2606,7 @@ void MidiOutWinMM :: sendMessage( std::vector<unsigned char> *message )
 
   MMRESULT result;
   WinMidiData *data = static_cast<WinMidiData *> (apiData_);
-  if ( message->at(0) == 0xF0 ) { // Sysex message
+  if ( message[0] == 0xF0 ) { // Sysex message
 
     // Allocate buffer for sysex data.
     char *buffer = (char *) malloc( nBytes );
@@ -2346,7 +2617,7 @@ void MidiOutWinMM :: sendMessage( std::vector<unsigned char> *message )
     }
 
     // Copy data to buffer.
-    for ( unsigned int i=0; i<nBytes; ++i ) buffer[i] = message->at(i);
+    memcpy( buffer, message, nBytes );
 
     // Create and prepare MIDIHDR structure.
     MIDIHDR sysex;
@@ -2384,12 +2655,8 @@ void MidiOutWinMM :: sendMessage( std::vector<unsigned char> *message )
     }
 
     // Pack MIDI bytes into double word.
-    DWORD packet;
-    unsigned char *ptr = (unsigned char *) &packet;
-    for ( unsigned int i=0; i<nBytes; ++i ) {
-      *ptr = message->at(i);
-      ++ptr;
-    }
+    DWORD packet = 0;
+    memcpy( &packet, message, nBytes );
 
     // Send the message immediately.
     result = midiOutShortMsg( data->outHandle, packet );
@@ -2456,6 +2723,9 @@ static int jackProcessIn( jack_nframes_t nframes, void *arg )
     for ( unsigned int i = 0; i < event.size; i++ )
       message.bytes.push_back( event.buffer[i] );
 
+    // The event's frame time on the JACK clock, which is in microseconds.
+    message.time = jack_frames_to_time( jData->client, jack_last_frame_time( jData->client ) + event.time ) * 1000ULL;
+
     // Compute the delta time.
     time = jack_get_time();
     if ( rtData->firstMessage == true )
@@ -2467,8 +2737,7 @@ static int jackProcessIn( jack_nframes_t nframes, void *arg )
 
     if ( !rtData->continueSysex ) {
       if ( rtData->usingCallback ) {
-        RtMidiIn::RtMidiCallback callback = (RtMidiIn::RtMidiCallback) rtData->userCallback;
-        callback( message.timeStamp, &message.bytes, rtData->userData );
+        MidiInApi::invokeCallback( rtData, message );
       }
       else {
         // As long as we haven't reached our queue size limit, push the message.
@@ -2804,14 +3073,13 @@ void MidiOutJack :: closePort()
   data->port = NULL;
 }
 
-void MidiOutJack :: sendMessage( std::vector<unsigned char> *message )
+void MidiOutJack :: sendMessage( const unsigned char *message, size_t size )
 {
-  int nBytes = message->size();
+  int nBytes = size;
   JackMidiData *data = static_cast<JackMidiData *> (apiData_);
 
   // Write full message to buffer
-  jack_ringbuffer_write( data->buffMessage, ( const char * ) &( *message )[0],
-                         message->size() );
+  jack_ringbuffer_write( data->buffMessage, ( const char * ) message, size );
   jack_ringbuffer_write( data->buffSize, ( char * ) &nBytes, sizeof( nBytes ) );
 }
 
@@ -141,6 +141,9 @@ class RtMidi
   //! Pure virtual openPort() function.
   virtual void openPort( unsigned int portNumber = 0, const std::string portName = std::string( "RtMidi" ) ) = 0;
 
+  //! Pure virtual openPortAt() function.
+  virtual bool openPortAt( int client, int port, const std::string &clientName, const std::string portName = std::string( "RtMidi" ) ) = 0;
+
   //! Pure virtual openVirtualPort() function.
   virtual void openVirtualPort( const std::string portName = std::string( "RtMidi" ) ) = 0;
 
@@ -150,6 +153,9 @@ class RtMidi
   //! Pure virtual getPortName() function.
   virtual std::string getPortName( unsigned int portNumber = 0 ) = 0;
 
+  //! Pure virtual getPortNames() function.
+  virtual std::vector<std::string> getPortNames( void ) = 0;
+
   //! Pure virtual closePort() function.
   virtual void closePort( void ) = 0;
 
@@ -210,6 +216,25 @@ class RtMidiIn : public RtMidi
   //! User callback function type definition.
   typedef void (*RtMidiCallback)( double timeStamp, std::vector<unsigned char> *message, void *userData);
 
+  //! User callback function type that also receives the absolute arrival time.
+  /*!
+    \e time is in nanoseconds on the system monotonic clock (CLOCK_MONOTONIC,
+    mach_absolute_time or QueryPerformanceCounter), taken from the driver's
+    own timestamp where the API provides one.  \e timeStamp is the delta
+    time in seconds, as for RtMidiCallback.
+  */
+  typedef void (*RtMidiTimedCallback)( unsigned long long time, double timeStamp, std::vector<unsigned char> *message, void *userData);
+
+  //! A message of up to three bytes, as delivered to a batch callback.
+  struct PackedMessage {
+    unsigned long long time;
+    unsigned char bytes[3];
+    unsigned char size;
+  };
+
+  //! User callback function type that receives messages in batches.
+  typedef void (*RtMidiBatchCallback)( const PackedMessage *messages, unsigned int count, void *userData);
+
   //! Default constructor that allows an optional api, client name and queue size.
   /*!
     An exception will be thrown if a MIDI system initialization
@@ -246,6 +271,16 @@ class RtMidiIn : public RtMidi
   */
   void openPort( unsigned int portNumber = 0, const std::string portName = std::string( "RtMidi Input" ) );
 
+  //! Open a MIDI input connection given by system address (ALSA only).
+  /*!
+    Opens the source at \e client:\e port, the address that ends the
+    port's name, without enumerating the system. Client numbers are
+    reused, so the client there must still be called \e clientName.
+    \retval false if the API has no port addresses or no suitable port
+            of that client exists at that address; nothing is opened.
+  */
+  bool openPortAt( int client, int port, const std::string &clientName, const std::string portName = std::string( "RtMidi Input" ) );
+
   //! Create a virtual input port, with optional name, to allow software connections (OS X, JACK and ALSA only).
   /*!
     This function creates a virtual MIDI input port to which other
@@ -271,6 +306,19 @@ class RtMidiIn : public RtMidi
   */
   void setCallback( RtMidiCallback callback, void *userData = 0 );
 
+  //! Set a callback function that also receives the absolute arrival time of each message.
+  void setCallback( RtMidiTimedCallback callback, void *userData = 0 );
+
+  //! Set callback functions that receive incoming messages in batches.
+  /*!
+    Messages of up to three bytes are packed and passed to \e batchCallback.
+    APIs that can (currently ALSA) deliver everything that is pending
+    after each wakeup as one batch; the others deliver batches of one.
+    Longer (sysex) messages are passed to \e callback, after any batched
+    messages that arrived before them.
+  */
+  void setCallback( RtMidiBatchCallback batchCallback, RtMidiTimedCallback callback, void *userData = 0 );
+
   //! Cancel use of the current callback function (if one exists).
   /*!
     Subsequent incoming MIDI messages will be written to the queue
@@ -297,6 +345,13 @@ class RtMidiIn : public RtMidi
   */
   std::string getPortName( unsigned int portNumber = 0 );
 
+  //! Return the names of all MIDI input ports, indexed by port number.
+  /*!
+    Equivalent to calling getPortName() for every port, but APIs that
+    enumerate by walking the system (ALSA) do it in a single pass.
+  */
+  std::vector<std::string> getPortNames( void );
+
   //! Specify whether certain MIDI message types should be queued or ignored during input.
   /*!
     By default, MIDI timing and active sensing messages are ignored
@@ -375,6 +430,16 @@ class RtMidiOut : public RtMidi
   */
   void openPort( unsigned int portNumber = 0, const std::string portName = std::string( "RtMidi Output" ) );
 
+  //! Open a MIDI output connection given by system address (ALSA only).
+  /*!
+      Opens the destination at \e client:\e port, the address that ends
+      the port's name, without enumerating the system.  Client numbers
+      are reused, so the client there must still be called \e clientName.
+      Returns false, opening nothing, if the API has no port addresses or
+      no suitable port of that client exists at that address.
+  */
+  bool openPortAt( int client, int port, const std::string &clientName, const std::string portName = std::string( "RtMidi Output" ) );
+
   //! Close an open MIDI connection (if one exists).
   void closePort( void );
 
@@ -401,6 +466,9 @@ class RtMidiOut : public RtMidi
   */
   std::string getPortName( unsigned int portNumber = 0 );
 
+  //! Return the names of all MIDI output ports, indexed by port number.
+  std::vector<std::string> getPortNames( void );
+
   //! Immediately send a single message out an open MIDI output port.
   /*!
       An exception is thrown if an error occurs during output or an
@@ -408,6 +476,24 @@ class RtMidiOut : public RtMidi
   */
   void sendMessage( std::vector<unsigned char> *message );
 
+  //! Immediately send a single message of \e size bytes out an open MIDI output port.
+  /*!
+      Unlike the vector overload this does not require the message to
+      live on the heap; no copy of it is made on the way to the driver.
+  */
+  void sendMessage( const unsigned char *message, size_t size );
+
+  //! Queue a message to be sent with the next flush().
+  /*!
+      APIs that can buffer output (currently ALSA) deliver every queued
+      message with a single write to the driver; the others send each
+      message immediately.
+  */
+  void queueMessage( const unsigned char *message, size_t size );
+
+  //! Deliver all messages queued with queueMessage().
+  void flush( void );
+
   //! Set an error callback function to be invoked when an error has occured.
   /*!
     The callback function will be called whenever an error has occured. It is best
@@ -441,11 +527,13 @@ class MidiApi
   virtual ~MidiApi();
   virtual RtMidi::Api getCurrentApi( void ) = 0;
   virtual void openPort( unsigned int portNumber, const std::string portName ) = 0;
+  virtual bool openPortAt( int client, int port, const std::string &clientName, const std::string portName );
   virtual void openVirtualPort( const std::string portName ) = 0;
   virtual void closePort( void ) = 0;
 
   virtual unsigned int getPortCount( void ) = 0;
   virtual std::string getPortName( unsigned int portNumber ) = 0;
+  virtual std::vector<std::string> getPortNames( void );
 
   inline bool isPortOpen() const { return connected_; }
   void setErrorCallback( RtMidiErrorCallback errorCallback, void *userData );
@@ -471,6 +559,8 @@ class MidiInApi : public MidiApi
   MidiInApi( unsigned int queueSizeLimit );
   virtual ~MidiInApi( void );
   void setCallback( RtMidiIn::RtMidiCallback callback, void *userData );
+  void setCallback( RtMidiIn::RtMidiTimedCallback callback, void *userData );
+  void setCallback( RtMidiIn::RtMidiBatchCallback batchCallback, RtMidiIn::RtMidiTimedCallback callback, void *userData );
   void cancelCallback( void );
   virtual void ignoreTypes( bool midiSysex, bool midiTime, bool midiSense );
   double getMessage( std::vector<unsigned char> *message );
@@ -480,10 +570,11 @@ class MidiInApi : public MidiApi
   struct MidiMessage { 
     std::vector<unsigned char> bytes; 
     double timeStamp;
+    unsigned long long time;
 
     // Default constructor.
   MidiMessage()
-  :bytes(0), timeStamp(0.0) {}
+  :bytes(0), timeStamp(0.0), time(0) {}
   };
 
   struct MidiQueue {
@@ -509,16 +600,24 @@ class MidiInApi : public MidiApi
     void *apiData;
     bool usingCallback;
     RtMidiIn::RtMidiCallback userCallback;
+    RtMidiIn::RtMidiTimedCallback userTimedCallback;
+    RtMidiIn::RtMidiBatchCallback userBatchCallback;
     void *userData;
     bool continueSysex;
 
     // Default constructor.
   RtMidiInData()
   : ignoreFlags(7), doInput(false), firstMessage(true),
-      apiData(0), usingCallback(false), userCallback(0), userData(0),
+      apiData(0), usingCallback(false), userCallback(0), userTimedCallback(0), userBatchCallback(0), userData(0),
       continueSysex(false) {}
   };
 
+  // Hands a complete message to whichever user callback is set.
+  static void invokeCallback( RtMidiInData *data, MidiMessage &message );
+
+  // Packs a message for a batch callback; fails if it is too long.
+  static bool packMessage( const MidiMessage &message, RtMidiIn::PackedMessage &packed );
+
  protected:
   RtMidiInData inputData_;
 };
@@ -529,7 +628,10 @@ class MidiOutApi : public MidiApi
 
   MidiOutApi( void );
   virtual ~MidiOutApi( void );
-  virtual void sendMessage( std::vector<unsigned char> *message ) = 0;
+  virtual void sendMessage( const unsigned char *message, size_t size ) = 0;
+  void sendMessage( std::vector<unsigned char> *message ) { sendMessage( message->data(), message->size() ); }
+  virtual void queueMessage( const unsigned char *message, size_t size ) { sendMessage( message, size ); }
+  virtual void flush( void ) {}
 };
 
 // **************************************************************** //
@@ -540,25 +642,34 @@ class MidiOutApi : public MidiApi
 
 inline RtMidi::Api RtMidiIn :: getCurrentApi( void ) throw() { return rtapi_->getCurrentApi(); }
 inline void RtMidiIn :: openPort( unsigned int portNumber, const std::string portName ) { rtapi_->openPort( portNumber, portName ); }
+inline bool RtMidiIn :: openPortAt( int client, int port, const std::string &clientName, const std::string portName ) { return rtapi_->openPortAt( client, port, clientName, portName ); }
 inline void RtMidiIn :: openVirtualPort( const std::string portName ) { rtapi_->openVirtualPort( portName ); }
 inline void RtMidiIn :: closePort( void ) { rtapi_->closePort(); }
 inline bool RtMidiIn :: isPortOpen() const { return rtapi_->isPortOpen(); }
 inline void RtMidiIn :: setCallback( RtMidiCallback callback, void *userData ) { ((MidiInApi *)rtapi_)->setCallback( callback, userData ); }
+inline void RtMidiIn :: setCallback( RtMidiTimedCallback callback, void *userData ) { ((MidiInApi *)rtapi_)->setCallback( callback, userData ); }
+inline void RtMidiIn :: setCallback( RtMidiBatchCallback batchCallback, RtMidiTimedCallback callback, void *userData ) { ((MidiInApi *)rtapi_)->setCallback( batchCallback, callback, userData ); }
 inline void RtMidiIn :: cancelCallback( void ) { ((MidiInApi *)rtapi_)->cancelCallback(); }
 inline unsigned int RtMidiIn :: getPortCount( void ) { return rtapi_->getPortCount(); }
 inline std::string RtMidiIn :: getPortName( unsigned int portNumber ) { return rtapi_->getPortName( portNumber ); }
+inline std::vector<std::string> RtMidiIn :: getPortNames( void ) { return rtapi_->getPortNames(); }
 inline void RtMidiIn :: ignoreTypes( bool midiSysex, bool midiTime, bool midiSense ) { ((MidiInApi *)rtapi_)->ignoreTypes( midiSysex, midiTime, midiSense ); }
 inline double RtMidiIn :: getMessage( std::vector<unsigned char> *message ) { return ((MidiInApi *)rtapi_)->getMessage( message ); }
 inline void RtMidiIn :: setErrorCallback( RtMidiErrorCallback errorCallback, void *userData ) { rtapi_->setErrorCallback(errorCallback, userData); }
 
 inline RtMidi::Api RtMidiOut :: getCurrentApi( void ) throw() { return rtapi_->getCurrentApi(); }
 inline void RtMidiOut :: openPort( unsigned int portNumber, const std::string portName ) { rtapi_->openPort( portNumber, portName ); }
+inline bool RtMidiOut :: openPortAt( int client, int port, const std::string &clientName, const std::string portName ) { return rtapi_->openPortAt( client, port, clientName, portName ); }
 inline void RtMidiOut :: openVirtualPort( const std::string portName ) { rtapi_->openVirtualPort( portName ); }
 inline void RtMidiOut :: closePort( void ) { rtapi_->closePort(); }
 inline bool RtMidiOut :: isPortOpen() const { return rtapi_->isPortOpen(); }
 inline unsigned int RtMidiOut :: getPortCount( void ) { return rtapi_->getPortCount(); }
 inline std::string RtMidiOut :: getPortName( unsigned int portNumber ) { return rtapi_->getPortName( portNumber ); }
+inline std::vector<std::string> RtMidiOut :: getPortNames( void ) { return rtapi_->getPortNames(); }
 inline void RtMidiOut :: sendMessage( std::vector<unsigned char> *message ) { ((MidiOutApi *)rtapi_)->sendMessage( message ); }
+inline void RtMidiOut :: sendMessage( const unsigned char *message, size_t size ) { ((MidiOutApi *)rtapi_)->sendMessage( message, size ); }
+inline void RtMidiOut :: queueMessage( const unsigned char *message, size_t size ) { ((MidiOutApi *)rtapi_)->queueMessage( message, size ); }
+inline void RtMidiOut :: flush( void ) { ((MidiOutApi *)rtapi_)->flush(); }
 inline void RtMidiOut :: setErrorCallback( RtMidiErrorCallback errorCallback, void *userData ) { rtapi_->setErrorCallback(errorCallback, userData); }
 
 // **************************************************************** //
@@ -600,7 +711,7 @@ class MidiOutCore: public MidiOutApi
   void closePort( void );
   unsigned int getPortCount( void );
   std::string getPortName( unsigned int portNumber );
-  void sendMessage( std::vector<unsigned char> *message );
+  void sendMessage( const unsigned char *message, size_t size );
 
  protected:
   void initialize( const std::string& clientName );
@@ -640,7 +751,7 @@ class MidiOutJack: public MidiOutApi
   void closePort( void );
   unsigned int getPortCount( void );
   std::string getPortName( unsigned int portNumber );
-  void sendMessage( std::vector<unsigned char> *message );
+  void sendMessage( const unsigned char *message, size_t size );
 
  protected:
   std::string clientName;
@@ -660,13 +771,16 @@ class MidiInAlsa: public MidiInApi
   ~MidiInAlsa( void );
   RtMidi::Api getCurrentApi( void ) { return RtMidi::LINUX_ALSA; };
   void openPort( unsigned int portNumber, const std::string portName );
+  bool openPortAt( int client, int port, const std::string &clientName, const std::string portName );
   void openVirtualPort( const std::string portName );
   void closePort( void );
   unsigned int getPortCount( void );
   std::string getPortName( unsigned int portNumber );
+  std::vector<std::string> getPortNames( void );
 
  protected:
   void initialize( const std::string& clientName );
+  void connect( int client, int port, const std::string& portName );
 };
 
 class MidiOutAlsa: public MidiOutApi
@@ -676,14 +790,20 @@ class MidiOutAlsa: public MidiOutApi
   ~MidiOutAlsa( void );
   RtMidi::Api getCurrentApi( void ) { return RtMidi::LINUX_ALSA; };
   void openPort( unsigned int portNumber, const std::string portName );
+  bool openPortAt( int client, int port, const std::string &clientName, const std::string portName );
   void openVirtualPort( const std::string portName );
   void closePort( void );
   unsigned int getPortCount( void );
   std::string getPortName( unsigned int portNumber );
-  void sendMessage( std::vector<unsigned char> *message );
+  std::vector<std::string> getPortNames( void );
+  void sendMessage( const unsigned char *message, size_t size );
+  void queueMessage( const unsigned char *message, size_t size );
+  void flush( void );
 
  protected:
   void initialize( const std::string& clientName );
+  void connect( int client, int port, const std::string& portName );
+  bool encodeMessage( const unsigned char *message, size_t size );
 };
 
 #endif
@@ -717,7 +837,7 @@ class MidiOutWinMM: public MidiOutApi
   void closePort( void );
   unsigned int getPortCount( void );
   std::string getPortName( unsigned int portNumber );
-  void sendMessage( std::vector<unsigned char> *message );
+  void sendMessage( const unsigned char *message, size_t size );
 
  protected:
   void initialize( const std::string& clientName );
@@ -752,7 +872,7 @@ class MidiOutDummy: public MidiOutApi
   void closePort( void ) {}
   unsigned int getPortCount( void ) { return 0; }
   std::string getPortName( unsigned int /*portNumber*/ ) { return ""; }
-  void sendMessage( std::vector<unsigned char> * /*message*/ ) {}
+  void sendMessage( const unsigned char * /*message*/, size_t /*size*/ ) {}
 
  protected:
   void initialize( const std::string& /*clientName*/ ) {}